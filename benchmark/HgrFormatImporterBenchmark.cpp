@@ -0,0 +1,172 @@
+/*
+ * File:   HgrFormatImporterBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ *  Create an instance in the graph format 'hgr' consisting of random hyperedges.
+ *
+ *  @param[in] vertexCount  The number of vertices.
+ *  @param[in] edgeCount    The number of hyperedges.
+ *  @param[in] seed         The seed for the random number generator.
+ *
+ *  @return The content of the instance.
+ */
+std::string createInstance(std::size_t vertexCount, std::size_t edgeCount, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+
+    std::string ret = "c random hypergraph\np tw " + std::to_string(vertexCount) + " " + std::to_string(edgeCount) + "\n";
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        std::size_t size = 1 + generator() % 6;
+
+        for (std::size_t position = 0; position < size; ++position)
+        {
+            if (position > 0)
+            {
+                ret += ' ';
+            }
+
+            ret += std::to_string(1 + generator() % vertexCount);
+        }
+
+        ret += '\n';
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute a checksum of the hyperedges of the given graph.
+ *
+ *  @return A checksum of the hyperedges of the given graph or 0 if the graph is a null pointer.
+ */
+std::size_t checksum(const htd::IMultiHypergraph * graph)
+{
+    std::size_t ret = 0;
+
+    if (graph != nullptr)
+    {
+        for (const htd::Hyperedge & hyperedge : graph->hyperedges())
+        {
+            ret = ret * 31 + hyperedge.id();
+
+            for (htd::vertex_t vertex : hyperedge.elements())
+            {
+                ret = ret * 31 + vertex;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Measure the run time of importing the given instance with the given number of threads in milliseconds.
+ */
+double measure(const htd::LibraryInstance * manager, const std::string & instance, std::size_t threadCount, std::size_t & result)
+{
+    htd_io::HgrFormatImporter importer(manager);
+
+    importer.setThreadCount(threadCount);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::IMultiHypergraph> graph(importer.import(instance.data(), instance.size()));
+
+    double ret = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    result = checksum(graph.get());
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = 100000;
+
+    std::size_t edgeCount = 1000000;
+
+    if (argc > 1)
+    {
+        vertexCount = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    if (argc > 2)
+    {
+        edgeCount = std::strtoul(argv[2], nullptr, 10);
+    }
+
+    std::size_t threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), (std::size_t)2);
+
+    if (argc > 3)
+    {
+        threadCount = std::strtoul(argv[3], nullptr, 10);
+    }
+
+    if (vertexCount == 0 || threadCount == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [<VERTEX_COUNT> [<EDGE_COUNT> [<THREAD_COUNT>]]]" << std::endl;
+
+        return 1;
+    }
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::string instance = createInstance(vertexCount, edgeCount, 42);
+
+    std::size_t checksum1 = 0;
+    std::size_t checksum2 = 0;
+
+    double time1 = measure(manager.get(), instance, 1, checksum1);
+    double time2 = measure(manager.get(), instance, threadCount, checksum2);
+
+    std::cout << "Vertices: " << vertexCount << ", hyperedges: " << edgeCount << ", bytes: " << instance.size() << std::endl;
+    std::cout << "Sequential import:          " << time1 << " ms" << std::endl;
+    std::cout << "Parallel import (" << threadCount << " threads): " << time2 << " ms" << std::endl;
+    std::cout << "Speedup:                    " << (time2 > 0 ? time1 / time2 : 0) << std::endl;
+
+    if (checksum1 != checksum2)
+    {
+        std::cerr << "The imported graphs differ!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * File:   PriorityQueueBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ *  The priority updates which are applied after removing the top element in a single step of the simulated elimination process.
+ */
+struct EliminationStep
+{
+    std::vector<std::pair<htd::vertex_t, std::size_t>> updates;
+};
+
+/**
+ *  Create a workload mimicking the priority queue usage of the minimum degree heuristic: In each step the
+ *  vertex of minimum priority is removed and a number of remaining vertices changes its priority slightly.
+ *
+ *  @param[in] vertexCount      The number of vertices.
+ *  @param[in] updatesPerStep   The number of priority updates per elimination step.
+ *  @param[in] seed             The seed for the random number generator.
+ *  @param[out] priorities      The initial priority of each vertex.
+ *
+ *  @return The priority updates for each elimination step.
+ */
+std::vector<EliminationStep> createWorkload(std::size_t vertexCount, std::size_t updatesPerStep, unsigned int seed, std::vector<std::size_t> & priorities)
+{
+    std::mt19937 generator(seed);
+
+    std::vector<EliminationStep> ret(vertexCount);
+
+    priorities.resize(vertexCount);
+
+    std::vector<std::size_t> currentPriorities(vertexCount);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        priorities[vertex] = 1 + generator() % 16;
+
+        currentPriorities[vertex] = priorities[vertex];
+    }
+
+    for (EliminationStep & step : ret)
+    {
+        step.updates.reserve(updatesPerStep);
+
+        for (std::size_t index = 0; index < updatesPerStep; ++index)
+        {
+            htd::vertex_t vertex = generator() % vertexCount;
+
+            std::size_t & priority = currentPriorities[vertex];
+
+            if (generator() % 2 == 0 || priority == 0)
+            {
+                priority += 1 + generator() % 3;
+            }
+            else
+            {
+                --priority;
+            }
+
+            if (priority >= vertexCount)
+            {
+                priority = vertexCount - 1;
+            }
+
+            step.updates.emplace_back(vertex, priority);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Run the workload using htd::PriorityQueue.
+ *
+ *  @return A checksum of the eliminated vertices.
+ */
+std::size_t runPriorityQueue(const std::vector<EliminationStep> & workload, const std::vector<std::size_t> & initialPriorities)
+{
+    std::size_t ret = 0;
+
+    std::size_t vertexCount = initialPriorities.size();
+
+    std::vector<std::size_t> priorities(initialPriorities);
+
+    std::vector<bool> eliminated(vertexCount, false);
+
+    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        priorityQueue.push(vertex, priorities[vertex]);
+    }
+
+    for (const EliminationStep & step : workload)
+    {
+        htd::vertex_t selectedVertex = priorityQueue.top();
+
+        priorityQueue.eraseFromTopCollection(selectedVertex);
+
+        eliminated[selectedVertex] = true;
+
+        ret = ret * 31 + selectedVertex;
+
+        for (const std::pair<htd::vertex_t, std::size_t> & update : step.updates)
+        {
+            if (!eliminated[update.first])
+            {
+                priorityQueue.updatePriority(update.first, priorities[update.first], update.second);
+
+                priorities[update.first] = update.second;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Run the workload using htd::BucketPriorityQueue.
+ *
+ *  @return A checksum of the eliminated vertices.
+ */
+std::size_t runBucketPriorityQueue(const std::vector<EliminationStep> & workload, const std::vector<std::size_t> & initialPriorities)
+{
+    std::size_t ret = 0;
+
+    std::size_t vertexCount = initialPriorities.size();
+
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(vertexCount, vertexCount);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        priorityQueue.push(vertex, initialPriorities[vertex]);
+    }
+
+    for (const EliminationStep & step : workload)
+    {
+        htd::vertex_t selectedVertex = priorityQueue.top();
+
+        priorityQueue.erase(selectedVertex);
+
+        ret = ret * 31 + selectedVertex;
+
+        for (const std::pair<htd::vertex_t, std::size_t> & update : step.updates)
+        {
+            if (priorityQueue.contains(update.first))
+            {
+                priorityQueue.updatePriority(update.first, update.second);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Measure the run time of the given function in milliseconds.
+ */
+template <typename Function>
+double measure(Function function, std::size_t & result)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    result = function();
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = 20000;
+
+    std::size_t updatesPerStep = 8;
+
+    if (argc > 1)
+    {
+        vertexCount = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    if (argc > 2)
+    {
+        updatesPerStep = std::strtoul(argv[2], nullptr, 10);
+    }
+
+    if (vertexCount == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [<VERTEX_COUNT> [<UPDATES_PER_STEP>]]" << std::endl;
+
+        return 1;
+    }
+
+    std::vector<std::size_t> priorities;
+
+    std::vector<EliminationStep> workload = createWorkload(vertexCount, updatesPerStep, 42, priorities);
+
+    std::size_t checksum1 = 0;
+    std::size_t checksum2 = 0;
+
+    double time1 = measure([&](void) { return runPriorityQueue(workload, priorities); }, checksum1);
+    double time2 = measure([&](void) { return runBucketPriorityQueue(workload, priorities); }, checksum2);
+
+    std::cout << "Vertices: " << vertexCount << ", updates per step: " << updatesPerStep << std::endl;
+    std::cout << "htd::PriorityQueue:       " << time1 << " ms" << std::endl;
+    std::cout << "htd::BucketPriorityQueue: " << time2 << " ms" << std::endl;
+    std::cout << "Speedup:                  " << (time2 > 0 ? time1 / time2 : 0) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/* 
+ * File:   ApproximateMinDegreeOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_HPP
+#define HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IWidthLimitableOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface based on the approximate minimum-degree (AMD) elimination ordering algorithm.
+     *
+     *  In contrast to htd::MinDegreeOrderingAlgorithm, the elimination is simulated on a quotient graph consisting of
+     *  the remaining vertices and the cliques (elements) created by previous eliminations. Fill edges are never stored
+     *  explicitly and the memory needed by the algorithm stays linear in the size of the input graph. Vertices are
+     *  selected according to an upper bound of their degree (see Amestoy, Davis and Duff, "An Approximate Minimum
+     *  Degree Ordering Algorithm", SIAM J. Matrix Anal. Appl., 1996), the bag sizes reported are exact.
+     */
+    class ApproximateMinDegreeOrderingAlgorithm : public virtual htd::IWidthLimitableOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type ApproximateMinDegreeOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API ApproximateMinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager);
+            
+            HTD_API virtual ~ApproximateMinDegreeOrderingAlgorithm();
+            
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API ApproximateMinDegreeOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API ApproximateMinDegreeOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitableOrderingAlgorithm * cloneWidthLimitableOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ApproximateMinDegreeOrderingAlgorithm & operator=(const ApproximateMinDegreeOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_HPP */
@@ -0,0 +1,179 @@
+/*
+ * File:   ArenaAllocator.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ARENAALLOCATOR_HPP
+#define HTD_HTD_ARENAALLOCATOR_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/MemoryArena.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace htd
+{
+    /**
+     *  Standard-conforming allocator which obtains its memory from a htd::MemoryArena.
+     *
+     *  Containers using this allocator must not outlive the underlying arena. If no arena
+     *  is given, the allocator falls back to the global operator new and operator delete.
+     */
+    template < typename T >
+    class ArenaAllocator
+    {
+        public:
+            /**
+             *  The type of the allocated elements.
+             */
+            typedef T value_type;
+
+            /**
+             *  Rebind the allocator to another element type.
+             */
+            template < typename U >
+            struct rebind
+            {
+                /**
+                 *  The type of the rebound allocator.
+                 */
+                typedef ArenaAllocator<U> other;
+            };
+
+            /**
+             *  Constructor for an allocator which uses the global operator new and operator delete.
+             */
+            ArenaAllocator(void) HTD_NOEXCEPT : arena_(nullptr)
+            {
+
+            }
+
+            /**
+             *  Constructor for an allocator which obtains its memory from the given arena.
+             *
+             *  @param[in] arena    The memory arena or nullptr if the global operator new and operator delete shall be used.
+             */
+            explicit ArenaAllocator(htd::MemoryArena * arena) HTD_NOEXCEPT : arena_(arena)
+            {
+
+            }
+
+            /**
+             *  Copy constructor for an allocator of another element type.
+             *
+             *  @param[in] original The original allocator.
+             */
+            template < typename U >
+            ArenaAllocator(const ArenaAllocator<U> & original) HTD_NOEXCEPT : arena_(original.arena())
+            {
+
+            }
+
+            /**
+             *  Allocate memory for the given number of elements.
+             *
+             *  @param[in] count    The number of elements.
+             *
+             *  @return A pointer to the allocated, uninitialized memory.
+             */
+            T * allocate(std::size_t count)
+            {
+                if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                {
+                    throw std::bad_alloc();
+                }
+
+                if (arena_ == nullptr)
+                {
+                    return static_cast<T *>(::operator new(count * sizeof(T)));
+                }
+
+                return static_cast<T *>(arena_->allocate(count * sizeof(T), alignof(T)));
+            }
+
+            /**
+             *  Free memory which was allocated via allocate(std::size_t).
+             *
+             *  @param[in] pointer  The pointer to the allocated memory.
+             *  @param[in] count    The number of elements for which the memory was allocated.
+             */
+            void deallocate(T * pointer, std::size_t count) HTD_NOEXCEPT
+            {
+                if (arena_ == nullptr)
+                {
+                    ::operator delete(pointer);
+                }
+                else
+                {
+                    arena_->deallocate(pointer, count * sizeof(T));
+                }
+            }
+
+            /**
+             *  Getter for the memory arena of the allocator.
+             *
+             *  @return The memory arena of the allocator or nullptr if the global operator new and operator delete are used.
+             */
+            htd::MemoryArena * arena(void) const HTD_NOEXCEPT
+            {
+                return arena_;
+            }
+
+        private:
+            /**
+             *  The memory arena of the allocator.
+             */
+            htd::MemoryArena * arena_;
+    };
+
+    /**
+     *  Equality operator for allocators.
+     *
+     *  @param[in] lhs  The first allocator.
+     *  @param[in] rhs  The second allocator.
+     *
+     *  @return True if memory allocated by one allocator can be freed by the other one, false otherwise.
+     */
+    template < typename T, typename U >
+    bool operator==(const ArenaAllocator<T> & lhs, const ArenaAllocator<U> & rhs) HTD_NOEXCEPT
+    {
+        return lhs.arena() == rhs.arena();
+    }
+
+    /**
+     *  Inequality operator for allocators.
+     *
+     *  @param[in] lhs  The first allocator.
+     *  @param[in] rhs  The second allocator.
+     *
+     *  @return True if memory allocated by one allocator cannot be freed by the other one, false otherwise.
+     */
+    template < typename T, typename U >
+    bool operator!=(const ArenaAllocator<T> & lhs, const ArenaAllocator<U> & rhs) HTD_NOEXCEPT
+    {
+        return lhs.arena() != rhs.arena();
+    }
+}
+
+#endif /* HTD_HTD_ARENAALLOCATOR_HPP */
@@ -26,7 +26,7 @@
 #define HTD_HTD_BUCKETELIMINATIONTREEDECOMPOSITIONALGORITHM_HPP
 
 #include <htd/Globals.hpp>
-#include <htd/ITreeDecompositionAlgorithm.hpp>
+#include <htd/IWidthLimitableTreeDecompositionAlgorithm.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 
@@ -35,9 +35,9 @@
 namespace htd
 {
     /**
-     *  Default implementation of the ITreeDecompositionAlgorithm interface based on bucket elimination.
+     *  Default implementation of the IWidthLimitableTreeDecompositionAlgorithm interface based on bucket elimination.
      */
-    class BucketEliminationTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    class BucketEliminationTreeDecompositionAlgorithm : public htd::IWidthLimitableTreeDecompositionAlgorithm
     {
         public:
             /**
@@ -88,40 +88,9 @@ namespace htd
              */
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const;
 
-            /**
-             *  Compute a decomposition of the given graph.
-             *
-             *  @param[in] graph                The input graph to decompose.
-             *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
-             *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
-             *
-             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
-             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
-             *
-             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
-             */
-            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_OVERRIDE;
 
-            /**
-             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
-             *
-             *  @param[in] graph                    The input graph to decompose.
-             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
-             *  @param[in] maxBagSize               The upper bound for the maximum bag size of the decomposition.
-             *  @param[in] maxIterationCount        The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
-             *
-             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
-             *
-             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
-             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
-             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
-             *
-             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
-             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
-             *
-             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
-             */
-            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_OVERRIDE;
 
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_OVERRIDE;
 
@@ -144,42 +113,9 @@ namespace htd
              */
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const;
 
-            /**
-             *  Compute a decomposition of the given graph.
-             *
-             *  @param[in] graph                The input graph to decompose.
-             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
-             *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
-             *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
-             *
-             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
-             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
-             *
-             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
-             */
-            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_OVERRIDE;
 
-            /**
-             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
-             *
-             *  @param[in] graph                    The input graph to decompose.
-             *  @param[in] preprocessedGraph        The input graph in preprocessed format.
-             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
-             *  @param[in] maxBagSize               The upper bound for the maximum bag size of the decomposition.
-             *  @param[in] maxIterationCount        The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
-             *
-             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
-             *
-             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
-             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
-             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
-             *
-             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
-             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
-             *
-             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
-             */
-            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+            HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_OVERRIDE;
 
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination ordering.
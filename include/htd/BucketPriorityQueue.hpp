@@ -0,0 +1,385 @@
+/*
+ * File:   BucketPriorityQueue.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+#define HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <map>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Priority queue for dense, zero-based integral elements (e.g. the vertices of a preprocessed graph)
+     *  with small, non-negative integral priorities. The top elements are the ones with minimum priority.
+     *
+     *  Each priority below the dense priority limit owns a bucket and the queue stores the position of
+     *  each element within its bucket. Hence, insertion, erasure and priority updates take constant time
+     *  and accessing the collection of top elements takes amortized constant time. Priorities at or above
+     *  the dense priority limit are stored in an ordered overflow map, so that sparse, large priorities
+     *  (as they occur for fill values) do not require memory proportional to their magnitude.
+     *
+     *  @note The order of the elements within a bucket is unspecified.
+     */
+    template < typename ValueType, typename PriorityType = std::size_t >
+    class BucketPriorityQueue
+    {
+        public:
+            /**
+             *  Constructor of a new bucket priority queue.
+             *
+             *  @param[in] capacity             The number of elements which can be stored in the priority queue. All elements must be smaller than the capacity.
+             *  @param[in] densePriorityLimit   The number of priorities (starting from zero) for which dense buckets shall be allocated.
+             */
+            BucketPriorityQueue(std::size_t capacity, std::size_t densePriorityLimit) : buckets_(densePriorityLimit), overflowBuckets_(), priority_(capacity, 0), position_(capacity, NOT_CONTAINED), minimumPriority_(densePriorityLimit), denseSize_(0), size_(0)
+            {
+
+            }
+
+            /**
+             *  Check whether the priority queue is emtpy.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements in the priority queue.
+             *
+             *  @return The number of elements in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the given element is stored in the priority queue.
+             *
+             *  @param[in] value    The element.
+             *
+             *  @return True if the given element is stored in the priority queue, false otherwise.
+             */
+            bool contains(const ValueType & value) const
+            {
+                HTD_ASSERT(static_cast<std::size_t>(value) < position_.size())
+
+                return position_[value] != NOT_CONTAINED;
+            }
+
+            /**
+             *  Getter for the priority of an element stored in the priority queue.
+             *
+             *  @param[in] value    The element.
+             *
+             *  @return The priority of the given element.
+             */
+            const PriorityType & priority(const ValueType & value) const
+            {
+                HTD_ASSERT(contains(value))
+
+                return priority_[value];
+            }
+
+            /**
+             *  Access the top element.
+             *
+             *  @return The top element.
+             */
+            const ValueType & top(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return topCollection()[0];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            PriorityType topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return denseSize_ > 0 ? static_cast<PriorityType>(minimumDensePriority()) : overflowBuckets_.begin()->first;
+            }
+
+            /**
+             *  Access the collection of elements with top priority.
+             *
+             *  @return The collection of elements with top priority.
+             */
+            const std::vector<ValueType> & topCollection(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return denseSize_ > 0 ? buckets_[minimumDensePriority()] : overflowBuckets_.begin()->second;
+            }
+
+            /**
+             *  Insert a new element with the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted. The element must not be stored in the priority queue already.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void push(const ValueType & value, const PriorityType & priority)
+            {
+                HTD_ASSERT(!contains(value))
+
+                insertIntoBucket(value, priority);
+
+                ++size_;
+            }
+
+            /**
+             *  Remove the top element.
+             */
+            void pop(void)
+            {
+                HTD_ASSERT(size_ > 0)
+
+                erase(top());
+            }
+
+            /**
+             *  Erase the specific element.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased, false otherwise.
+             */
+            bool erase(const ValueType & value)
+            {
+                /* Copy the element, the given reference may point into the bucket which is modified. */
+                ValueType element = value;
+
+                bool ret = contains(element);
+
+                if (ret)
+                {
+                    removeFromBucket(element);
+
+                    position_[element] = NOT_CONTAINED;
+
+                    --size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the top collection.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the top collection, false otherwise.
+             */
+            bool eraseFromTopCollection(const ValueType & value)
+            {
+                return size_ > 0 && contains(value) && priority_[value] == topPriority() && erase(value);
+            }
+
+            /**
+             *  Update the priority of a specific, existing element.
+             *
+             *  @param[in] value        The element which shall be updated.
+             *  @param[in] newPriority  The new priority of the element which shall be updated.
+             */
+            void updatePriority(const ValueType & value, const PriorityType & newPriority)
+            {
+                HTD_ASSERT(contains(value))
+
+                /* Copy the element, the given reference may point into the bucket which is modified. */
+                ValueType element = value;
+
+                if (priority_[element] != newPriority)
+                {
+                    removeFromBucket(element);
+
+                    insertIntoBucket(element, newPriority);
+                }
+            }
+
+        private:
+            /**
+             *  Marker for elements which are not stored in the priority queue.
+             */
+            static const htd::index_t NOT_CONTAINED = (htd::index_t)-1;
+
+            /**
+             *  The buckets of the dense priorities.
+             */
+            std::vector<std::vector<ValueType>> buckets_;
+
+            /**
+             *  The buckets of the priorities at or above the dense priority limit.
+             */
+            std::map<PriorityType, std::vector<ValueType>> overflowBuckets_;
+
+            /**
+             *  The priority of each element.
+             */
+            std::vector<PriorityType> priority_;
+
+            /**
+             *  The position of each element within its bucket.
+             */
+            std::vector<htd::index_t> position_;
+
+            /**
+             *  A lower bound for the smallest priority with a non-empty dense bucket. (Only meaningful if denseSize_ > 0.)
+             *
+             *  The bound is only advanced when the top elements are accessed, so that removals take constant time.
+             */
+            mutable std::size_t minimumPriority_;
+
+            /**
+             *  The number of elements stored in dense buckets.
+             */
+            std::size_t denseSize_;
+
+            /**
+             *  The number of elements in the priority queue.
+             */
+            std::size_t size_;
+
+            /**
+             *  Getter for the smallest priority with a non-empty dense bucket.
+             *
+             *  @note This function must only be called if denseSize_ > 0.
+             *
+             *  @return The smallest priority with a non-empty dense bucket.
+             */
+            std::size_t minimumDensePriority(void) const
+            {
+                HTD_ASSERT(denseSize_ > 0)
+
+                while (buckets_[minimumPriority_].empty())
+                {
+                    ++minimumPriority_;
+                }
+
+                return minimumPriority_;
+            }
+
+            /**
+             *  Append an element to the bucket of the given priority.
+             *
+             *  @param[in] value    The element.
+             *  @param[in] priority The priority of the element.
+             */
+            void insertIntoBucket(const ValueType & value, const PriorityType & priority)
+            {
+                std::size_t index = static_cast<std::size_t>(priority);
+
+                std::vector<ValueType> * bucket = nullptr;
+
+                if (index < buckets_.size())
+                {
+                    bucket = &(buckets_[index]);
+
+                    if (denseSize_ == 0 || index < minimumPriority_)
+                    {
+                        minimumPriority_ = index;
+                    }
+
+                    ++denseSize_;
+                }
+                else
+                {
+                    bucket = &(overflowBuckets_[priority]);
+                }
+
+                position_[value] = bucket->size();
+
+                priority_[value] = priority;
+
+                bucket->push_back(value);
+            }
+
+            /**
+             *  Remove an element from the bucket of its current priority.
+             *
+             *  @note The last element of the bucket takes the position of the removed element.
+             *
+             *  @param[in] value    The element.
+             */
+            void removeFromBucket(const ValueType & value)
+            {
+                std::size_t index = static_cast<std::size_t>(priority_[value]);
+
+                if (index < buckets_.size())
+                {
+                    removeFromBucket(value, buckets_[index]);
+
+                    --denseSize_;
+                }
+                else
+                {
+                    auto position = overflowBuckets_.find(priority_[value]);
+
+                    HTD_ASSERT(position != overflowBuckets_.end())
+
+                    removeFromBucket(value, position->second);
+
+                    if (position->second.empty())
+                    {
+                        overflowBuckets_.erase(position);
+                    }
+                }
+            }
+
+            /**
+             *  Remove an element from the given bucket.
+             *
+             *  @param[in] value    The element.
+             *  @param[in] bucket   The bucket containing the element.
+             */
+            void removeFromBucket(const ValueType & value, std::vector<ValueType> & bucket)
+            {
+                htd::index_t position = position_[value];
+
+                HTD_ASSERT(position < bucket.size() && bucket[position] == value)
+
+                ValueType last = bucket.back();
+
+                bucket[position] = last;
+
+                position_[last] = position;
+
+                bucket.pop_back();
+            }
+    };
+
+    template < typename ValueType, typename PriorityType >
+    const htd::index_t BucketPriorityQueue<ValueType, PriorityType>::NOT_CONTAINED;
+}
+
+#endif /* HTD_HTD_BUCKETPRIORITYQUEUE_HPP */
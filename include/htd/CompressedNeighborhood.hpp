@@ -0,0 +1,252 @@
+/*
+ * File:   CompressedNeighborhood.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPRESSEDNEIGHBORHOOD_HPP
+#define HTD_HTD_COMPRESSEDNEIGHBORHOOD_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Vertex.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Read-only neighborhood structure of a graph with 0-based vertex identifiers in compressed sparse row format.
+     *
+     *  The neighbors of all vertices are stored in a single contiguous array, the neighbors of the vertex v occupy
+     *  the positions offsets()[v] up to (but excluding) offsets()[v + 1] of this array. Compared to one vector per
+     *  vertex, this requires only two heap allocations in total and neighborhoods are traversed in memory order.
+     *
+     *  @note The neighborhood of each vertex is sorted in ascending order and does not include the vertex itself.
+     */
+    class CompressedNeighborhood
+    {
+        public:
+            /**
+             *  The type of the iterators over the neighborhood of a vertex.
+             */
+            typedef const htd::vertex_t * const_iterator;
+
+            /**
+             *  Constructor for an empty neighborhood structure.
+             */
+            CompressedNeighborhood(void) : offsets_(1, 0), neighbors_()
+            {
+
+            }
+
+            /**
+             *  Constructor for a neighborhood structure holding the given neighborhoods.
+             *
+             *  @param[in] neighborhood The neighborhood of each vertex.
+             */
+            CompressedNeighborhood(const std::vector<std::vector<htd::vertex_t>> & neighborhood) : offsets_(), neighbors_()
+            {
+                assign(neighborhood);
+            }
+
+            /**
+             *  Replace the stored neighborhoods by the given ones.
+             *
+             *  @param[in] neighborhood The neighborhood of each vertex.
+             */
+            void assign(const std::vector<std::vector<htd::vertex_t>> & neighborhood)
+            {
+                std::size_t size = 0;
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    size += currentNeighborhood.size();
+                }
+
+                offsets_.clear();
+                offsets_.reserve(neighborhood.size() + 1);
+                offsets_.push_back(0);
+
+                neighbors_.clear();
+                neighbors_.reserve(size);
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    neighbors_.insert(neighbors_.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+
+                    offsets_.push_back(neighbors_.size());
+                }
+            }
+
+            /**
+             *  Getter for the number of vertices.
+             *
+             *  @return The number of vertices.
+             */
+            std::size_t vertexCount(void) const HTD_NOEXCEPT
+            {
+                return offsets_.size() - 1;
+            }
+
+            /**
+             *  Getter for the total number of stored neighbors, i.e., twice the number of edges.
+             *
+             *  @return The total number of stored neighbors.
+             */
+            std::size_t entryCount(void) const HTD_NOEXCEPT
+            {
+                return neighbors_.size();
+            }
+
+            /**
+             *  Getter for the number of neighbors of the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The number of neighbors of the given vertex.
+             */
+            std::size_t neighborCount(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return offsets_[vertex + 1] - offsets_[vertex];
+            }
+
+            /**
+             *  Getter for an iterator to the first neighbor of the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return An iterator to the first neighbor of the given vertex.
+             */
+            const_iterator begin(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return neighbors_.data() + offsets_[vertex];
+            }
+
+            /**
+             *  Getter for an iterator past the last neighbor of the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return An iterator past the last neighbor of the given vertex.
+             */
+            const_iterator end(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return neighbors_.data() + offsets_[vertex + 1];
+            }
+
+            /**
+             *  Access the neighbor at the specific position of the neighborhood of the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *  @param[in] index    The position of the neighbor.
+             *
+             *  @return The neighbor at the specific position of the neighborhood of the given vertex.
+             */
+            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+            {
+                HTD_ASSERT(index < neighborCount(vertex))
+
+                return neighbors_[offsets_[vertex] + index];
+            }
+
+            /**
+             *  Check whether a vertex is a neighbor of the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *  @param[in] neighbor The potential neighbor.
+             *
+             *  @return True if the given neighbor is contained in the neighborhood of the given vertex, false otherwise.
+             */
+            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+            {
+                return std::binary_search(begin(vertex), end(vertex), neighbor);
+            }
+
+            /**
+             *  Append the neighbors of the given vertex to the end of the given vector.
+             *
+             *  @param[in] vertex   The vertex.
+             *  @param[out] target  The target vector.
+             */
+            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+            {
+                target.insert(target.end(), begin(vertex), end(vertex));
+            }
+
+            /**
+             *  Write a mutable working copy of all neighborhoods to the given vector.
+             *
+             *  The vectors already present in the target are overwritten in place, so that a working copy which is
+             *  refreshed in each iteration of an elimination algorithm re-uses the memory allocated by previous iterations.
+             *
+             *  @param[out] target  The target vector. After the call, it contains one neighborhood per vertex.
+             */
+            void copyTo(std::vector<std::vector<htd::vertex_t>> & target) const
+            {
+                target.resize(vertexCount());
+
+                for (htd::vertex_t vertex = 0; vertex < target.size(); ++vertex)
+                {
+                    target[vertex].assign(begin(vertex), end(vertex));
+                }
+            }
+
+            /**
+             *  Getter for the offsets of the neighborhoods within the contiguous neighbor array.
+             *
+             *  @return The offsets of the neighborhoods within the contiguous neighbor array. (The vector has one entry more than there are vertices.)
+             */
+            const std::vector<htd::index_t> & offsets(void) const HTD_NOEXCEPT
+            {
+                return offsets_;
+            }
+
+            /**
+             *  Getter for the contiguous array storing the neighborhoods of all vertices.
+             *
+             *  @return The contiguous array storing the neighborhoods of all vertices.
+             */
+            const std::vector<htd::vertex_t> & neighbors(void) const HTD_NOEXCEPT
+            {
+                return neighbors_;
+            }
+
+        private:
+            /**
+             *  The offset of the neighborhood of each vertex and the total number of neighbors as last entry.
+             */
+            std::vector<htd::index_t> offsets_;
+
+            /**
+             *  The neighborhoods of all vertices stored one after another.
+             */
+            std::vector<htd::vertex_t> neighbors_;
+    };
+}
+
+#endif /* HTD_HTD_COMPRESSEDNEIGHBORHOOD_HPP */
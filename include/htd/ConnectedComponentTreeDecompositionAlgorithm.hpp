@@ -0,0 +1,201 @@
+/* 
+ * File:   ConnectedComponentTreeDecompositionAlgorithm.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ITreeDecompositionAlgorithm interface which decomposes each connected component of the
+     *  input graph independently by a base decomposition algorithm and joins the resulting decompositions. The root
+     *  of the decomposition of the first component becomes the root of the joined decomposition and the roots of the
+     *  decompositions of all other components are attached to it as children, hence the width of the decomposition is
+     *  the maximum width over all components.
+     *
+     *  Per default, the components are decomposed one after another by the calling thread. Using an iterative base
+     *  algorithm, e.g., htd::WidthMinimizingTreeDecompositionAlgorithm, the iterations are performed per component,
+     *  so a component which is hard to decompose does not hold back the remaining ones.
+     *
+     *  @note Labels computed by the base algorithm are not transferred to the joined decomposition. Labeling functions
+     *  and manipulation operations which shall be applied to the joined decomposition must be provided to this algorithm.
+     */
+    class ConnectedComponentTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new tree decomposition algorithm based on the connected components of the input graph.
+             *
+             *  @note The base decomposition algorithm is created by the tree decomposition algorithm factory of the given management instance.
+             *
+             *  @param[in] manager  The management instance to which the new algorithm belongs.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Constructor for a new tree decomposition algorithm based on the connected components of the input graph.
+             *
+             *  @note When calling this method the control over the memory region of the base decomposition algorithm is transferred to the
+             *  decomposition algorithm. Deleting the base decomposition algorithm provided to this constructor outside the decomposition
+             *  algorithm will lead to undefined behavior.
+             *
+             *  @param[in] manager      The management instance to which the new algorithm belongs.
+             *  @param[in] algorithm    The decomposition algorithm which will be used to decompose each of the connected components.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm);
+
+            /**
+             *  Constructor for a new tree decomposition algorithm based on the connected components of the input graph.
+             *
+             *  @note When calling this method the control over the memory regions of the base decomposition algorithm and the manipulation
+             *  operations is transferred to the decomposition algorithm. Deleting the base decomposition algorithm or a manipulation operation
+             *  provided to this method outside the decomposition algorithm or assigning the same manipulation operation multiple times will
+             *  lead to undefined behavior.
+             *
+             *  @param[in] manager                  The management instance to which the new algorithm belongs.
+             *  @param[in] algorithm                The decomposition algorithm which will be used to decompose each of the connected components.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations);
+
+            /**
+             *  Copy constructor for a htd::ConnectedComponentTreeDecompositionAlgorithm object.
+             *
+             *  @param[in] original The original htd::ConnectedComponentTreeDecompositionAlgorithm object.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::ConnectedComponentTreeDecompositionAlgorithm & original);
+
+            HTD_API virtual ~ConnectedComponentTreeDecompositionAlgorithm();
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const;
+
+            /**
+             *  Compute a decomposition of the given graph.
+             *
+             *  @note If the input graph consists of more than one connected component, the preprocessed graph is split along the connected
+             *  components and each component is decomposed based on its part, so the preprocessing is not repeated per component.
+             *
+             *  @param[in] graph                The input graph to decompose.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] preprocessedGraph            The input graph in preprocessed format.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const;
+
+            /**
+             *  Getter for the number of worker threads which decompose the connected components concurrently (0=one per hardware thread).
+             *
+             *  @return The number of worker threads which decompose the connected components concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall decompose the connected components concurrently (0=one per hardware thread).
+             *
+             *  Per default, a single thread is used. If more than one thread is requested, the components are handed out to the
+             *  worker threads in descending order of their size and each worker thread uses its own clone of the base decomposition
+             *  algorithm. Each component is decomposed using its own random number stream which is seeded by the calling thread, so
+             *  the result does not depend on the order in which the components are assigned to the workers.
+             *
+             *  @note In parallel mode, the base decomposition algorithm must support being cloned and evaluated concurrently.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall decompose the connected components concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            HTD_API void setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API bool isSafelyInterruptible(void) const HTD_OVERRIDE;
+
+            HTD_API bool isComputeInducedEdgesEnabled(void) const HTD_OVERRIDE;
+
+            HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a tree decomposition algorithm based on the connected components of the input graph.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ConnectedComponentTreeDecompositionAlgorithm & operator=(const ConnectedComponentTreeDecompositionAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP */
@@ -106,6 +106,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API const std::vector<htd::vertex_t> & neighborVector(htd::vertex_t vertex) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API std::size_t incomingNeighborCount(htd::vertex_t vertex) const HTD_OVERRIDE;
@@ -126,6 +128,8 @@ namespace htd
 
             HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
 
+            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const HTD_OVERRIDE;
+
             HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
             HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
@@ -146,6 +150,8 @@ namespace htd
 
             HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const HTD_OVERRIDE;
 
+            HTD_API void copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
             HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const HTD_OVERRIDE;
 
             HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const HTD_OVERRIDE;
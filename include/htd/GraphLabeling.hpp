@@ -30,7 +30,7 @@
 #include <htd/IGraphLabeling.hpp>
 #include <htd/ILabel.hpp>
 
-#include <unordered_map>
+#include <vector>
 
 namespace htd
 {
@@ -77,9 +77,45 @@ namespace htd
             HTD_API void clear(void) HTD_OVERRIDE;
 
         private:
-            std::unordered_map<htd::id_t, htd::ILabel *> vertexLabels_;
-
-            std::unordered_map<htd::id_t, htd::ILabel *> edgeLabels_;
+            /**
+             *  The vertex labels, indexed by vertex ID. Unlabeled vertices are represented by a null pointer.
+             */
+            std::vector<htd::ILabel *> vertexLabels_;
+
+            /**
+             *  The edge labels, indexed by edge ID. Unlabeled edges are represented by a null pointer.
+             */
+            std::vector<htd::ILabel *> edgeLabels_;
+
+            /**
+             *  The number of labeled vertices.
+             */
+            std::size_t vertexLabelCount_;
+
+            /**
+             *  The number of labeled edges.
+             */
+            std::size_t edgeLabelCount_;
+
+            /**
+             *  Access the label slot of an identifier and create it if it does not exist yet.
+             *
+             *  @param[in] labels   The dense label storage.
+             *  @param[in] id       The identifier of the labeled vertex or edge.
+             *
+             *  @return The label slot of the given identifier.
+             */
+            static htd::ILabel * & slot(std::vector<htd::ILabel *> & labels, htd::id_t id);
+
+            /**
+             *  Access the label of an identifier.
+             *
+             *  @param[in] labels   The dense label storage.
+             *  @param[in] id       The identifier of the labeled vertex or edge.
+             *
+             *  @return The label of the given identifier or a null pointer if the identifier is not labeled.
+             */
+            static htd::ILabel * find(const std::vector<htd::ILabel *> & labels, htd::id_t id);
     };
 }
 
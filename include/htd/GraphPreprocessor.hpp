@@ -48,10 +48,12 @@ namespace htd
 
             HTD_API htd::IPreprocessedGraph * prepare(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            HTD_API htd::IPreprocessedGraph * prepare(std::vector<std::vector<htd::vertex_t>> && neighborhood, std::size_t edgeCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
             /**
              *  Set the preprocessing strategy which shall be used.
              *
-             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + retain only largest biconnected component)
+             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + splitting at safe separators, i.e., at articulation points and clique minimal separators)
              */
             HTD_API void setPreprocessingStrategy(std::size_t level);
 
@@ -91,10 +93,27 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which decompose the parts split off at safe separators concurrently (0=one per hardware thread).
+             *
+             *  @return The number of worker threads which decompose the parts split off at safe separators concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall decompose the parts split off at safe separators concurrently (0=one per hardware thread).
+             *
+             *  Per default, a single thread is used. If more than one thread is requested, each worker thread uses its own clone
+             *  of the ordering algorithm and each part is processed with its own random number stream which is seeded by the
+             *  calling thread, so the result does not depend on the order in which the parts are assigned to the workers.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall decompose the parts split off at safe separators concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination
-             *  ordering of the remainder of the input graph when only the largest biconnected
-             *  component is retained.
+             *  ordering of the parts of the input graph which are split off at safe separators.
              *
              *  @param[in] algorithm    The ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
@@ -325,14 +325,33 @@ namespace htd
         }
     }
 
+    /**
+     *  Seed the pseudo-random number generator of the calling thread.
+     *
+     *  After calling this function, all random choices of the library which are made by the calling
+     *  thread are based on a generator private to the thread instead of the global std::rand() stream.
+     *  This allows concurrent computations to draw from independent, reproducible random streams.
+     *
+     *  @param[in] seed The seed for the pseudo-random number generator of the calling thread.
+     */
+    HTD_API void seedThreadLocalRandomNumberGenerator(unsigned int seed);
+
+    /**
+     *  Draw a pseudo-random number.
+     *
+     *  @note If seedThreadLocalRandomNumberGenerator(unsigned int) was called before by the calling
+     *  thread, the number is drawn from the thread's private generator, otherwise std::rand() is used.
+     *
+     *  @return A pseudo-random number.
+     */
+    HTD_API std::size_t randomNumber(void);
+
     template < typename T, typename Collection >
     const T & selectRandomElement(const Collection & collection)
     {
         auto position = collection.begin();
 
-        /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-        // coverity[dont_call]
-        std::advance(position, std::rand() % collection.size());
+        std::advance(position, htd::randomNumber() % collection.size());
 
         return *position;
     }
@@ -547,8 +566,8 @@ namespace htd
         return ret;
     }
 
-    template < typename T >
-    void inplace_merge(std::vector<T> & set1, const std::vector<T> & set2)
+    template < typename T, typename Allocator1, typename Allocator2 >
+    void inplace_merge(std::vector<T, Allocator1> & set1, const std::vector<T, Allocator2> & set2)
     {
         if (set2.size() <= 4)
         {
@@ -571,10 +590,10 @@ namespace htd
         }
     }
 
-    template < typename T >
-    void inplace_set_union(std::vector<T> & set1, const std::vector<T> & set2)
+    template < typename T, typename Allocator1, typename Allocator2 >
+    void inplace_set_union(std::vector<T, Allocator1> & set1, const std::vector<T, Allocator2> & set2)
     {
-        std::vector<T> tmp;
+        std::vector<T, Allocator1> tmp(set1.get_allocator());
         tmp.reserve(set2.size());
 
         std::set_difference(set2.begin(), set2.end(), set1.begin(), set1.end(), std::back_inserter(tmp));
@@ -27,10 +27,14 @@
 
 #include <htd/Globals.hpp>
 
+#include <htd/GraphFactory.hpp>
 #include <htd/IMultiHypergraph.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 #include <htd/LibraryInstance.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -57,6 +61,26 @@ namespace htd
              */
             virtual htd::IPreprocessedGraph * prepare(const htd::IMultiHypergraph & graph) const = 0;
 
+            /**
+             *  Prepare the graph given by its neighborhood relation without requiring an instance of IMultiHypergraph.
+             *
+             *  This allows importers to pass parsed input directly to the preprocessor so that the full input graph does
+             *  not have to be materialized before the preprocessing phase. The vertices of the graph are assumed to be
+             *  numbered between htd::Vertex::FIRST and n where n is the size of the given neighborhood relation.
+             *
+             *  @param[in] neighborhood The neighborhood relation of the graph. The entry at position i holds the zero-based
+             *                          indices of the neighbors of vertex i + htd::Vertex::FIRST in ascending order, without
+             *                          duplicates and without the vertex itself.
+             *  @param[in] edgeCount    The number of edges in the input graph.
+             *
+             *  @note The default implementation builds an instance of the default graph type from the neighborhood relation
+             *  and passes it to prepare(const htd::IMultiHypergraph &), so that existing preprocessors keep working. Preprocessors
+             *  which are able to work on the neighborhood relation directly shall override this function.
+             *
+             *  @return A preprocessed version of the input graph.
+             */
+            virtual htd::IPreprocessedGraph * prepare(std::vector<std::vector<htd::vertex_t>> && neighborhood, std::size_t edgeCount) const;
+
             /**
              *  Getter for the associated management class.
              *
@@ -80,6 +104,36 @@ namespace htd
     };
 
     inline htd::IGraphPreprocessor::~IGraphPreprocessor() { }
+
+    inline htd::IPreprocessedGraph * htd::IGraphPreprocessor::prepare(std::vector<std::vector<htd::vertex_t>> && neighborhood, std::size_t edgeCount) const
+    {
+        HTD_UNUSED(edgeCount)
+
+        std::vector<std::vector<htd::vertex_t>> input(std::move(neighborhood));
+
+        htd::IMutableGraph * graph = managementInstance()->graphFactory().createInstance();
+
+        graph->addVertices(input.size());
+
+        for (htd::index_t index = 0; index < input.size(); ++index)
+        {
+            for (htd::vertex_t neighbor : input[index])
+            {
+                if (neighbor > index)
+                {
+                    graph->addEdge(static_cast<htd::vertex_t>(index + htd::Vertex::FIRST), neighbor + htd::Vertex::FIRST);
+                }
+            }
+        }
+
+        std::vector<std::vector<htd::vertex_t>>().swap(input);
+
+        htd::IPreprocessedGraph * ret = prepare(*graph);
+
+        delete graph;
+
+        return ret;
+    }
 }
 
 #endif /* HTD_HTD_IGRAPHPREPROCESSOR_HPP */
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/ConstCollection.hpp>
 
+#include <map>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace htd
@@ -54,6 +57,20 @@ namespace htd
              */
             virtual htd::ConstCollection<htd::vertex_t> vertices(void) const = 0;
 
+            /**
+             *  Access the vector of all vertices in the graph.
+             *
+             *  In contrast to vertices(), iterating over the returned vector does not involve any virtual function calls
+             *  or heap-allocated iterators, so this accessor should be preferred in performance-critical loops.
+             *
+             *  @note The default implementation copies vertices() into a cache which is local to the calling thread, so that
+             *  existing implementations of this interface keep working. The cached vector is kept until the calling thread
+             *  exits. Implementations which store their vertices in a vector shall override this function.
+             *
+             *  @return The vector of all vertices in the graph sorted in ascending order.
+             */
+            virtual const std::vector<htd::vertex_t> & vertexVector(void) const;
+
             /**
              *  Write the collection of all vertices in the graph to the end of a given vector. The result is sorted in ascending order.
              *
@@ -137,6 +154,25 @@ namespace htd
              */
             virtual void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const = 0;
 
+            /**
+             *  Access the vector of all neighbors of a given vertex in the graph.
+             *
+             *  In contrast to neighbors(vertex), iterating over the returned vector does not involve any virtual function calls
+             *  or heap-allocated iterators, so this accessor should be preferred in performance-critical loops.
+             *
+             *  @note The returned reference is only valid until the graph is modified.
+             *
+             *  @note The default implementation copies the result of copyNeighborsTo(vertex, target) into a cache which is
+             *  local to the calling thread, so that existing implementations of this interface keep working. The cached
+             *  vectors are kept until the calling thread exits. Implementations which store the neighborhoods in vectors
+             *  shall override this function.
+             *
+             *  @param[in] vertex   The vertex for which the vector of neighbors shall be returned.
+             *
+             *  @return The vector of all neighbors of the given vertex in the graph sorted in ascending order.
+             */
+            virtual const std::vector<htd::vertex_t> & neighborVector(htd::vertex_t vertex) const;
+
             /**
              *  Access the neighbor at the specific position.
              *
@@ -205,9 +241,56 @@ namespace htd
              */
             virtual IGraphStructure * cloneGraphStructure(void) const = 0;
 #endif
+
+        protected:
+            /**
+             *  Store the content of a vector in a cache which is local to the calling thread.
+             *
+             *  This function provides the storage for the default implementations of the accessors returning references to
+             *  vectors. The cached vector of a key is only replaced if its content changed, so references obtained earlier
+             *  for the same key stay valid as long as the underlying data is not modified.
+             *
+             *  @param[in] owner    The graph structure to which the vector belongs.
+             *  @param[in] kind     The identifier of the accessor which requested the vector.
+             *  @param[in] vertex   The vertex to which the vector belongs or htd::Vertex::UNKNOWN if it belongs to the whole graph.
+             *  @param[in] content  The content of the vector.
+             *
+             *  @return A reference to the cached vector.
+             */
+            static const std::vector<htd::vertex_t> & cachedVector(const htd::IGraphStructure * owner, std::size_t kind, htd::vertex_t vertex, std::vector<htd::vertex_t> && content);
     };
 
     inline htd::IGraphStructure::~IGraphStructure() { }
+
+    inline const std::vector<htd::vertex_t> & htd::IGraphStructure::vertexVector(void) const
+    {
+        const htd::ConstCollection<htd::vertex_t> & vertexCollection = vertices();
+
+        return cachedVector(this, 0, htd::Vertex::UNKNOWN, std::vector<htd::vertex_t>(vertexCollection.begin(), vertexCollection.end()));
+    }
+
+    inline const std::vector<htd::vertex_t> & htd::IGraphStructure::neighborVector(htd::vertex_t vertex) const
+    {
+        std::vector<htd::vertex_t> content;
+
+        copyNeighborsTo(vertex, content);
+
+        return cachedVector(this, 1, vertex, std::move(content));
+    }
+
+    inline const std::vector<htd::vertex_t> & htd::IGraphStructure::cachedVector(const htd::IGraphStructure * owner, std::size_t kind, htd::vertex_t vertex, std::vector<htd::vertex_t> && content)
+    {
+        static thread_local std::map<std::tuple<const htd::IGraphStructure *, std::size_t, htd::vertex_t>, std::vector<htd::vertex_t>> cache;
+
+        std::vector<htd::vertex_t> & ret = cache[std::make_tuple(owner, kind, vertex)];
+
+        if (ret != content)
+        {
+            ret.swap(content);
+        }
+
+        return ret;
+    }
 }
 
 #endif /* HTD_HTD_IGRAPHSTRUCTURE_HPP */
@@ -29,6 +29,7 @@
 #include <htd/Collection.hpp>
 #include <htd/IGraphLabeling.hpp>
 #include <htd/ILabelCollection.hpp>
+#include <htd/LabelHandle.hpp>
 #include <htd/Iterator.hpp>
 
 namespace htd
@@ -91,6 +92,45 @@ namespace htd
              */
             virtual const htd::IGraphLabeling & labeling(const std::string & labelName) const = 0;
 
+            /**
+             *  Get the handle of a label name within the labeling collection.
+             *
+             *  The handle of a name is assigned when the first labeling with this name is added to the collection. It does
+             *  not change while the collection exists, also not when the labeling is removed and added again, and it is
+             *  preserved by copies of the collection. Handles of different collections are unrelated.
+             *
+             *  @param[in] labelName    The name of the labeling.
+             *
+             *  @note The default implementation returns the position of the label name, so that existing implementations of
+             *  this interface keep working. The returned handle is then only valid until a labeling is added or removed.
+             *  Implementations shall override this function together with findLabeling(htd::label_handle_t).
+             *
+             *  @return The handle of the given label name or htd::LabelHandle::UNKNOWN if no labeling with the given name exists.
+             */
+            virtual htd::label_handle_t labelHandle(const std::string & labelName) const;
+
+            /**
+             *  Find the labeling belonging to a label handle.
+             *
+             *  In contrast to labeling(const std::string &), this lookup does not compare label names.
+             *
+             *  @param[in] handle   The handle of the label name, see labelHandle(const std::string &).
+             *
+             *  @return A pointer to the labeling belonging to the given handle or nullptr if no such labeling exists.
+             */
+            virtual htd::IGraphLabeling * findLabeling(htd::label_handle_t handle);
+
+            /**
+             *  Find the labeling belonging to a label handle.
+             *
+             *  In contrast to labeling(const std::string &), this lookup does not compare label names.
+             *
+             *  @param[in] handle   The handle of the label name, see labelHandle(const std::string &).
+             *
+             *  @return A pointer to the labeling belonging to the given handle or nullptr if no such labeling exists.
+             */
+            virtual const htd::IGraphLabeling * findLabeling(htd::label_handle_t handle) const;
+
             /**
              *  Set the labeling with the given name.
              *
@@ -222,6 +262,29 @@ namespace htd
     };
 
     inline htd::ILabelingCollection::~ILabelingCollection() { }
+
+    inline htd::label_handle_t htd::ILabelingCollection::labelHandle(const std::string & labelName) const
+    {
+        for (htd::index_t index = 0; index < labelCount(); ++index)
+        {
+            if (labelNameAtPosition(index) == labelName)
+            {
+                return index;
+            }
+        }
+
+        return htd::LabelHandle::UNKNOWN;
+    }
+
+    inline htd::IGraphLabeling * htd::ILabelingCollection::findLabeling(htd::label_handle_t handle)
+    {
+        return handle < labelCount() ? &(labeling(labelNameAtPosition(handle))) : nullptr;
+    }
+
+    inline const htd::IGraphLabeling * htd::ILabelingCollection::findLabeling(htd::label_handle_t handle) const
+    {
+        return handle < labelCount() ? &(labeling(labelNameAtPosition(handle))) : nullptr;
+    }
 }
 
 #endif /* HTD_HTD_ILABELINGCOLLECTION_HPP */
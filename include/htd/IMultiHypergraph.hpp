@@ -34,6 +34,7 @@
 #include <htd/IGraphStructure.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace htd
 {
@@ -149,6 +150,20 @@ namespace htd
              */
             virtual const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const = 0;
 
+            /**
+             *  Write the endpoints of the hyperedge at the specific position to the end of a given vector. The result is sorted in ascending order and free of duplicates.
+             *
+             *  In contrast to hyperedgeAtPosition(htd::index_t), this function does not require a htd::Hyperedge object for the hyperedge.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *  @param[out] target  The target vector to which the endpoints shall be appended.
+             *
+             *  @note The default implementation copies the sorted endpoints of hyperedgeAtPosition(index), so that existing
+             *  implementations of this interface keep working. Implementations which do not store htd::Hyperedge objects
+             *  shall override this function.
+             */
+            virtual void copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const;
+
             /**
              *  Access the hyperedges at the specific positions.
              *
@@ -204,6 +219,13 @@ namespace htd
     };
 
     inline htd::IMultiHypergraph::~IMultiHypergraph() { }
+
+    inline void htd::IMultiHypergraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+    {
+        const std::vector<htd::vertex_t> & elements = hyperedgeAtPosition(index).sortedElements();
+
+        target.insert(target.end(), elements.begin(), elements.end());
+    }
 }
 
 #endif /* HTD_HTD_IMULTIHYPERGRAPH_HPP */
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiGraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -90,6 +93,23 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) = 0;
 
+            /**
+             *  Add a sequence of new edges to the multi-graph.
+             *
+             *  The neighborhoods of the affected vertices are updated only once after all edges were added, so adding many
+             *  edges via a single call of this function is considerably faster than adding them one after another.
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             *
+             *  @note The default implementation adds the edges one after another via addEdge, so that existing implementations
+             *  of this interface keep working. Implementations which are able to update the neighborhoods in bulk shall
+             *  override this function.
+             *
+             *  @return The ID of the first new edge. The remaining edges get consecutive IDs in the given order. If no
+             *          edge is added, the returned value is the ID the next edge added to the graph will get.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
             /**
              *  Remove an edge from the multi-graph.
              *
@@ -131,6 +151,18 @@ namespace htd
     };
 
     inline htd::IMutableMultiGraph::~IMutableMultiGraph() { }
+
+    inline htd::id_t htd::IMutableMultiGraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+    {
+        htd::id_t ret = nextEdgeId();
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            addEdge(edge.first, edge.second);
+        }
+
+        return ret;
+    }
 }
 
 #endif /* HTD_HTD_IMUTABLEMULTIGRAPH_HPP */
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiHypergraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -135,6 +138,43 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::Hyperedge && hyperedge) = 0;
 
+            /**
+             *  Add a sequence of new edges to the multi-hypergraph.
+             *
+             *  The neighborhoods of the affected vertices are updated only once after all edges were added, so adding many
+             *  edges via a single call of this function is considerably faster than adding them one after another.
+             *
+             *  @param[in] elements The concatenated endpoints of all new hyperedges.
+             *  @param[in] offsets  The position of the first endpoint of each new hyperedge within the vector of endpoints,
+             *                      followed by the position after the last endpoint of the last hyperedge. Each hyperedge
+             *                      must consist of at least one endpoint.
+             *
+             *  @note The default implementation adds the edges one after another via addEdge, so that existing implementations
+             *  of this interface keep working. Implementations which are able to update the neighborhoods in bulk shall
+             *  override this function.
+             *
+             *  @return The ID of the first new edge. The remaining edges get consecutive IDs in the order of the offsets.
+             *          If no edge is added, the returned value is the ID the next edge added to the graph will get.
+             */
+            virtual htd::id_t addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets);
+
+            /**
+             *  Add a sequence of new edges to the multi-hypergraph.
+             *
+             *  The neighborhoods of the affected vertices are updated only once after all edges were added, so adding many
+             *  edges via a single call of this function is considerably faster than adding them one after another.
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             *
+             *  @note The default implementation adds the edges one after another via addEdge, so that existing implementations
+             *  of this interface keep working. Implementations which are able to update the neighborhoods in bulk shall
+             *  override this function.
+             *
+             *  @return The ID of the first new edge. The remaining edges get consecutive IDs in the given order. If no
+             *          edge is added, the returned value is the ID the next edge added to the graph will get.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
             /**
              *  Remove an edge from the multi-hypergraph.
              *
@@ -176,6 +216,30 @@ namespace htd
     };
 
     inline htd::IMutableMultiHypergraph::~IMutableMultiHypergraph() { }
+
+    inline htd::id_t htd::IMutableMultiHypergraph::addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets)
+    {
+        htd::id_t ret = nextEdgeId();
+
+        for (htd::index_t index = 1; index < offsets.size(); ++index)
+        {
+            addEdge(std::vector<htd::vertex_t>(elements.begin() + offsets[index - 1], elements.begin() + offsets[index]));
+        }
+
+        return ret;
+    }
+
+    inline htd::id_t htd::IMutableMultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+    {
+        htd::id_t ret = nextEdgeId();
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            addEdge(edge.first, edge.second);
+        }
+
+        return ret;
+    }
 }
 
 #endif /* HTD_HTD_IMUTABLEMULTIHYPERGRAPH_HPP */
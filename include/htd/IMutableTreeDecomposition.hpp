@@ -125,6 +125,11 @@ namespace htd
              *  @param[in] vertex   The vertex for which the bag content shall be returned.
              *
              *  @return The bag content of the specific vertex.
+             *
+             *  @note Implementations may share identical bags among several vertices and copy a shared bag when it is accessed
+             *  via this function. A reference to the bag content of the vertex obtained via bagContent() before calling this
+             *  function therefore does not reflect modifications made via the returned reference, the bag content has to be
+             *  accessed again instead.
              */
             virtual std::vector<htd::vertex_t> & mutableBagContent(htd::vertex_t vertex) = 0;
 
@@ -27,6 +27,7 @@
 
 #include <htd/Globals.hpp>
 
+#include <htd/CompressedNeighborhood.hpp>
 #include <htd/IGraphStructure.hpp>
 
 namespace htd
@@ -96,6 +97,17 @@ namespace htd
              */
             virtual const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const = 0;
 
+            /**
+             *  Getter for the preprocessed neighborhoods of all vertices in compressed sparse row format.
+             *
+             *  This is the canonical read-only representation of the preprocessed graph. Algorithms which only read
+             *  the neighborhoods or which need a mutable working copy in each iteration should prefer it over
+             *  neighborhood().
+             *
+             *  @return The preprocessed neighborhoods of all vertices in compressed sparse row format.
+             */
+            virtual const htd::CompressedNeighborhood & compressedNeighborhood(void) const = 0;
+
             /**
              *  Getter for the partial vertex elimination ordering computed during the preprocessing phase.
              *
@@ -116,6 +128,22 @@ namespace htd
              *  @return The lower bound of the treewidth of the input graph.
              */
             virtual std::size_t minTreeWidth(void) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Getter for the width induced by eliminating the vertices of the partial elimination ordering.
+             *
+             *  Every tree decomposition which is based on the partial elimination ordering has at least this width. In contrast
+             *  to minTreeWidth(), the value is not necessarily a lower bound for the treewidth of the input graph because parts
+             *  of the ordering may have been computed heuristically.
+             *
+             *  The default implementation returns minTreeWidth().
+             *
+             *  @return The width induced by eliminating the vertices of the partial elimination ordering.
+             */
+            virtual std::size_t eliminationSequenceWidth(void) const HTD_NOEXCEPT
+            {
+                return minTreeWidth();
+            }
     };
 
     inline htd::IPreprocessedGraph::~IPreprocessedGraph() { }
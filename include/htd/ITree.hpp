@@ -150,6 +150,27 @@ namespace htd
              */
             virtual void copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const = 0;
 
+            /**
+             *  Access the vector of all children of a given vertex in the graph.
+             *
+             *  In contrast to children(vertex), iterating over the returned vector does not involve any virtual function calls
+             *  or heap-allocated iterators, so this accessor should be preferred in performance-critical loops.
+             *
+             *  @note The returned reference stays valid when other vertices are added to the tree. It is invalidated when the
+             *  vertex is removed or when the tree is assigned or cleared. Adding or removing children of the vertex invalidates
+             *  iterators into the vector, call childVector(vertex) again to observe its new content.
+             *
+             *  @note The default implementation copies the result of copyChildrenTo(vertex, target) into a cache which is local
+             *  to the calling thread, so that existing implementations of this interface keep working. The cached vectors are
+             *  kept until the calling thread exits. Implementations which store the children in vectors shall override this
+             *  function.
+             *
+             *  @param[in] vertex   The vertex for which the vector of children shall be returned.
+             *
+             *  @return The vector of all children of the given vertex in the graph sorted in ascending order.
+             */
+            virtual const std::vector<htd::vertex_t> & childVector(htd::vertex_t vertex) const;
+
             /**
              *  Access the child at the specific position.
              *
@@ -213,6 +234,15 @@ namespace htd
     };
 
     inline htd::ITree::~ITree() { }
+
+    inline const std::vector<htd::vertex_t> & htd::ITree::childVector(htd::vertex_t vertex) const
+    {
+        std::vector<htd::vertex_t> content;
+
+        copyChildrenTo(vertex, content);
+
+        return cachedVector(this, 2, vertex, std::move(content));
+    }
 }
 
 #endif /* HTD_HTD_ITREE_HPP */
@@ -0,0 +1,85 @@
+/* 
+ * File:   ITreeWidthLowerBoundAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef HTD_HTD_ITREEWIDTHLOWERBOUNDALGORITHM_HPP
+#define HTD_HTD_ITREEWIDTHLOWERBOUNDALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+namespace htd
+{
+    /**
+     * Interface for algorithms which can be used to compute lower bounds for the treewidth of a graph.
+     */
+    class ITreeWidthLowerBoundAlgorithm
+    {
+        public:
+            virtual ~ITreeWidthLowerBoundAlgorithm() = 0;
+
+            /**
+             *  Getter for the associated management class.
+             *
+             *  @return The associated management class.
+             */
+            virtual const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Set a new management class for the library object.
+             *
+             *  @param[in] manager   The new management class for the library object.
+             */
+            virtual void setManagementInstance(const htd::LibraryInstance * const manager) = 0;
+
+            /**
+             *  Compute a lower bound for the treewidth of a given graph.
+             *
+             *  @param[in] graph    The input graph for which the lower bound shall be computed.
+             *
+             *  @return A lower bound for the treewidth of the given graph, i.e., every tree decomposition of the graph has a maximum bag size of at least the returned value plus one.
+             */
+            virtual std::size_t computeLowerBound(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Compute a lower bound for the treewidth of a given graph.
+             *
+             *  @param[in] graph                The input graph for which the lower bound shall be computed.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return A lower bound for the treewidth of the given graph, i.e., every tree decomposition of the graph has a maximum bag size of at least the returned value plus one.
+             */
+            virtual std::size_t computeLowerBound(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Create a deep copy of the current lower bound algorithm.
+             *
+             *  @return A new ITreeWidthLowerBoundAlgorithm object identical to the current lower bound algorithm.
+             */
+            virtual ITreeWidthLowerBoundAlgorithm * clone(void) const = 0;
+    };
+
+    inline htd::ITreeWidthLowerBoundAlgorithm::~ITreeWidthLowerBoundAlgorithm() { }
+}
+
+#endif /* HTD_HTD_ITREEWIDTHLOWERBOUNDALGORITHM_HPP */
@@ -0,0 +1,130 @@
+/* 
+ * File:   IWidthLimitableTreeDecompositionAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_IWIDTHLIMITABLETREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_IWIDTHLIMITABLETREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+
+#include <utility>
+
+namespace htd
+{
+    /**
+     * Interface for tree decomposition algorithms which are able to abandon the computation of a
+     * decomposition as soon as its maximum bag size is known to exceed a given upper bound.
+     */
+    class IWidthLimitableTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            using htd::ITreeDecompositionAlgorithm::computeDecomposition;
+
+            virtual ~IWidthLimitableTreeDecompositionAlgorithm() = 0;
+
+            /**
+             *  Compute a decomposition of the given graph.
+             *
+             *  @param[in] graph                The input graph to decompose.
+             *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
+             *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+             *
+             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
+             *
+             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
+             */
+            virtual std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const = 0;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                    The input graph to decompose.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+             *  @param[in] maxBagSize               The upper bound for the maximum bag size of the decomposition.
+             *  @param[in] maxIterationCount        The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
+             *
+             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
+             */
+            virtual std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const = 0;
+
+            /**
+             *  Compute a decomposition of the given graph.
+             *
+             *  @param[in] graph                The input graph to decompose.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
+             *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+             *
+             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
+             *
+             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
+             */
+            virtual std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const = 0;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                    The input graph to decompose.
+             *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+             *  @param[in] maxBagSize               The upper bound for the maximum bag size of the decomposition.
+             *  @param[in] maxIterationCount        The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
+             *
+             *  @return A pair consisting of the new ITreeDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
+             */
+            virtual std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const = 0;
+
+            /**
+             *  Create a deep copy of the current tree decomposition algorithm.
+             *
+             *  @return A new IWidthLimitableTreeDecompositionAlgorithm object identical to the current tree decomposition algorithm.
+             */
+            virtual IWidthLimitableTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE = 0;
+    };
+
+    inline htd::IWidthLimitableTreeDecompositionAlgorithm::~IWidthLimitableTreeDecompositionAlgorithm() { }
+}
+
+#endif /* HTD_HTD_IWIDTHLIMITABLETREEDECOMPOSITIONALGORITHM_HPP */
@@ -30,6 +30,7 @@
 
 #include <htd/ILabelingFunction.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
+#include <htd/ITreeWidthLowerBoundAlgorithm.hpp>
 
 #include <vector>
 #include <functional>
@@ -187,6 +188,72 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which perform iterations concurrently (0=one per hardware thread).
+             *
+             *  @return The number of worker threads which perform iterations concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall perform iterations concurrently (0=one per hardware thread).
+             *
+             *  Per default, a single thread is used and all iterations are performed one after another by the calling thread.
+             *  If more than one thread is requested, each worker thread uses its own clone of the base decomposition algorithm,
+             *  the fitness function and the manipulation operations as well as its own random number stream, while the best
+             *  decomposition found so far, the progress callback and the iteration and non-improvement counters are shared.
+             *
+             *  @note The progress callback is never invoked concurrently, but it may be invoked from a thread different from
+             *  the calling thread. In parallel mode, the base decomposition algorithm, the fitness function and all manipulation
+             *  operations must support being cloned and evaluated concurrently on the same input graph.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall perform iterations concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            /**
+             *  Getter for the algorithm which is used to compute a lower bound for the treewidth of the input graph.
+             *
+             *  @return The lower bound algorithm or nullptr if no lower bound is computed.
+             */
+            HTD_API const htd::ITreeWidthLowerBoundAlgorithm * lowerBoundAlgorithm(void) const;
+
+            /**
+             *  Set the algorithm which shall be used to compute a lower bound for the treewidth of the input graph.
+             *
+             *  If a lower bound algorithm is set, the algorithm terminates as soon as the width of the best decomposition
+             *  found so far matches the lower bound. Per default, no lower bound algorithm is set, because the provided
+             *  fitness function may also take other properties than the width of a decomposition into account. Hence, a
+             *  lower bound algorithm should only be set if the fitness function gives precedence to minimizing the width.
+             *
+             *  @note When calling this method the control over the memory region of the lower bound algorithm is transferred
+             *  to the decomposition algorithm. Deleting the lower bound algorithm provided to this method outside the decomposition
+             *  algorithm or assigning the same lower bound algorithm multiple times will lead to undefined behavior.
+             *
+             *  @param[in] algorithm    The lower bound algorithm which shall be used or nullptr if no lower bound shall be computed.
+             */
+            HTD_API void setLowerBoundAlgorithm(htd::ITreeWidthLowerBoundAlgorithm * algorithm);
+
+            /**
+             *  Check whether iterations which cannot improve the width of the best decomposition found so far are abandoned early.
+             *
+             *  @return True if iterations which cannot improve the width of the best decomposition found so far are abandoned early, false otherwise.
+             */
+            HTD_API bool isWidthPruningEnabled(void) const;
+
+            /**
+             *  Set whether iterations which cannot improve the width of the best decomposition found so far shall be abandoned early.
+             *
+             *  If width pruning is enabled and the base decomposition algorithm implements htd::IWidthLimitableTreeDecompositionAlgorithm,
+             *  the maximum bag size of the best decomposition found so far is passed to the base decomposition algorithm as upper bound
+             *  and each iteration is abandoned as soon as this bound is exceeded. Per default, width pruning is disabled, because the
+             *  provided fitness function may prefer a decomposition of larger width. Hence, width pruning should only be enabled if the
+             *  fitness function never prefers a decomposition of larger width over one of smaller width.
+             *
+             *  @param[in] widthPruningEnabled  A boolean flag indicating whether iterations which cannot improve the width shall be abandoned early.
+             */
+            HTD_API void setWidthPruningEnabled(bool widthPruningEnabled);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
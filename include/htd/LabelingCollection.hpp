@@ -29,6 +29,7 @@
 #include <htd/ILabelingCollection.hpp>
 #include <htd/IGraphLabeling.hpp>
 #include <htd/ILabelCollection.hpp>
+#include <htd/LabelHandle.hpp>
 #include <htd/Iterator.hpp>
 
 #include <string>
@@ -76,6 +77,12 @@ namespace htd
 
             HTD_API const htd::IGraphLabeling & labeling(const std::string & labelName) const HTD_OVERRIDE;
 
+            HTD_API htd::label_handle_t labelHandle(const std::string & labelName) const HTD_OVERRIDE;
+
+            HTD_API htd::IGraphLabeling * findLabeling(htd::label_handle_t handle) HTD_OVERRIDE;
+
+            HTD_API const htd::IGraphLabeling * findLabeling(htd::label_handle_t handle) const HTD_OVERRIDE;
+
             HTD_API void setLabeling(const std::string & labelName, htd::IGraphLabeling * labeling) HTD_OVERRIDE;
 
             HTD_API void removeLabeling(const std::string & labelName) HTD_OVERRIDE;
@@ -109,9 +116,44 @@ namespace htd
             HTD_API const htd::ConstIterator<std::pair<const std::string, htd::IGraphLabeling *>> end(void) const HTD_OVERRIDE;
 
         private:
+            /**
+             *  The sorted names of all labelings.
+             */
             std::vector<std::string> labelNames_;
 
+            /**
+             *  The labelings, stored at the same position as their name in labelNames_.
+             */
+            std::vector<htd::IGraphLabeling *> labelings_;
+
+            /**
+             *  The handles of the labelings, stored at the same position as their name in labelNames_.
+             */
+            std::vector<htd::label_handle_t> labelHandles_;
+
+            /**
+             *  The label names indexed by their handle. Names whose labeling was removed keep their handle.
+             */
+            std::vector<std::string> handleNames_;
+
+            /**
+             *  The labelings indexed by the handle of their name. Handles without a labeling map to a null pointer.
+             */
+            std::vector<htd::IGraphLabeling *> labelingsByHandle_;
+
+            /**
+             *  The map of all labelings, used for iterating over the collection.
+             */
             std::unordered_map<std::string, htd::IGraphLabeling *> content_;
+
+            /**
+             *  Find the position of a labeling name.
+             *
+             *  @param[in] labelName    The name of the labeling.
+             *
+             *  @return The position of the labeling name in labelNames_ or labelNames_.size() if no labeling with the given name exists.
+             */
+            htd::index_t position(const std::string & labelName) const;
     };
 }
 
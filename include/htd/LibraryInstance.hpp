@@ -27,6 +27,8 @@
 
 #include <htd/Id.hpp>
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 namespace htd
@@ -171,6 +173,11 @@ namespace htd
      */
     class GraphSeparatorAlgorithmFactory;
 
+    /**
+     *  Forward declaration of class htd::MemoryArena.
+     */
+    class MemoryArena;
+
     /**
      *  Central management class of a library instance.
      */
@@ -204,9 +211,12 @@ namespace htd
             HTD_API htd::id_t id(void) const;
 
             /**
-             *  Check whether the terminate(int) function was called.
+             *  Check whether the terminate(int) function was called or whether the deadline of the management instance has passed.
+             *
+             *  @note This function is safe to be called concurrently from multiple threads and it is cheap enough to be polled
+             *  inside the inner loops of the library's algorithms.
              *
-             *  @return True if the terminate(int) function was called, false otherwise.
+             *  @return True if the terminate(int) function was called or if the deadline of the management instance has passed, false otherwise.
              */
             HTD_API bool isTerminated(void) const;
 
@@ -219,18 +229,122 @@ namespace htd
              *  @note After calling this method, no further algorithms from the library associated
              *  with the current library instance shall be run until the reset() method is called,
              *  otherwise the outcome of the algorithms is undefined!
+             *
+             *  @note This method is async-signal-safe and it may be called concurrently from multiple threads.
              */
             HTD_API void terminate(void);
 
             /**
              *  Reset the current management instance.
              *
-             *  Calling this method sets the value of isTerminated() back to false.
-             *  This allows to re-run the library's algorithms after terminate()
-             *  was called.
+             *  Calling this method sets the value of isTerminated() back to false and removes
+             *  the deadline of the management instance. This allows to re-run the library's
+             *  algorithms after terminate() was called or after the deadline has passed.
              */
             HTD_API void reset(void);
 
+            /**
+             *  Set the deadline of the management instance.
+             *
+             *  As soon as the given point in time (according to the monotonic clock std::chrono::steady_clock)
+             *  has passed, isTerminated() returns true, i.e. the running algorithms of the library behave as if
+             *  terminate() was called at the time of the deadline.
+             *
+             *  @note Once the deadline has passed, the management instance stays terminated until reset() is called.
+             *
+             *  @param[in] deadline The point in time after which the running algorithms shall terminate.
+             */
+            HTD_API void setDeadline(const std::chrono::steady_clock::time_point & deadline);
+
+            /**
+             *  Set the deadline of the management instance to a point in time relative to the current time.
+             *
+             *  @param[in] timeout  The amount of time after which the running algorithms shall terminate.
+             */
+            HTD_API void setTimeout(const std::chrono::steady_clock::duration & timeout);
+
+            /**
+             *  Check whether a deadline was set for the management instance.
+             *
+             *  @return True if a deadline was set for the management instance, false otherwise.
+             */
+            HTD_API bool hasDeadline(void) const;
+
+            /**
+             *  Remove the deadline of the management instance.
+             */
+            HTD_API void clearDeadline(void);
+
+            /**
+             *  Getter for the time remaining until the deadline of the management instance has passed.
+             *
+             *  @return The time remaining until the deadline of the management instance has passed, std::chrono::steady_clock::duration::zero()
+             *  if the deadline has already passed and std::chrono::steady_clock::duration::max() if no deadline was set.
+             */
+            HTD_API std::chrono::steady_clock::duration remainingTime(void) const;
+
+            /**
+             *  Check whether the algorithms of the library shall allocate their temporary data structures from a
+             *  per-computation htd::MemoryArena instead of the global heap.
+             *
+             *  @return True if the algorithms of the library shall use arena allocation, false otherwise.
+             */
+            HTD_API bool isArenaAllocationEnabled(void) const;
+
+            /**
+             *  Set whether the algorithms of the library shall allocate their temporary data structures from a
+             *  per-computation htd::MemoryArena instead of the global heap.
+             *
+             *  Arena allocation is enabled by default.
+             *
+             *  @param[in] arenaAllocationEnabled   A boolean flag whether the algorithms of the library shall use arena allocation.
+             */
+            HTD_API void setArenaAllocationEnabled(bool arenaAllocationEnabled);
+
+            /**
+             *  Add the usage of the given memory arena to the allocation statistics of the management instance.
+             *
+             *  Algorithms call this method right before the arena releases its memory.
+             *
+             *  @note This function is safe to be called concurrently from multiple threads.
+             *
+             *  @param[in] arena    The memory arena.
+             */
+            HTD_API void recordArenaUsage(const htd::MemoryArena & arena) const;
+
+            /**
+             *  Getter for the number of recorded memory arenas, i.e., the number of times all temporary data structures of a computation were released at once.
+             *
+             *  @return The number of recorded memory arenas.
+             */
+            HTD_API std::size_t arenaCount(void) const;
+
+            /**
+             *  Getter for the total number of allocations served by the recorded memory arenas.
+             *
+             *  @return The total number of allocations served by the recorded memory arenas.
+             */
+            HTD_API std::size_t arenaAllocationCount(void) const;
+
+            /**
+             *  Getter for the total number of bytes allocated from the recorded memory arenas.
+             *
+             *  @return The total number of bytes allocated from the recorded memory arenas.
+             */
+            HTD_API std::size_t arenaAllocatedBytes(void) const;
+
+            /**
+             *  Getter for the largest number of bytes reserved by a single recorded memory arena.
+             *
+             *  @return The largest number of bytes reserved by a single recorded memory arena.
+             */
+            HTD_API std::size_t arenaPeakReservedBytes(void) const;
+
+            /**
+             *  Reset the allocation statistics of the management instance.
+             */
+            HTD_API void resetArenaStatistics(void);
+
             /**
              *  Access the factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
              */
@@ -0,0 +1,242 @@
+/*
+ * File:   MemoryArena.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_MEMORYARENA_HPP
+#define HTD_HTD_MEMORYARENA_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Monotonic memory arena for short-lived allocations which all share the same lifetime,
+     *  e.g. the temporary data structures of a single decomposition computation.
+     *
+     *  Memory is handed out from large blocks by advancing a pointer. Individual deallocations
+     *  are (apart from the most recent one) ignored, the memory of all allocations is reclaimed
+     *  at once by calling reset() or release() or by destroying the arena.
+     *
+     *  @note A memory arena is not thread-safe. Each thread shall use its own arena.
+     */
+    class MemoryArena
+    {
+        public:
+            /**
+             *  The default size of the memory blocks in bytes.
+             */
+            static constexpr std::size_t DEFAULT_BLOCK_SIZE = 65536;
+
+            /**
+             *  Constructor for a new, empty memory arena.
+             *
+             *  @param[in] blockSize    The minimum size of the memory blocks in bytes.
+             */
+            HTD_API MemoryArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+            /**
+             *  Copy constructor for a memory arena.
+             *
+             *  @param[in] original The original memory arena which shall be copied.
+             */
+            MemoryArena(const MemoryArena & original) = delete;
+
+            /**
+             *  Copy assignment operator for a memory arena.
+             *
+             *  @param[in] original The original memory arena which shall be copied.
+             */
+            MemoryArena & operator=(const MemoryArena & original) = delete;
+
+            /**
+             *  Destructor of a memory arena. All memory blocks are freed.
+             */
+            HTD_API ~MemoryArena();
+
+            /**
+             *  Allocate a chunk of memory from the arena.
+             *
+             *  @param[in] size         The number of bytes which shall be allocated.
+             *  @param[in] alignment    The required alignment of the memory chunk. The alignment must be a power of two.
+             *
+             *  @return A pointer to the allocated memory chunk.
+             */
+            void * allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+            {
+                HTD_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0)
+
+                if (size == 0)
+                {
+                    size = 1;
+                }
+
+                std::uintptr_t position = (reinterpret_cast<std::uintptr_t>(current_) + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+                if (position + size > reinterpret_cast<std::uintptr_t>(end_) || current_ == nullptr)
+                {
+                    return allocateFromNextBlock(size, alignment);
+                }
+
+                current_ = reinterpret_cast<char *>(position + size);
+
+                ++allocationCount_;
+
+                allocatedBytes_ += size;
+
+                return reinterpret_cast<void *>(position);
+            }
+
+            /**
+             *  Return a chunk of memory to the arena.
+             *
+             *  The memory is only made available again if the chunk is the most recent allocation,
+             *  otherwise it is reclaimed by the next call of reset() or release().
+             *
+             *  @param[in] pointer  A pointer to the memory chunk which was returned by allocate().
+             *  @param[in] size     The size of the memory chunk in bytes.
+             */
+            void deallocate(void * pointer, std::size_t size) HTD_NOEXCEPT
+            {
+                if (size == 0)
+                {
+                    size = 1;
+                }
+
+                if (static_cast<char *>(pointer) + size == current_)
+                {
+                    current_ = static_cast<char *>(pointer);
+                }
+            }
+
+            /**
+             *  Invalidate all allocations and make the memory of the arena available again. The memory blocks are kept for re-use.
+             */
+            HTD_API void reset(void);
+
+            /**
+             *  Invalidate all allocations and free all memory blocks of the arena.
+             */
+            HTD_API void release(void);
+
+            /**
+             *  Getter for the number of allocations since the last call of reset() or release().
+             *
+             *  @return The number of allocations since the last call of reset() or release().
+             */
+            HTD_API std::size_t allocationCount(void) const;
+
+            /**
+             *  Getter for the number of bytes allocated since the last call of reset() or release().
+             *
+             *  @return The number of bytes allocated since the last call of reset() or release().
+             */
+            HTD_API std::size_t allocatedBytes(void) const;
+
+            /**
+             *  Getter for the total size of the memory blocks currently held by the arena.
+             *
+             *  @return The total size of the memory blocks currently held by the arena in bytes.
+             */
+            HTD_API std::size_t reservedBytes(void) const;
+
+            /**
+             *  Getter for the number of memory blocks currently held by the arena.
+             *
+             *  @return The number of memory blocks currently held by the arena.
+             */
+            HTD_API std::size_t blockCount(void) const;
+
+        private:
+            /**
+             *  Memory block of the arena.
+             */
+            struct Block
+            {
+                /**
+                 *  The start of the memory block.
+                 */
+                char * memory;
+
+                /**
+                 *  The size of the memory block in bytes.
+                 */
+                std::size_t capacity;
+            };
+
+            /**
+             *  The minimum size of the memory blocks in bytes.
+             */
+            std::size_t blockSize_;
+
+            /**
+             *  The memory blocks of the arena.
+             */
+            std::vector<Block> blocks_;
+
+            /**
+             *  The index of the memory block which shall be used as soon as the current memory block is exhausted.
+             */
+            std::size_t nextBlock_;
+
+            /**
+             *  The first unused byte of the current memory block.
+             */
+            char * current_;
+
+            /**
+             *  The end of the current memory block.
+             */
+            char * end_;
+
+            /**
+             *  The number of allocations since the last call of reset() or release().
+             */
+            std::size_t allocationCount_;
+
+            /**
+             *  The number of bytes allocated since the last call of reset() or release().
+             */
+            std::size_t allocatedBytes_;
+
+            /**
+             *  The total size of the memory blocks currently held by the arena.
+             */
+            std::size_t reservedBytes_;
+
+            /**
+             *  Allocate a chunk of memory which does not fit into the remainder of the current memory block.
+             *
+             *  @param[in] size         The number of bytes which shall be allocated.
+             *  @param[in] alignment    The required alignment of the memory chunk.
+             *
+             *  @return A pointer to the allocated memory chunk.
+             */
+            HTD_API void * allocateFromNextBlock(std::size_t size, std::size_t alignment);
+    };
+}
+
+#endif /* HTD_HTD_MEMORYARENA_HPP */
@@ -0,0 +1,80 @@
+/* 
+ * File:   MinorMinWidthLowerBoundAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef HTD_HTD_MINORMINWIDTHLOWERBOUNDALGORITHM_HPP
+#define HTD_HTD_MINORMINWIDTHLOWERBOUNDALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeWidthLowerBoundAlgorithm.hpp>
+
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ITreeWidthLowerBoundAlgorithm interface based on the minor-min-width heuristic (MMD+ with
+     *  the min-d contraction strategy, see Bodlaender, Koster and Wolle, "Contraction and Treewidth Lower Bounds", 2006).
+     *
+     *  The algorithm repeatedly selects a vertex of minimum degree, records its degree and contracts it into the neighbor
+     *  of minimum degree. Since the treewidth of a minor never exceeds the treewidth of the graph itself, the maximum of
+     *  the recorded degrees is a lower bound for the treewidth. The bound is combined with the minimum treewidth which
+     *  was derived during preprocessing.
+     */
+    class MinorMinWidthLowerBoundAlgorithm : public virtual htd::ITreeWidthLowerBoundAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new lower bound algorithm of type MinorMinWidthLowerBoundAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API MinorMinWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager);
+
+            HTD_API virtual ~MinorMinWidthLowerBoundAlgorithm();
+
+            HTD_API std::size_t computeLowerBound(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API std::size_t computeLowerBound(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API MinorMinWidthLowerBoundAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a lower bound algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            MinorMinWidthLowerBoundAlgorithm & operator=(const MinorMinWidthLowerBoundAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_MINORMINWIDTHLOWERBOUNDALGORITHM_HPP */
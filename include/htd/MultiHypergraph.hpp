@@ -94,12 +94,7 @@ namespace htd
 
             HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
 
-            /**
-             *  Access the vector of all vertices in the tree.
-             *
-             *  @return The vector of all vertices in the tree sorted in ascending order.
-             */
-            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const;
+            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const HTD_OVERRIDE;
 
             HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
@@ -117,6 +112,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API const std::vector<htd::vertex_t> & neighborVector(htd::vertex_t vertex) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API std::size_t isolatedVertexCount(void) const HTD_OVERRIDE;
@@ -135,6 +132,8 @@ namespace htd
 
             HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const HTD_OVERRIDE;
 
+            HTD_API void copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
             HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const HTD_OVERRIDE;
 
             HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const HTD_OVERRIDE;
@@ -163,6 +162,10 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::Hyperedge && hyperedge) HTD_OVERRIDE;
 
+            HTD_API htd::id_t addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets) HTD_OVERRIDE;
+
+            HTD_API htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) HTD_OVERRIDE;
+
             HTD_API void removeEdge(htd::id_t edgeId) HTD_OVERRIDE;
 
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
@@ -324,7 +324,7 @@ namespace htd
 
                 std::vector<VertexNameType> & container = ret.container();
 
-                for (htd::vertex_t vertex : base_->vertices())
+                for (htd::vertex_t vertex : base_->vertexVector())
                 {
                     container.push_back(vertexName(vertex));
                 }
@@ -312,7 +312,7 @@ namespace htd
 
                 std::vector<VertexNameType> & container = ret.container();
 
-                for (htd::vertex_t vertex : base_->vertices())
+                for (htd::vertex_t vertex : base_->vertexVector())
                 {
                     container.push_back(vertexName(vertex));
                 }
@@ -755,6 +755,36 @@ namespace htd
                 return edgeId;
             }
 
+            /**
+             *  Add a new edge to the multi-hypergraph based on the IDs of its endpoints.
+             *
+             *  In contrast to the name-based variants, this method does not need to look up the names of the endpoints.
+             *
+             *  @param[in] elements The IDs of the endpoints of the hyperedge. All IDs must refer to existing vertices.
+             *
+             *  @return The ID of the new edge.
+             */
+            htd::id_t addEdgeByVertexIds(std::vector<htd::vertex_t> && elements)
+            {
+                return base_->addEdge(std::move(elements));
+            }
+
+            /**
+             *  Add a sequence of new edges to the multi-hypergraph based on the IDs of their endpoints.
+             *
+             *  @param[in] elements The concatenated IDs of the endpoints of all new hyperedges. All IDs must refer to existing vertices.
+             *  @param[in] offsets  The position of the first endpoint of each new hyperedge within the vector of endpoints,
+             *                      followed by the position after the last endpoint of the last hyperedge.
+             *
+             *  @return The ID of the first new edge. The remaining edges get consecutive IDs in the order of the offsets.
+             *
+             *  @see htd::IMutableMultiHypergraph::addEdges
+             */
+            htd::id_t addEdgesByVertexIds(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets)
+            {
+                return base_->addEdges(elements, offsets);
+            }
+
             /**
              *  Remove an edge from the multi-hypergraph.
              *
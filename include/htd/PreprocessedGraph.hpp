@@ -89,6 +89,8 @@ namespace htd
 
             HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
 
+            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const HTD_OVERRIDE;
+
             HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
             HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
@@ -109,6 +111,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API const std::vector<htd::vertex_t> & neighborVector(htd::vertex_t vertex) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE;
@@ -126,6 +130,10 @@ namespace htd
              *
              *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
              *
+             *  @note Calling this function invalidates the compressed neighborhood representation, it is re-built from the
+             *  updated neighborhoods upon the next read access. The returned reference must therefore not be used for
+             *  modifications after other member functions of the preprocessed graph were called.
+             *
              *  @return The updatable vector containing the preprocessed neighborhood of each of the vertices.
              */
             HTD_API std::vector<std::vector<htd::vertex_t>> & neighborhood(void) HTD_NOEXCEPT;
@@ -137,6 +145,8 @@ namespace htd
              *
              *  @note The neighborhood returned by this data structure does not include the vertex itself.
              *
+             *  @note Calling this function invalidates the compressed neighborhood representation, see neighborhood(void).
+             *
              *  @param[in] vertex   The vertex whose neighborhood shall be returned.
              *
              *  @return The updatable vector containing the preprocessed neighborhood of the requested vertex.
@@ -145,6 +155,8 @@ namespace htd
 
             HTD_API const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const HTD_OVERRIDE;
 
+            HTD_API const htd::CompressedNeighborhood & compressedNeighborhood(void) const HTD_OVERRIDE;
+
             /**
              *  Remove a vertex from the graph.
              *
@@ -191,6 +203,18 @@ namespace htd
 
             HTD_API std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Updatable getter for the width induced by eliminating the vertices of the partial elimination ordering.
+             *
+             *  @note The const getter never reports a value below minTreeWidth(), hence only widths which are not implied by
+             *  the lower bound have to be recorded here.
+             *
+             *  @return The updatable width induced by eliminating the vertices of the partial elimination ordering.
+             */
+            HTD_API std::size_t & eliminationSequenceWidth(void) HTD_NOEXCEPT;
+
+            HTD_API std::size_t eliminationSequenceWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API PreprocessedGraph * clone(void) const HTD_OVERRIDE;
 #else
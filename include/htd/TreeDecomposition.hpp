@@ -30,7 +30,8 @@
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/LabeledTree.hpp>
 
-#include <unordered_map>
+#include <deque>
+#include <memory>
 
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
@@ -294,9 +295,93 @@ namespace htd
             void getChildBagSetUnion(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const;
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
+            /**
+             *  The bag contents of all vertices of the tree decomposition, indexed by vertex ID.
+             *
+             *  Identical bags of neighboring vertices (and the bags of copied decompositions) are shared. A shared bag is copied
+             *  before it is handed out via mutableBagContent(), so modifications never affect other vertices.
+             */
+            std::deque<std::shared_ptr<std::vector<htd::vertex_t>>> bagContent_;
+
+            /**
+             *  Flags indicating which bags were handed out via mutableBagContent(), indexed by vertex ID.
+             *
+             *  @note Callers may keep the reference returned by mutableBagContent() and modify the bag later on, hence such
+             *  bags are never shared again until the vertex is removed.
+             */
+            std::vector<bool> exclusiveBags_;
+
+            /**
+             *  The induced hyperedges of all vertices of the tree decomposition, indexed by vertex ID.
+             *
+             *  @note A deque is used so that references to existing entries remain valid when new vertices are added.
+             */
+            std::deque<htd::FilteredHyperedgeCollection> inducedEdges_;
 
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            /**
+             *  Set the bag content and the induced hyperedges of a new vertex.
+             *
+             *  @param[in] vertex       The new vertex.
+             *  @param[in] bagContent   The (possibly shared) bag content of the new vertex.
+             *  @param[in] inducedEdges The induced hyperedges of the new vertex.
+             */
+            void createBag(htd::vertex_t vertex, std::shared_ptr<std::vector<htd::vertex_t>> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges);
+
+            /**
+             *  Get a bag with the given content. If the content is equal to the bag of one of the given neighbors, the bag of
+             *  the neighbor is shared instead of allocating a new one.
+             *
+             *  @param[in] content      The content of the bag.
+             *  @param[in] neighbor1    The first neighbor whose bag may be shared or htd::Vertex::UNKNOWN.
+             *  @param[in] neighbor2    The second neighbor whose bag may be shared or htd::Vertex::UNKNOWN.
+             *
+             *  @return A bag with the given content.
+             */
+            std::shared_ptr<std::vector<htd::vertex_t>> sharedBag(const std::vector<htd::vertex_t> & content, htd::vertex_t neighbor1, htd::vertex_t neighbor2) const;
+
+            /**
+             *  Get a bag with the given content. If the content is equal to the bag of one of the given neighbors, the bag of
+             *  the neighbor is shared instead of allocating a new one.
+             *
+             *  @param[in] content      The content of the bag.
+             *  @param[in] neighbor1    The first neighbor whose bag may be shared or htd::Vertex::UNKNOWN.
+             *  @param[in] neighbor2    The second neighbor whose bag may be shared or htd::Vertex::UNKNOWN.
+             *
+             *  @return A bag with the given content.
+             */
+            std::shared_ptr<std::vector<htd::vertex_t>> sharedBag(std::vector<htd::vertex_t> && content, htd::vertex_t neighbor1, htd::vertex_t neighbor2) const;
+
+            /**
+             *  Check whether the bag of a neighbor can be shared for a bag with the given content.
+             *
+             *  @param[in] content  The content of the bag.
+             *  @param[in] neighbor The neighbor whose bag shall be checked or htd::Vertex::UNKNOWN.
+             *
+             *  @return True if the bag of the neighbor is already available and equal to the given content, false otherwise.
+             */
+            bool isShareable(const std::vector<htd::vertex_t> & content, htd::vertex_t neighbor) const;
+
+            /**
+             *  Access the empty bag which is shared by all vertices without bag content.
+             *
+             *  @return The empty bag which is shared by all vertices without bag content.
+             */
+            static const std::shared_ptr<std::vector<htd::vertex_t>> & emptyBag(void);
+
+            /**
+             *  Copy the bag contents of another tree decomposition. Bags which may still be modified via a reference obtained
+             *  from mutableBagContent() of the original decomposition are copied, all other bags are shared.
+             *
+             *  @param[in] original The tree decomposition whose bag contents shall be copied.
+             */
+            void copyBags(const htd::TreeDecomposition & original);
+
+            /**
+             *  Release the bag content and the induced hyperedges of a removed vertex.
+             *
+             *  @param[in] vertex   The removed vertex.
+             */
+            void releaseBag(htd::vertex_t vertex);
     };
 }
 
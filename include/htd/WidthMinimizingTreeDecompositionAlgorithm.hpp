@@ -31,6 +31,7 @@
 #include <htd/ILabelingFunction.hpp>
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
+#include <htd/ITreeWidthLowerBoundAlgorithm.hpp>
 
 #include <vector>
 #include <functional>
@@ -251,6 +252,27 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the algorithm which is used to compute a lower bound for the treewidth of the input graph.
+             *
+             *  @return The lower bound algorithm or nullptr if no lower bound is computed.
+             */
+            HTD_API const htd::ITreeWidthLowerBoundAlgorithm * lowerBoundAlgorithm(void) const;
+
+            /**
+             *  Set the algorithm which shall be used to compute a lower bound for the treewidth of the input graph.
+             *
+             *  The algorithm terminates as soon as the width of the best decomposition found so far matches the lower bound,
+             *  because no further improvement is possible. Per default, htd::MinorMinWidthLowerBoundAlgorithm is used.
+             *
+             *  @note When calling this method the control over the memory region of the lower bound algorithm is transferred
+             *  to the decomposition algorithm. Deleting the lower bound algorithm provided to this method outside the decomposition
+             *  algorithm or assigning the same lower bound algorithm multiple times will lead to undefined behavior.
+             *
+             *  @param[in] algorithm    The lower bound algorithm which shall be used or nullptr if no lower bound shall be computed.
+             */
+            HTD_API void setLowerBoundAlgorithm(htd::ITreeWidthLowerBoundAlgorithm * algorithm);
+
             /**
              *  Check whether the computed decompositions shall contain only subset-maximal bags.
              *
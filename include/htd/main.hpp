@@ -30,17 +30,22 @@
 #include <htd/AddEmptyRootOperation.hpp>
 #include <htd/AddIdenticalJoinNodeParentOperation.hpp>
 #include <htd/Algorithm.hpp>
+#include <htd/ApproximateMinDegreeOrderingAlgorithm.hpp>
+#include <htd/ArenaAllocator.hpp>
 #include <htd/AssemblyInfo.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 #include <htd/Collection.hpp>
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/CompressedNeighborhood.hpp>
 #include <htd/CompressionOperation.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/ConnectedComponentTreeDecompositionAlgorithm.hpp>
 #include <htd/ConstCollection.hpp>
 #include <htd/ConstIteratorBase.hpp>
 #include <htd/ConstIterator.hpp>
@@ -159,9 +164,11 @@
 #include <htd/ITreeDecompositionVerifier.hpp>
 #include <htd/ITree.hpp>
 #include <htd/ITreeTraversal.hpp>
+#include <htd/ITreeWidthLowerBoundAlgorithm.hpp>
 #include <htd/IVertexOrdering.hpp>
 #include <htd/IVertexSelectionStrategy.hpp>
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
+#include <htd/IWidthLimitableTreeDecompositionAlgorithm.hpp>
 #include <htd/IWidthLimitedVertexOrdering.hpp>
 #include <htd/IWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/JoinNodeComplexityReductionOperation.hpp>
@@ -186,15 +193,18 @@
 #include <htd/LabeledTreeFactory.hpp>
 #include <htd/LabeledTree.hpp>
 #include <htd/Label.hpp>
+#include <htd/LabelHandle.hpp>
 #include <htd/LabelingCollection.hpp>
 #include <htd/LibraryInstance.hpp>
 #include <htd/LimitChildCountOperation.hpp>
 #include <htd/LimitMaximumForgottenVertexCountOperation.hpp>
 #include <htd/LimitMaximumIntroducedVertexCountOperation.hpp>
 #include <htd/MaximumCardinalitySearchOrderingAlgorithm.hpp>
+#include <htd/MemoryArena.hpp>
 #include <htd/MinDegreeOrderingAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
 #include <htd/MinimumSeparatorAlgorithm.hpp>
+#include <htd/MinorMinWidthLowerBoundAlgorithm.hpp>
 #include <htd/MultiGraphFactory.hpp>
 #include <htd/MultiGraph.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
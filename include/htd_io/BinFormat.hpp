@@ -0,0 +1,79 @@
+/*
+ * File:   BinFormat.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINFORMAT_HPP
+#define HTD_IO_BINFORMAT_HPP
+
+#include <cstdint>
+
+namespace htd_io
+{
+    /**
+     *  Layout constants of the binary graph format 'bin'.
+     *
+     *  A file in format 'bin' starts with a header of HEADER_SIZE bytes consisting of the
+     *  four characters 'H', 'T', 'D' and 'G', the format version (uint32_t), the byte order
+     *  mark (uint32_t), the flags (uint32_t), the vertex count (uint64_t), the edge count
+     *  (uint64_t) and the total number of hyperedge elements (uint64_t). The header is
+     *  followed by edgeCount + 1 hyperedge offsets (uint64_t) and by the hyperedge elements
+     *  (uint32_t), where the elements of the i-th hyperedge are located in the range
+     *  [offsets[i], offsets[i + 1]) and vertices are identified by their position in the
+     *  range [1, vertexCount]. If the flag VERTEX_NAMES is set, the elements are followed by
+     *  padding to the next multiple of eight bytes, vertexCount + 1 name offsets (uint64_t)
+     *  and the concatenated vertex names.
+     *
+     *  All values are stored in the byte order of the machine which wrote the file.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available input formats.)
+     */
+    struct BinFormat
+    {
+        public:
+            /**
+             *  The version of the format written by the current implementation.
+             */
+            static const std::uint32_t VERSION = 1;
+
+            /**
+             *  The value of the byte order mark when read on a machine with the byte order of the writer.
+             */
+            static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+            /**
+             *  The flag indicating that the file contains vertex names.
+             */
+            static const std::uint32_t VERTEX_NAMES = 0x1;
+
+            /**
+             *  The size of the header in bytes.
+             */
+            static const std::uint32_t HEADER_SIZE = 40;
+
+        private:
+            BinFormat(void);
+    };
+}
+
+#endif /* HTD_IO_BINFORMAT_HPP */
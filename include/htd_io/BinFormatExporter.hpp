@@ -0,0 +1,88 @@
+/*
+ * File:   BinFormatExporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINFORMATEXPORTER_HPP
+#define HTD_IO_BINFORMATEXPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/NamedMultiHypergraph.hpp>
+
+#include <iostream>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Exporter which allows to write graphs in the binary graph format 'bin'.
+     *
+     *  Together with the importers of the text formats, the exporter allows to convert
+     *  instances once so that subsequent runs can skip parsing the text representation.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available input formats.)
+     */
+    class BinFormatExporter
+    {
+        public:
+            /**
+             *  Constructor for a new graph exporter.
+             */
+            HTD_IO_API BinFormatExporter(void);
+
+            /**
+             *  Destructor of a graph exporter.
+             */
+            HTD_IO_API virtual ~BinFormatExporter();
+
+            /**
+             *  Write the given graph to the given output stream.
+             *
+             *  The vertices of the graph are renumbered according to their position in the
+             *  collection of vertices, i.e., the i-th vertex is stored as vertex i + 1.
+             *
+             *  If the graph has more than 2^32 - 1 vertices, nothing is written and the failbit of the stream is set.
+             *
+             *  @param[in] graph        The graph which shall be written.
+             *  @param[in] outputStream The output stream to which the graph shall be written. The stream should be opened in binary mode.
+             */
+            HTD_IO_API void write(const htd::IMultiHypergraph & graph, std::ostream & outputStream) const;
+
+            /**
+             *  Write the given graph together with its vertex names to the given output stream.
+             *
+             *  The vertices of the graph are renumbered according to their position in the
+             *  collection of vertices, i.e., the i-th vertex is stored as vertex i + 1.
+             *
+             *  If the graph has more than 2^32 - 1 vertices, nothing is written and the failbit of the stream is set.
+             *
+             *  @param[in] graph        The graph which shall be written.
+             *  @param[in] outputStream The output stream to which the graph shall be written. The stream should be opened in binary mode.
+             */
+            HTD_IO_API void write(const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const;
+    };
+}
+
+#endif /* HTD_IO_BINFORMATEXPORTER_HPP */
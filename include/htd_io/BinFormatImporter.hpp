@@ -0,0 +1,140 @@
+/*
+ * File:   BinFormatImporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINFORMATIMPORTER_HPP
+#define HTD_IO_BINFORMATIMPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/NamedMultiHypergraph.hpp>
+
+#include <cstddef>
+#include <string>
+#include <iostream>
+
+namespace htd_io
+{
+    /**
+     *  Importer which allows to read instances in the binary graph format 'bin'.
+     *
+     *  Files are mapped into memory if supported by the platform and the graph is built
+     *  directly from the stored hyperedge offsets and elements without any text parsing.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available input formats.)
+     */
+    class BinFormatImporter
+    {
+        public:
+            /**
+             *  Constructor for a new graph importer.
+             */
+            HTD_IO_API BinFormatImporter(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Destructor of a graph importer.
+             */
+            HTD_IO_API virtual ~BinFormatImporter();
+
+            /**
+             *  Create a new IMultiHypergraph instance based on the information stored in a given file.
+             *
+             *  Vertex names stored in the file are ignored.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new IMultiHypergraph instance based on the information stored in the given file or nullptr if the file is not valid.
+             */
+            HTD_IO_API htd::IMultiHypergraph * import(const std::string & path) const;
+
+            /**
+             *  Create a new IMultiHypergraph instance based on the information from a given stream.
+             *
+             *  Vertex names stored in the input are ignored.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             *
+             *  @return A new IMultiHypergraph instance based on the information from the given stream or nullptr if the input is not valid.
+             */
+            HTD_IO_API htd::IMultiHypergraph * import(std::istream & stream) const;
+
+            /**
+             *  Create a new IMultiHypergraph instance based on the information stored in a given memory region.
+             *
+             *  Vertex names stored in the input are ignored.
+             *
+             *  @param[in] data The first byte of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return A new IMultiHypergraph instance based on the information stored in the given memory region or nullptr if the input is not valid.
+             */
+            HTD_IO_API htd::IMultiHypergraph * import(const char * data, std::size_t size) const;
+
+            /**
+             *  Create a new NamedMultiHypergraph instance based on the information stored in a given file.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new NamedMultiHypergraph instance based on the information stored in the given file or nullptr if the file is not valid or does not contain vertex names.
+             */
+            HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * importNamed(const std::string & path) const;
+
+            /**
+             *  Create a new NamedMultiHypergraph instance based on the information from a given stream.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             *
+             *  @return A new NamedMultiHypergraph instance based on the information from the given stream or nullptr if the input is not valid or does not contain vertex names.
+             */
+            HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * importNamed(std::istream & stream) const;
+
+            /**
+             *  Create a new NamedMultiHypergraph instance based on the information stored in a given memory region.
+             *
+             *  @param[in] data The first byte of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return A new NamedMultiHypergraph instance based on the information stored in the given memory region or nullptr if the input is not valid or does not contain vertex names.
+             */
+            HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * importNamed(const char * data, std::size_t size) const;
+
+            /**
+             *  Check whether the header stored in a given memory region announces vertex names.
+             *
+             *  @param[in] data The first byte of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return True if the input starts with a valid header which announces vertex names, false otherwise.
+             */
+            HTD_IO_API bool containsVertexNames(const char * data, std::size_t size) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_BINFORMATIMPORTER_HPP */
@@ -31,6 +31,7 @@
 
 #include <string>
 #include <iostream>
+#include <vector>
 
 namespace htd_io
 {
@@ -58,6 +59,8 @@ namespace htd_io
              *  @param[in] path The path to the file from which the information can be read.
              *
              *  @return A new IMultiGraph instance based on the information stored in the given file.
+             *
+             *  @note The file is read via htd_io::InputBuffer, i.e., it is mapped into memory if supported by the platform.
              */
             HTD_IO_API htd::IMultiGraph * import(const std::string & path) const;
 
@@ -70,6 +73,31 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiGraph * import(std::istream & stream) const;
 
+            /**
+             *  Create a new IMultiGraph instance based on the information stored in a given memory region.
+             *
+             *  @param[in] data The first character of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return A new IMultiGraph instance based on the information stored in the given memory region.
+             */
+            HTD_IO_API htd::IMultiGraph * import(const char * data, std::size_t size) const;
+
+            /**
+             *  Read the neighborhood relation of the graph stored in a given memory region without creating an IMultiGraph instance.
+             *
+             *  The resulting neighborhood relation is in the format expected by htd::IGraphPreprocessor::prepare, i.e., the entry at
+             *  position i holds the zero-based indices of the neighbors of vertex i + 1 in ascending order and without duplicates.
+             *
+             *  @param[in] data             The first character of the input.
+             *  @param[in] size             The size of the input in bytes.
+             *  @param[out] neighborhood    The neighborhood relation of the graph.
+             *  @param[out] edgeCount       The number of edges of the graph.
+             *
+             *  @return True if the input is well-formed, false otherwise.
+             */
+            HTD_IO_API bool importNeighborhood(const char * data, std::size_t size, std::vector<std::vector<htd::vertex_t>> & neighborhood, std::size_t & edgeCount) const;
+
         private:
             struct Implementation;
 
@@ -29,6 +29,7 @@
 
 #include <htd/IMultiHypergraph.hpp>
 
+#include <cstddef>
 #include <string>
 #include <iostream>
 
@@ -58,6 +59,8 @@ namespace htd_io
              *  @param[in] path The path to the file from which the information can be read.
              *
              *  @return A new IMultiHypergraph instance based on the information stored in the given file.
+             *
+             *  @note The file is read via htd_io::InputBuffer, i.e., it is mapped into memory if supported by the platform.
              */
             HTD_IO_API htd::IMultiHypergraph * import(const std::string & path) const;
 
@@ -70,6 +73,38 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiHypergraph * import(std::istream & stream) const;
 
+            /**
+             *  Create a new IMultiHypergraph instance based on the information stored in a given memory region.
+             *
+             *  @param[in] data The first character of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return A new IMultiHypergraph instance based on the information stored in the given memory region.
+             */
+            HTD_IO_API htd::IMultiHypergraph * import(const char * data, std::size_t size) const;
+
+            /**
+             *  Getter for the number of worker threads which parse the hyperedges of the input concurrently (0=one per hardware thread).
+             *
+             *  @return The number of worker threads which parse the hyperedges of the input concurrently.
+             */
+            HTD_IO_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall parse the hyperedges of the input concurrently (0=one per hardware thread).
+             *
+             *  Per default, a single thread is used and the input is parsed line by line by the calling thread. If more than one
+             *  thread is requested, the part of the input following the header is split into chunks which start at the beginning
+             *  of a line. Each chunk is parsed by its own worker thread into a separate buffer and the buffers are added to the
+             *  resulting graph in the order of the chunks afterwards, i.e., the identifiers of the hyperedges do not depend on the
+             *  number of threads. Inputs which are rejected in sequential mode are rejected in parallel mode as well.
+             *
+             *  @note Small inputs are always parsed by the calling thread.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall parse the hyperedges of the input concurrently.
+             */
+            HTD_IO_API void setThreadCount(std::size_t threadCount);
+
         private:
             struct Implementation;
 
@@ -0,0 +1,108 @@
+/*
+ * File:   InputBuffer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_INPUTBUFFER_HPP
+#define HTD_IO_INPUTBUFFER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Read-only view of the complete content of an input file or an input stream.
+     *
+     *  If supported by the platform, files are mapped into memory so that no copy of
+     *  their content is required. Otherwise, and for streams, the content is read into
+     *  a buffer in large blocks. Importers can thus parse the input without per-line
+     *  string allocations and, if required, parse it multiple times.
+     */
+    class InputBuffer
+    {
+        public:
+            /**
+             *  Constructor for a view of the content of a file.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             */
+            HTD_IO_API InputBuffer(const std::string & path);
+
+            /**
+             *  Constructor for a view of the remaining content of a stream.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             */
+            HTD_IO_API InputBuffer(std::istream & stream);
+
+            /**
+             *  Destructor of a view of an input.
+             */
+            HTD_IO_API virtual ~InputBuffer();
+
+            /**
+             *  Check whether the input could be read.
+             *
+             *  @return True if the input could be read, false otherwise.
+             */
+            HTD_IO_API bool valid(void) const;
+
+            /**
+             *  Access the first character of the input.
+             *
+             *  @return A pointer to the first character of the input.
+             */
+            HTD_IO_API const char * data(void) const;
+
+            /**
+             *  Getter for the size of the input.
+             *
+             *  @return The size of the input in bytes.
+             */
+            HTD_IO_API std::size_t size(void) const;
+
+            /**
+             *  Check whether the input is mapped into memory.
+             *
+             *  @return True if the input is mapped into memory, false if it was read into a buffer.
+             */
+            HTD_IO_API bool isMemoryMapped(void) const;
+
+        private:
+            InputBuffer(const InputBuffer & original) = delete;
+
+            InputBuffer & operator=(const InputBuffer & original) = delete;
+
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_INPUTBUFFER_HPP */
@@ -29,6 +29,7 @@
 
 #include <htd/NamedMultiHypergraph.hpp>
 
+#include <cstddef>
 #include <string>
 #include <iostream>
 
@@ -37,6 +38,10 @@ namespace htd_io
     /**
      *  Importer which allows to read instances in the graph format 'lp'.
      *
+     *  The importer considers all facts of the form `vertex(<IDENTIFIER>).` and `edge(<VERTEX1>, ..., <VERTEXn>).`
+     *  regardless of line breaks, i.e., facts may span multiple lines and multiple facts may share a line. All other
+     *  statements as well as comments are skipped.
+     *
      *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available input formats.)
      */
     class LpFormatImporter
@@ -70,6 +75,16 @@ namespace htd_io
              */
             HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * import(std::istream & stream) const;
 
+            /**
+             *  Create a new htd::NamedMultiHypergraph<std::string, std::string> instance based on the information stored in a given memory region.
+             *
+             *  @param[in] data The first character of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return A new htd::NamedMultiHypergraph<std::string, std::string> instance based on the information stored in the given memory region.
+             */
+            HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * import(const char * data, std::size_t size) const;
+
         private:
             struct Implementation;
 
@@ -0,0 +1,123 @@
+/*
+ * File:   PlanFormat.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_PLANFORMAT_HPP
+#define HTD_IO_PLANFORMAT_HPP
+
+#include <cstdint>
+
+namespace htd_io
+{
+    /**
+     *  Layout constants of the binary tree decomposition format 'plan'.
+     *
+     *  A file in format 'plan' is an execution plan for dynamic programming algorithms which can be
+     *  mapped into memory and used without any deserialization. It starts with a header of HEADER_SIZE
+     *  bytes consisting of the four characters 'H', 'T', 'D' and 'P', the format version (uint32_t),
+     *  the byte order mark (uint32_t), the flags (uint32_t), the node count, the vertex count of the
+     *  decomposed graph, the total number of bag elements, the number of hyperedges, the total number
+     *  of hyperedge elements and the total number of induced hyperedges (each of them uint64_t).
+     *
+     *  The nodes are stored in post-order, i.e., each node is identified by its position in the range
+     *  [0, nodeCount), every child precedes its parent and the root is the last node. The header is
+     *  followed by the sections listed below, each of them padded with zero bytes to the next multiple
+     *  of eight bytes:
+     *
+     *  - the node types (uint32_t per node, a combination of LEAF, INTRODUCE, FORGET and JOIN),
+     *  - the parents (uint32_t per node, NO_PARENT for the root),
+     *  - the child offsets (nodeCount + 1 values of type uint64_t),
+     *  - the children (uint32_t, nodeCount - 1 values in total),
+     *  - the bag offsets (nodeCount + 1 values of type uint64_t),
+     *  - the bag elements (uint32_t, sorted vertex identifiers).
+     *
+     *  If the flag INDUCED_EDGES is set, the following sections are appended:
+     *
+     *  - the hyperedge identifiers (uint64_t per hyperedge),
+     *  - the hyperedge offsets (edgeCount + 1 values of type uint64_t),
+     *  - the hyperedge elements (uint32_t, vertex identifiers),
+     *  - the induced hyperedge offsets (nodeCount + 1 values of type uint64_t),
+     *  - the induced hyperedges (uint32_t, positions of the hyperedges in the range [0, edgeCount)).
+     *
+     *  The children, bag elements, hyperedge elements and induced hyperedges of the node or hyperedge
+     *  at position i are located in the range [offsets[i], offsets[i + 1]) of the respective section.
+     *
+     *  All values are stored in the byte order of the machine which wrote the file.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available output formats.)
+     */
+    struct PlanFormat
+    {
+        public:
+            /**
+             *  The version of the format written by the current implementation.
+             */
+            static const std::uint32_t VERSION = 1;
+
+            /**
+             *  The value of the byte order mark when read on a machine with the byte order of the writer.
+             */
+            static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+            /**
+             *  The flag indicating that the file contains the induced hyperedges of each node.
+             */
+            static const std::uint32_t INDUCED_EDGES = 0x1;
+
+            /**
+             *  The size of the header in bytes.
+             */
+            static const std::uint32_t HEADER_SIZE = 64;
+
+            /**
+             *  The parent of the root node.
+             */
+            static const std::uint32_t NO_PARENT = 0xFFFFFFFF;
+
+            /**
+             *  The node type of nodes without children.
+             */
+            static const std::uint32_t LEAF = 0x1;
+
+            /**
+             *  The node type of nodes whose bag contains a vertex which is not contained in the bag of any child.
+             */
+            static const std::uint32_t INTRODUCE = 0x2;
+
+            /**
+             *  The node type of nodes whose bag misses a vertex which is contained in the bag of a child.
+             */
+            static const std::uint32_t FORGET = 0x4;
+
+            /**
+             *  The node type of nodes with more than one child.
+             */
+            static const std::uint32_t JOIN = 0x8;
+
+        private:
+            PlanFormat(void);
+    };
+}
+
+#endif /* HTD_IO_PLANFORMAT_HPP */
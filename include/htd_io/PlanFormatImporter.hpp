@@ -0,0 +1,96 @@
+/*
+ * File:   PlanFormatImporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_PLANFORMATIMPORTER_HPP
+#define HTD_IO_PLANFORMATIMPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/ITreeDecomposition.hpp>
+
+#include <cstddef>
+#include <string>
+#include <iostream>
+
+namespace htd_io
+{
+    /**
+     *  Importer which allows to read tree decompositions in the binary tree decomposition format 'plan'.
+     *
+     *  The nodes of the imported decomposition are created in breadth-first order starting at the root,
+     *  i.e., the node identifiers may differ from the ones of the exported decomposition while the
+     *  structure, the order of the children, the bags and the induced hyperedges are preserved.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available output formats.)
+     */
+    class PlanFormatImporter
+    {
+        public:
+            /**
+             *  Constructor for a new tree decomposition importer.
+             */
+            HTD_IO_API PlanFormatImporter(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Destructor of a tree decomposition importer.
+             */
+            HTD_IO_API virtual ~PlanFormatImporter();
+
+            /**
+             *  Create a new ITreeDecomposition instance based on the information stored in a given file.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new ITreeDecomposition instance based on the information stored in the given file or nullptr if the file is not valid.
+             */
+            HTD_IO_API htd::ITreeDecomposition * import(const std::string & path) const;
+
+            /**
+             *  Create a new ITreeDecomposition instance based on the information from a given stream.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             *
+             *  @return A new ITreeDecomposition instance based on the information from the given stream or nullptr if the input is not valid.
+             */
+            HTD_IO_API htd::ITreeDecomposition * import(std::istream & stream) const;
+
+            /**
+             *  Create a new ITreeDecomposition instance based on the information stored in a given memory region.
+             *
+             *  @param[in] data The first byte of the input.
+             *  @param[in] size The size of the input in bytes.
+             *
+             *  @return A new ITreeDecomposition instance based on the information stored in the given memory region or nullptr if the input is not valid.
+             */
+            HTD_IO_API htd::ITreeDecomposition * import(const char * data, std::size_t size) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_PLANFORMATIMPORTER_HPP */
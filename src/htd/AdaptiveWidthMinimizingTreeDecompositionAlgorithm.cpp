@@ -26,10 +26,11 @@
 #define HTD_HTD_ADAPTIVEWIDTHMINIMIZINGTREEDECOMPOSITIONALGORITHM_CPP
 
 #include <htd/AdaptiveWidthMinimizingTreeDecompositionAlgorithm.hpp>
-#include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/IWidthLimitableTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/MinorMinWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 
@@ -44,7 +45,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true), lowerBoundAlgorithm_(new htd::MinorMinWidthLowerBoundAlgorithm(manager))
     {
 
     }
@@ -54,12 +55,17 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_), lowerBoundAlgorithm_(nullptr)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
             algorithms_.push_back(algorithm->clone());
         }
+
+        if (original.lowerBoundAlgorithm_ != nullptr)
+        {
+            lowerBoundAlgorithm_ = original.lowerBoundAlgorithm_->clone();
+        }
     }
 
     virtual ~Implementation()
@@ -68,6 +74,8 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
         {
             delete algorithm;
         }
+
+        delete lowerBoundAlgorithm_;
     }
 
     /**
@@ -105,6 +113,11 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The algorithm which is used to compute a lower bound for the treewidth of the input graph.
+     */
+    htd::ITreeWidthLowerBoundAlgorithm * lowerBoundAlgorithm_;
+
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
      *
@@ -114,6 +127,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] minimumMaxBagSize        The maximum bag size at which the search can stop because no smaller one exists. (0 if unknown.)
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -129,7 +143,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const;
 
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
@@ -140,6 +154,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] minimumMaxBagSize        The maximum bag size at which the search can stop because no smaller one exists. (0 if unknown.)
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -151,11 +166,11 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
      */
-    htd::ITreeDecomposition * computeImprovedDecomposition(const htd::BucketEliminationTreeDecompositionAlgorithm & algorithm,
+    htd::ITreeDecomposition * computeImprovedDecomposition(const htd::IWidthLimitableTreeDecompositionAlgorithm & algorithm,
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const;
 };
 
 htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -319,6 +334,13 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
+    std::size_t minimumMaxBagSize = 0;
+
+    if (implementation_->lowerBoundAlgorithm_ != nullptr)
+    {
+        minimumMaxBagSize = implementation_->lowerBoundAlgorithm_->computeLowerBound(graph, preprocessedGraph) + 1;
+    }
+
     htd::ITreeDecomposition * ret = nullptr;
 
     std::vector<std::size_t> minimalWidths(implementation_->algorithms_.size(), (std::size_t)-1);
@@ -334,11 +356,11 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
-    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && !managementInstance.isTerminated(); ++round)
+    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && bestMaxBagSize > minimumMaxBagSize && !managementInstance.isTerminated(); ++round)
     {
         htd::index_t algorithmIndex = 0;
 
-        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && bestMaxBagSize > minimumMaxBagSize && !managementInstance.isTerminated(); ++it)
         {
             if (disqualifiedAlgorithms.count(algorithmIndex) == 0)
             {
@@ -448,11 +470,11 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     htd::ITreeDecompositionAlgorithm * selectedAlgorithm = implementation_->algorithms_[htd::selectRandomElement<htd::index_t>(pool)];
 
-    htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationTreeDecompositionAlgorithm = dynamic_cast<htd::BucketEliminationTreeDecompositionAlgorithm *>(selectedAlgorithm);
+    htd::IWidthLimitableTreeDecompositionAlgorithm * widthLimitableAlgorithm = dynamic_cast<htd::IWidthLimitableTreeDecompositionAlgorithm *>(selectedAlgorithm);
 
-    if (bucketEliminationTreeDecompositionAlgorithm != nullptr)
+    if (widthLimitableAlgorithm != nullptr)
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*widthLimitableAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, minimumMaxBagSize);
 
         if (currentDecomposition != nullptr)
         {
@@ -467,7 +489,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
     }
     else
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, minimumMaxBagSize);
 
         if (currentDecomposition != nullptr)
         {
@@ -650,6 +672,18 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setDecisionRounds(s
     implementation_->decisionRounds_ = rounds;
 }
 
+const htd::ITreeWidthLowerBoundAlgorithm * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::lowerBoundAlgorithm(void) const
+{
+    return implementation_->lowerBoundAlgorithm_;
+}
+
+void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setLowerBoundAlgorithm(htd::ITreeWidthLowerBoundAlgorithm * algorithm)
+{
+    delete implementation_->lowerBoundAlgorithm_;
+
+    implementation_->lowerBoundAlgorithm_ = algorithm;
+}
+
 htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::clone(void) const
 {
     return new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(*this);
@@ -659,7 +693,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -669,7 +703,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t nonImprovementCount = 0;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && bestMaxBagSize > minimumMaxBagSize && !managementInstance_->isTerminated())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -747,11 +781,11 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
     return ret;
 }
 
-htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation::computeImprovedDecomposition(const htd::BucketEliminationTreeDecompositionAlgorithm & algorithm,
+htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation::computeImprovedDecomposition(const htd::IWidthLimitableTreeDecompositionAlgorithm & algorithm,
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -759,7 +793,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t remainingIterations = iterationCount_;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && bestMaxBagSize > minimumMaxBagSize && !managementInstance_->isTerminated())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -105,11 +105,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
 
         if (implementation_->enforceAdditionalNode_ || decomposition.isRoot(node) || decomposition.bagContent(decomposition.parent(node)) != bag)
         {
-            htd::vertex_t newParent = decomposition.addParent(node);
-
-            decomposition.mutableBagContent(newParent) = bag;
-
-            decomposition.mutableInducedHyperedges(newParent) = decomposition.inducedHyperedges(node);
+            htd::vertex_t newParent = decomposition.addParent(node, bag, decomposition.inducedHyperedges(node));
 
             for (auto & labelingFunction : labelingFunctions)
             {
@@ -145,11 +141,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
 
             if (implementation_->enforceAdditionalNode_ || decomposition.isRoot(vertex) || decomposition.bagContent(decomposition.parent(vertex)) != bag)
             {
-                htd::vertex_t newParent = decomposition.addParent(vertex);
-
-                decomposition.mutableBagContent(newParent) = bag;
-
-                decomposition.mutableInducedHyperedges(newParent) = decomposition.inducedHyperedges(vertex);
+                htd::vertex_t newParent = decomposition.addParent(vertex, bag, decomposition.inducedHyperedges(vertex));
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
@@ -0,0 +1,398 @@
+/* 
+ * File:   ApproximateMinDegreeOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP
+#define HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ApproximateMinDegreeOrderingAlgorithm.hpp>
+#include <htd/BucketPriorityQueue.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ApproximateMinDegreeOrderingAlgorithm.
+ */
+struct htd::ApproximateMinDegreeOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+};
+
+namespace
+{
+    /**
+     *  The states of an entry of the quotient graph.
+     */
+    enum QuotientGraphEntryState : unsigned char
+    {
+        /**
+         *  The entry does not belong to the remaining part of the input graph.
+         */
+        INACTIVE = 0,
+
+        /**
+         *  The entry is a vertex which was not eliminated yet.
+         */
+        VARIABLE = 1,
+
+        /**
+         *  The entry is a clique (element) created by the elimination of the respective vertex.
+         */
+        ELEMENT = 2,
+
+        /**
+         *  The entry is a clique which is contained in another clique and which is therefore no longer needed.
+         */
+        ABSORBED = 3
+    };
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm::ApproximateMinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm::~ApproximateMinDegreeOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(graph.vertexCount());
+
+    std::size_t iterations = 0;
+
+    std::size_t currentMaxBagSize = (std::size_t)-1;
+
+    do
+    {
+        ordering.clear();
+
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
+
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+std::size_t htd::ApproximateMinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t ret = preprocessedGraph.eliminationSequenceWidth() + 1;
+
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::size_t size = remainingVertices.size();
+
+    const htd::CompressedNeighborhood & neighborhood = preprocessedGraph.compressedNeighborhood();
+
+    std::size_t vertexCount = neighborhood.vertexCount();
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    /* The state of each entry of the quotient graph. */
+    std::vector<unsigned char> state(vertexCount, INACTIVE);
+
+    /* The vertices adjacent to each non-eliminated vertex which are not yet covered by a common element. */
+    std::vector<std::vector<htd::vertex_t>> adjacentVariables(vertexCount);
+
+    /* The elements adjacent to each non-eliminated vertex. */
+    std::vector<std::vector<htd::vertex_t>> adjacentElements(vertexCount);
+
+    /* The non-eliminated vertices contained in each element. */
+    std::vector<std::vector<htd::vertex_t>> elementMembers(vertexCount);
+
+    /* The number of vertices of an element which are not part of the element currently created. */
+    std::vector<std::size_t> externalSize(vertexCount, 0);
+
+    /* Timestamps used for marking vertices and elements without clearing the marks after each elimination step. */
+    std::vector<std::size_t> vertexMark(vertexCount, 0);
+    std::vector<std::size_t> elementMark(vertexCount, 0);
+
+    std::size_t currentMark = 0;
+
+    /* The non-eliminated vertices, prioritized by their approximate degree. */
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(vertexCount, vertexCount + 1);
+
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        state[vertex] = VARIABLE;
+    }
+
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        std::vector<htd::vertex_t> & currentVariables = adjacentVariables[vertex];
+
+        currentVariables.reserve(neighborhood.neighborCount(vertex));
+
+        for (auto it = neighborhood.begin(vertex); it != neighborhood.end(vertex); ++it)
+        {
+            htd::vertex_t neighbor = *it;
+
+            if (state[neighbor] == VARIABLE && neighbor != vertex)
+            {
+                currentVariables.push_back(neighbor);
+            }
+        }
+
+        priorityQueue.push(vertex, currentVariables.size());
+    }
+
+    std::vector<htd::vertex_t> newElement;
+
+    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t pivot = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+
+        priorityQueue.erase(pivot);
+
+        --size;
+
+        state[pivot] = ELEMENT;
+
+        ++currentMark;
+
+        newElement.clear();
+
+        /* Construct the new element as the union of the remaining neighbors and all adjacent elements of the pivot. */
+        for (htd::vertex_t neighbor : adjacentVariables[pivot])
+        {
+            if (state[neighbor] == VARIABLE && vertexMark[neighbor] != currentMark)
+            {
+                vertexMark[neighbor] = currentMark;
+
+                newElement.push_back(neighbor);
+            }
+        }
+
+        for (htd::vertex_t element : adjacentElements[pivot])
+        {
+            if (state[element] == ELEMENT)
+            {
+                for (htd::vertex_t member : elementMembers[element])
+                {
+                    if (state[member] == VARIABLE && vertexMark[member] != currentMark)
+                    {
+                        vertexMark[member] = currentMark;
+
+                        newElement.push_back(member);
+                    }
+                }
+
+                /* The element is a subset of the new element and therefore it is absorbed. */
+                state[element] = ABSORBED;
+
+                std::vector<htd::vertex_t>().swap(elementMembers[element]);
+            }
+        }
+
+        std::vector<htd::vertex_t>().swap(adjacentVariables[pivot]);
+        std::vector<htd::vertex_t>().swap(adjacentElements[pivot]);
+
+        if (newElement.size() + 1 > ret)
+        {
+            ret = newElement.size() + 1;
+        }
+
+        target.push_back(preprocessedGraph.vertexName(pivot));
+
+        /* Determine |Le \ Lp| for each element e adjacent to a vertex of the new element Lp. */
+        for (htd::vertex_t vertex : newElement)
+        {
+            for (htd::vertex_t element : adjacentElements[vertex])
+            {
+                if (state[element] == ELEMENT)
+                {
+                    if (elementMark[element] != currentMark)
+                    {
+                        elementMark[element] = currentMark;
+
+                        externalSize[element] = elementMembers[element].size();
+                    }
+
+                    --externalSize[element];
+                }
+            }
+        }
+
+        std::size_t newElementExternalSize = newElement.size() - 1;
+
+        for (htd::vertex_t vertex : newElement)
+        {
+            std::size_t externalDegree = 0;
+
+            std::vector<htd::vertex_t> & currentElements = adjacentElements[vertex];
+
+            auto elementPosition = currentElements.begin();
+
+            for (htd::vertex_t element : currentElements)
+            {
+                if (state[element] == ELEMENT)
+                {
+                    if (externalSize[element] == 0)
+                    {
+                        /* Aggressive absorption: The element is a subset of the new element. */
+                        state[element] = ABSORBED;
+
+                        std::vector<htd::vertex_t>().swap(elementMembers[element]);
+                    }
+                    else
+                    {
+                        externalDegree += externalSize[element];
+
+                        *elementPosition = element;
+
+                        ++elementPosition;
+                    }
+                }
+            }
+
+            currentElements.erase(elementPosition, currentElements.end());
+
+            currentElements.push_back(pivot);
+
+            std::vector<htd::vertex_t> & currentVariables = adjacentVariables[vertex];
+
+            /* Vertices which are contained in the new element are no longer needed as explicit neighbors. */
+            currentVariables.erase(std::remove_if(currentVariables.begin(), currentVariables.end(), [&](htd::vertex_t neighbor)
+            {
+                return state[neighbor] != VARIABLE || vertexMark[neighbor] == currentMark;
+            }), currentVariables.end());
+
+            externalDegree += currentVariables.size() + newElementExternalSize;
+
+            std::size_t approximateDegree = std::min(size - 1, std::min(priorityQueue.priority(vertex) + newElementExternalSize, externalDegree));
+
+            priorityQueue.updatePriority(vertex, approximateDegree);
+        }
+
+        elementMembers[pivot].assign(newElement.begin(), newElement.end());
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::ApproximateMinDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ApproximateMinDegreeOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::clone(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+#endif
+
+#endif /* HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP */
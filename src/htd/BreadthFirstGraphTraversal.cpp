@@ -97,7 +97,7 @@ void htd::BreadthFirstGraphTraversal::traverse(const htd::IGraphStructure & grap
 
             visitedVertices.insert(currentVertex);
 
-            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
+            const std::vector<htd::vertex_t> & neighborCollection = graph.neighborVector(currentVertex);
 
             auto it = neighborCollection.begin();
 
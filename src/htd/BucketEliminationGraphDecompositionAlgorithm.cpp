@@ -27,6 +27,7 @@
 
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
+#include <htd/ArenaAllocator.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/ILabelingFunction.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
@@ -34,6 +35,7 @@
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/MemoryArena.hpp>
 
 #include <algorithm>
 #include <cstdarg>
@@ -51,6 +53,26 @@
  */
 struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
 {
+    /**
+     *  Vector of vertices whose memory is obtained from the memory arena of the current computation.
+     */
+    typedef std::vector<htd::vertex_t, htd::ArenaAllocator<htd::vertex_t>> VertexBuffer;
+
+    /**
+     *  Vector of indices whose memory is obtained from the memory arena of the current computation.
+     */
+    typedef std::vector<htd::index_t, htd::ArenaAllocator<htd::index_t>> IndexBuffer;
+
+    /**
+     *  Set of vertices whose memory is obtained from the memory arena of the current computation.
+     */
+    typedef std::unordered_set<htd::vertex_t, std::hash<htd::vertex_t>, std::equal_to<htd::vertex_t>, htd::ArenaAllocator<htd::vertex_t>> VertexSet;
+
+    /**
+     *  Mapping between vertices whose memory is obtained from the memory arena of the current computation.
+     */
+    typedef std::unordered_map<htd::vertex_t, htd::vertex_t, std::hash<htd::vertex_t>, std::equal_to<htd::vertex_t>, htd::ArenaAllocator<std::pair<const htd::vertex_t, htd::vertex_t>>> VertexMap;
+
     /**
      *  Constructor for the implementation details structure.
      *
@@ -149,7 +171,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @return The vertex which is ranked first in the vertex elimination ordering.
      */
-    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const;
+    htd::vertex_t getMinimumVertex(const VertexBuffer & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const;
 
     /**
      *  Compress the given decomposition by retaining only subset-maximal bags.
@@ -163,11 +185,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] edgeTarget           A vector holding the first target node for each edge.
      */
     void compressDecomposition(htd::vertex_t startingVertex,
-                               std::vector<std::vector<htd::vertex_t>> & neighbors,
-                               std::vector<std::vector<htd::vertex_t>> & bagContent,
-                               std::unordered_set<htd::vertex_t> & unvisitedVertices,
+                               std::vector<VertexBuffer> & neighbors,
+                               std::vector<VertexBuffer> & bagContent,
+                               VertexSet & unvisitedVertices,
                                std::vector<htd::vertex_t> & relevantVertices,
-                               std::vector<std::vector<htd::index_t>> & inducedEdges,
+                               std::vector<IndexBuffer> & inducedEdges,
                                std::vector<htd::index_t> & edgeTarget) const;
 
     /**
@@ -186,10 +208,10 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] edgeTarget       A vector holding the first target node for each edge.
      */
     void compressDecomposition(htd::vertex_t vertex, htd::vertex_t parent,
-                               std::vector<std::vector<htd::vertex_t>> & neighbors,
-                               std::vector<std::vector<htd::vertex_t>> & bagContent,
+                               std::vector<VertexBuffer> & neighbors,
+                               std::vector<VertexBuffer> & bagContent,
                                std::vector<htd::vertex_t> & relevantVertices,
-                               std::vector<std::vector<htd::index_t>> & inducedEdges,
+                               std::vector<IndexBuffer> & inducedEdges,
                                std::vector<htd::index_t> & edgeTarget) const;
 
     /**
@@ -209,11 +231,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
     void updateDecomposition(const htd::IMultiHypergraph & graph,
                              htd::IMutableGraphDecomposition & decomposition,
                              htd::vertex_t startingVertex,
-                             const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                             std::vector<std::vector<htd::vertex_t>> & bagContent,
-                             std::vector<std::vector<htd::index_t>> & inducedEdges,
-                             std::unordered_set<htd::vertex_t> & unvisitedVertices,
-                             std::unordered_map<htd::vertex_t, htd::vertex_t> & decompositionVertices) const;
+                             const std::vector<VertexBuffer> & neighbors,
+                             std::vector<VertexBuffer> & bagContent,
+                             std::vector<IndexBuffer> & inducedEdges,
+                             VertexSet & unvisitedVertices,
+                             VertexMap & decompositionVertices) const;
 
     /**
      *  Check whether two sets are subset-maximal with respect to the other set.
@@ -225,7 +247,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  If the second set is a proper superset of the first set, the return value is 1. Otherwise, the
      *  return value is 0.
      */
-    int is_maximal(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2) const;
+    int is_maximal(const VertexBuffer & set1, const VertexBuffer & set2) const;
 
     /**
      *  Distribute a given edge, identified by its index, in the decomposition so that the information about induced edges is updated.
@@ -242,9 +264,9 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
     void distributeEdge(htd::index_t edgeIndex,
                         const std::vector<htd::vertex_t> & edge,
                         htd::vertex_t startBucket,
-                        const std::vector<std::vector<htd::vertex_t>> & buckets,
-                        const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                        std::vector<std::vector<htd::index_t>> & inducedEdges,
+                        const std::vector<VertexBuffer> & buckets,
+                        const std::vector<VertexBuffer> & neighbors,
+                        std::vector<IndexBuffer> & inducedEdges,
                         std::vector<htd::id_t> & lastAssignedEdge,
                         std::stack<htd::vertex_t> & originStack) const;
 
@@ -265,9 +287,9 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
                         htd::vertex_t vertex1,
                         htd::vertex_t vertex2,
                         htd::vertex_t startBucket,
-                        const std::vector<std::vector<htd::vertex_t>> & buckets,
-                        const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                        std::vector<std::vector<htd::index_t>> & inducedEdges,
+                        const std::vector<VertexBuffer> & buckets,
+                        const std::vector<VertexBuffer> & neighbors,
+                        std::vector<IndexBuffer> & inducedEdges,
                         std::vector<htd::id_t> & lastAssignedEdge,
                         std::stack<htd::vertex_t> & originStack) const;
 
@@ -278,11 +300,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] set2             The second set.
      *  @param[in] ignoredVertex    The vertex which shall be ignored if it occurs in the second set.
      */
-    void set_union(std::vector<htd::vertex_t> & set1,
-                   const std::vector<htd::vertex_t> & set2,
+    void set_union(VertexBuffer & set1,
+                   const VertexBuffer & set2,
                    htd::vertex_t ignoredVertex) const
     {
-        std::vector<htd::vertex_t> tmp;
+        VertexBuffer tmp(set1.get_allocator());
         tmp.reserve(set2.size());
 
         auto first1 = set1.begin();
@@ -425,7 +447,7 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
 
         for (const auto & labelingFunction : implementation_->labelingFunctions_)
         {
-            for (htd::vertex_t vertex : decomposition->vertices())
+            for (htd::vertex_t vertex : decomposition->vertexVector())
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
@@ -439,7 +461,7 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
 
         for (const auto & labelingFunction : labelingFunctions)
         {
-            for (htd::vertex_t vertex : decomposition->vertices())
+            for (htd::vertex_t vertex : decomposition->vertexVector())
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
@@ -720,11 +742,16 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             std::vector<htd::index_t> indices(lastVertex + 1);
 
-            std::vector<std::vector<htd::vertex_t>> buckets(lastVertex + 1);
+            /* All temporary per-node containers share the lifetime of the computation, hence their memory is released at once. */
+            htd::MemoryArena arena;
+
+            htd::ArenaAllocator<htd::vertex_t> allocator(managementInstance.isArenaAllocationEnabled() ? &arena : nullptr);
 
-            std::vector<std::vector<htd::vertex_t>> neighbors(lastVertex + 1);
+            std::vector<VertexBuffer> buckets(lastVertex + 1, VertexBuffer(allocator));
 
-            std::vector<std::vector<htd::index_t>> inducedEdges(lastVertex + 1);
+            std::vector<VertexBuffer> neighbors(lastVertex + 1, VertexBuffer(allocator));
+
+            std::vector<IndexBuffer> inducedEdges(lastVertex + 1, IndexBuffer(allocator));
 
             std::vector<htd::index_t> edgeTarget(graph.edgeCount());
 
@@ -741,13 +768,14 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             std::size_t edgeCount = graph.edgeCount();
 
-            const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
-
-            auto hyperedgePosition = hyperedges.begin();
+            /* The endpoints are copied into a buffer so that no htd::Hyperedge objects need to be created for the input graph. */
+            std::vector<htd::vertex_t> elements;
 
             for (htd::index_t index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
             {
-                const std::vector<htd::vertex_t> & elements = hyperedgePosition->sortedElements();
+                elements.clear();
+
+                graph.copyHyperedgeElementsTo(index, elements);
 
                 switch (elements.size())
                 {
@@ -768,7 +796,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
                         if (indices[vertex1] < indices[vertex2])
                         {
-                            std::vector<htd::vertex_t> & selectedBucket = buckets[vertex1];
+                            VertexBuffer & selectedBucket = buckets[vertex1];
 
                             auto position = std::lower_bound(selectedBucket.begin(), selectedBucket.end(), vertex2);
 
@@ -783,7 +811,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                         }
                         else
                         {
-                            std::vector<htd::vertex_t> & selectedBucket = buckets[vertex2];
+                            VertexBuffer & selectedBucket = buckets[vertex2];
 
                             auto position = std::lower_bound(selectedBucket.begin(), selectedBucket.end(), vertex1);
 
@@ -812,8 +840,6 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                         break;
                     }
                 }
-
-                ++hyperedgePosition;
             }
 
             for (auto it = ordering.begin(); it != ordering.end() && !managementInstance.isTerminated(); ++it)
@@ -822,7 +848,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
                 DEBUGGING_CODE(std::cout << std::endl << "   Processing bucket " << selection << " ..." << std::endl;)
 
-                const std::vector<htd::vertex_t> & bucket = buckets[selection];
+                const VertexBuffer & bucket = buckets[selection];
 
                 if (bucket.size() > 1)
                 {
@@ -847,7 +873,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                         }
                     )
 
-                    std::vector<htd::vertex_t> & selectedBucket = buckets[minimumVertex];
+                    VertexBuffer & selectedBucket = buckets[minimumVertex];
 
                     this->set_union(selectedBucket, bucket, selection);
 
@@ -856,7 +882,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                 }
             }
 
-            std::unordered_set<htd::vertex_t> unvisitedVertices;
+            VertexSet unvisitedVertices(allocator);
 
             if (compressionEnabled_)
             {
@@ -881,32 +907,30 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             if (computeInducedEdges_)
             {
-                hyperedgePosition = hyperedges.begin();
-
                 std::vector<htd::id_t> lastAssignedEdge(buckets.size() + 1, (htd::id_t)-1);
 
                 std::stack<htd::vertex_t> originStack;
 
                 for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
                 {
-                    const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
+                    elements.clear();
+
+                    graph.copyHyperedgeElementsTo(index, elements);
 
-                    if (edgeElements.size() == 2)
+                    if (elements.size() == 2)
                     {
-                        distributeEdge(index, edgeElements[0], edgeElements[1], edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
+                        distributeEdge(index, elements[0], elements[1], edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
                     }
                     else
                     {
-                        distributeEdge(index, edgeElements, edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
+                        distributeEdge(index, elements, edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
                     }
-
-                    ++hyperedgePosition;
                 }
             }
 
             unvisitedVertices.insert(relevantVertices.begin(), relevantVertices.end());
 
-            std::unordered_map<htd::vertex_t, htd::vertex_t> decompositionVertices;
+            VertexMap decompositionVertices(allocator);
 
             while (!unvisitedVertices.empty())
             {
@@ -914,6 +938,11 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
                 updateDecomposition(graph, *ret, currentVertex, neighbors, buckets, inducedEdges, unvisitedVertices, decompositionVertices);
             }
+
+            if (allocator.arena() != nullptr)
+            {
+                managementInstance.recordArenaUsage(arena);
+            }
         }
     }
     else
@@ -965,7 +994,7 @@ htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation:
     return ordering[minimum];
 }
 
-htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const
+htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const VertexBuffer & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const
 {
     std::size_t minimum = (std::size_t)-1;
 
@@ -983,11 +1012,11 @@ htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation:
 }
 
 void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compressDecomposition(htd::vertex_t startingVertex, 
-                                                                                              std::vector<std::vector<htd::vertex_t>> & neighbors,
-                                                                                              std::vector<std::vector<htd::vertex_t>> & bagContent,
-                                                                                              std::unordered_set<htd::vertex_t> & unvisitedVertices,
+                                                                                              std::vector<VertexBuffer> & neighbors,
+                                                                                              std::vector<VertexBuffer> & bagContent,
+                                                                                              VertexSet & unvisitedVertices,
                                                                                               std::vector<htd::vertex_t> & relevantVertices,
-                                                                                              std::vector<std::vector<htd::index_t>> & inducedEdges,
+                                                                                              std::vector<IndexBuffer> & inducedEdges,
                                                                                               std::vector<htd::index_t> & edgeTarget) const
 {
     htd::vertex_t lastNode = htd::Vertex::UNKNOWN;
@@ -1128,10 +1157,10 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
 }
 
 void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compressDecomposition(htd::vertex_t vertex, htd::vertex_t parent,
-                                                                                              std::vector<std::vector<htd::vertex_t>> & neighbors,
-                                                                                              std::vector<std::vector<htd::vertex_t>> & bagContent,
+                                                                                              std::vector<VertexBuffer> & neighbors,
+                                                                                              std::vector<VertexBuffer> & bagContent,
                                                                                               std::vector<htd::vertex_t> & relevantVertices,
-                                                                                              std::vector<std::vector<htd::index_t>> & inducedEdges,
+                                                                                              std::vector<IndexBuffer> & inducedEdges,
                                                                                               std::vector<htd::index_t> & edgeTarget) const
 {
     int result = is_maximal(bagContent[vertex], bagContent[parent]);
@@ -1143,8 +1172,8 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
             bagContent[vertex].swap(bagContent[parent]);
         }
 
-        std::vector<htd::vertex_t> & currentNeighborhood = neighbors[vertex];
-        std::vector<htd::vertex_t> & parentNeighborhood = neighbors[parent];
+        VertexBuffer & currentNeighborhood = neighbors[vertex];
+        VertexBuffer & parentNeighborhood = neighbors[parent];
 
         currentNeighborhood.erase(std::find(currentNeighborhood.begin(), currentNeighborhood.end(), parent));
         parentNeighborhood.erase(std::find(parentNeighborhood.begin(), parentNeighborhood.end(), vertex));
@@ -1153,17 +1182,17 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
 
         for (htd::vertex_t neighbor : currentNeighborhood)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood2 = neighbors[neighbor];
+            VertexBuffer & currentNeighborhood2 = neighbors[neighbor];
 
             /* Because 'vertex' is a neighbor of 'neighbor', std::find will always find 'vertex' in 'currentNeighborhood2'. */
             // coverity[deref_iterator]
             *(std::find(currentNeighborhood2.begin(), currentNeighborhood2.end(), vertex)) = parent;
         }
 
-        std::vector<htd::vertex_t>().swap(currentNeighborhood);
+        VertexBuffer(currentNeighborhood.get_allocator()).swap(currentNeighborhood);
 
-        std::vector<htd::index_t> & currentInducedEdges = inducedEdges[vertex];
-        std::vector<htd::index_t> & parentInducedEdges = inducedEdges[parent];
+        IndexBuffer & currentInducedEdges = inducedEdges[vertex];
+        IndexBuffer & parentInducedEdges = inducedEdges[parent];
 
         parentInducedEdges.insert(parentInducedEdges.end(), currentInducedEdges.begin(), currentInducedEdges.end());
 
@@ -1172,7 +1201,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
             edgeTarget[index] = parent;
         }
 
-        std::vector<htd::index_t>().swap(currentInducedEdges);
+        IndexBuffer(currentInducedEdges.get_allocator()).swap(currentInducedEdges);
     }
     else
     {
@@ -1180,7 +1209,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
     }
 }
 
-int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maximal(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2) const
+int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maximal(const VertexBuffer & set1, const VertexBuffer & set2) const
 {
     int ret = 0;
 
@@ -1202,7 +1231,7 @@ int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maxima
     return ret;
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const std::vector<VertexBuffer> & buckets, const std::vector<VertexBuffer> & neighbors, std::vector<IndexBuffer> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     long size = static_cast<long>(edge.size());
 
@@ -1219,7 +1248,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
     for (htd::vertex_t neighbor : neighbors[currentBucket])
     {
-        const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
+        const VertexBuffer & neighborBucketContent = buckets[neighbor];
 
         auto end = neighborBucketContent.end();
 
@@ -1247,7 +1276,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
         {
             if (neighbor != lastBucket && lastAssignedEdge[neighbor] != edgeIndex)
             {
-                const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
+                const VertexBuffer & neighborBucketContent = buckets[neighbor];
 
                 auto end = neighborBucketContent.end();
 
@@ -1262,7 +1291,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
     }
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t startBucket, const std::vector<VertexBuffer> & buckets, const std::vector<VertexBuffer> & neighbors, std::vector<IndexBuffer> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     htd::vertex_t currentBucket = startBucket;
 
@@ -1272,7 +1301,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
     for (htd::vertex_t neighbor : neighbors[currentBucket])
     {
-        const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
+        const VertexBuffer & neighborBucketContent = buckets[neighbor];
 
         auto end = neighborBucketContent.end();
 
@@ -1305,7 +1334,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
         {
             if (neighbor != lastBucket && lastAssignedEdge[neighbor] != edgeIndex)
             {
-                const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
+                const VertexBuffer & neighborBucketContent = buckets[neighbor];
 
                 auto end = neighborBucketContent.end();
 
@@ -1328,11 +1357,11 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::updateDecomposition(const htd::IMultiHypergraph & graph,
                                                                                             htd::IMutableGraphDecomposition & decomposition,
                                                                                             htd::vertex_t startingVertex,
-                                                                                            const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                                                                                            std::vector<std::vector<htd::vertex_t>> & bagContent,
-                                                                                            std::vector<std::vector<htd::index_t>> & inducedEdges,
-                                                                                            std::unordered_set<htd::vertex_t> & unvisitedVertices,
-                                                                                            std::unordered_map<htd::vertex_t, htd::vertex_t> & decompositionVertices) const
+                                                                                            const std::vector<VertexBuffer> & neighbors,
+                                                                                            std::vector<VertexBuffer> & bagContent,
+                                                                                            std::vector<IndexBuffer> & inducedEdges,
+                                                                                            VertexSet & unvisitedVertices,
+                                                                                            VertexMap & decompositionVertices) const
 {
     htd::vertex_t currentNode = startingVertex;
 
@@ -1346,7 +1375,12 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::updateDe
         {
             if (currentIndex == 0)
             {
-                htd::vertex_t decompositionVertex = decomposition.addVertex(std::vector<htd::vertex_t>(bagContent[currentNode]), graph.hyperedgesAtPositions(inducedEdges[currentNode]));
+                const VertexBuffer & currentBagContent = bagContent[currentNode];
+
+                const IndexBuffer & currentInducedEdges = inducedEdges[currentNode];
+
+                htd::vertex_t decompositionVertex = decomposition.addVertex(std::vector<htd::vertex_t>(currentBagContent.begin(), currentBagContent.end()),
+                                                                            graph.hyperedgesAtPositions(std::vector<htd::index_t>(currentInducedEdges.begin(), currentInducedEdges.end())));
 
                 decompositionVertices.emplace(currentNode, decompositionVertex);
 
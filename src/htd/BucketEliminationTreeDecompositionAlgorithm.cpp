@@ -243,7 +243,7 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 
         for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
         {
-            for (htd::vertex_t vertex : decomposition->vertices())
+            for (htd::vertex_t vertex : decomposition->vertexVector())
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
@@ -257,7 +257,7 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 
         for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
         {
-            for (htd::vertex_t vertex : decomposition->vertices())
+            for (htd::vertex_t vertex : decomposition->vertexVector())
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
@@ -453,13 +453,9 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
+                            htd::vertex_t vertex1 = component1[htd::randomNumber() % component1.size()];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex2 = component2[htd::randomNumber() % component2.size()];
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -472,9 +468,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(htd::randomNumber() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
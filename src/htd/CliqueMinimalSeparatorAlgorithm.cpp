@@ -118,6 +118,11 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
                 return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
             }
 
+            const std::vector<htd::vertex_t> & vertexVector(void) const HTD_OVERRIDE
+            {
+                return vertices_;
+            }
+
             void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
             {
                 target.insert(target.end(), vertices_.begin(), vertices_.end());
@@ -210,6 +215,13 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
                 target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
             }
 
+            const std::vector<htd::vertex_t> & neighborVector(htd::vertex_t vertex) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return neighborhood_[vertex];
+            }
+
             htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(isVertex(vertex))
@@ -633,7 +645,7 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
 
                             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
 
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
+                            const std::vector<htd::vertex_t> & neighborCollection = graph.neighborVector(vertex);
 
                             auto position2 = neighborCollection.begin();
 
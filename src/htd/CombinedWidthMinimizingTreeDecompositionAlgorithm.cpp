@@ -27,6 +27,7 @@
 
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/IWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/IWidthLimitableTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
@@ -276,7 +277,19 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
         }
         else
         {
-            htd::ITreeDecomposition * currentDecomposition = (*it)->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+            htd::IWidthLimitableTreeDecompositionAlgorithm * widthLimitableTreeDecompositionAlgorithm = dynamic_cast<htd::IWidthLimitableTreeDecompositionAlgorithm *>(*it);
+
+            htd::ITreeDecomposition * currentDecomposition = nullptr;
+
+            if (widthLimitableTreeDecompositionAlgorithm != nullptr && bestMaxBagSize != (std::size_t)-1)
+            {
+                /* Abandon the computation as soon as it is clear that the decomposition cannot improve the best one found so far. */
+                currentDecomposition = widthLimitableTreeDecompositionAlgorithm->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, 1).first;
+            }
+            else
+            {
+                currentDecomposition = (*it)->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+            }
 
             if (currentDecomposition != nullptr)
             {
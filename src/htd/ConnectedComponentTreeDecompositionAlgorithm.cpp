@@ -0,0 +1,862 @@
+/* 
+ * File:   ConnectedComponentTreeDecompositionAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP
+#define HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+
+#include <htd/ConnectedComponentTreeDecompositionAlgorithm.hpp>
+#include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/IConnectedComponentAlgorithm.hpp>
+#include <htd/TreeDecompositionAlgorithmFactory.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+#include <htd/GraphLabeling.hpp>
+#include <htd/ILabelingFunction.hpp>
+#include <htd/IMutableTreeDecomposition.hpp>
+#include <htd/ITreeDecompositionManipulationOperation.hpp>
+#include <htd/MultiHypergraph.hpp>
+#include <htd/PreprocessedGraph.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <memory>
+#include <numeric>
+#include <stack>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ConnectedComponentTreeDecompositionAlgorithm.
+ */
+struct htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager      The management instance to which the current object instance belongs.
+     *  @param[in] algorithm    The decomposition algorithm which will be used to decompose each of the connected components.
+     */
+    Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm) : managementInstance_(manager), algorithm_(algorithm), labelingFunctions_(), postProcessingOperations_(), threadCount_(1)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), labelingFunctions_(), postProcessingOperations_(), threadCount_(original.threadCount_)
+    {
+        for (htd::ILabelingFunction * labelingFunction : original.labelingFunctions_)
+        {
+    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            labelingFunctions_.push_back(labelingFunction->clone());
+    #else
+            labelingFunctions_.push_back(labelingFunction->cloneLabelingFunction());
+    #endif
+        }
+
+        for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : original.postProcessingOperations_)
+        {
+    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            postProcessingOperations_.push_back(postProcessingOperation->clone());
+    #else
+            postProcessingOperations_.push_back(postProcessingOperation->cloneTreeDecompositionManipulationOperation());
+    #endif
+        }
+    }
+
+    virtual ~Implementation()
+    {
+        delete algorithm_;
+
+        for (auto & labelingFunction : labelingFunctions_)
+        {
+            delete labelingFunction;
+        }
+
+        for (auto & postProcessingOperation : postProcessingOperations_)
+        {
+            delete postProcessingOperation;
+        }
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The decomposition algorithm which is used to decompose each of the connected components.
+     */
+    htd::ITreeDecompositionAlgorithm * algorithm_;
+
+    /**
+     *  The labeling functions which are applied after the decomposition was computed.
+     */
+    std::vector<htd::ILabelingFunction *> labelingFunctions_;
+
+    /**
+     *  The manipuation operations which are applied after the decomposition was computed.
+     */
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
+
+    /**
+     *  The number of worker threads which decompose the connected components concurrently (0=one per hardware thread).
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Compute a new mutable tree decompostion of the given graph.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format or nullptr if it is not available.
+     *
+     *  @return A mutable tree decompostion of the given graph or nullptr if the algorithm was terminated.
+     */
+    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph * preprocessedGraph) const;
+
+    /**
+     *  Decompose the subgraph induced by a connected component of the input graph.
+     *
+     *  @param[in] algorithm    The decomposition algorithm which shall be used.
+     *  @param[in] vertexCount  The number of vertices of the connected component.
+     *  @param[in] hyperedges   The hyperedges of the connected component, the vertices of the component are identified by their position (starting at 1).
+     *  @param[in] preprocessedGraph    The connected component in preprocessed format or nullptr if it is not available.
+     *  @param[out] edgeIds     The identifiers of the hyperedges within the decomposed subgraph in the order in which they were provided.
+     *
+     *  @return A tree decomposition of the subgraph induced by the given connected component or nullptr if the algorithm was terminated.
+     */
+    htd::ITreeDecomposition * decomposeComponent(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                 std::size_t vertexCount,
+                                                 const std::vector<std::vector<htd::vertex_t>> & hyperedges,
+                                                 const htd::IPreprocessedGraph * preprocessedGraph,
+                                                 std::vector<htd::id_t> & edgeIds) const;
+
+    /**
+     *  Split the preprocessed input graph into one preprocessed graph per connected component.
+     *
+     *  The vertices of each part are named by their position within the connected component (starting at 1), so
+     *  that each part matches the subgraph decomposed by decomposeComponent(). The partial elimination ordering is
+     *  distributed to the parts. The lower bound for the treewidth of the input graph does not carry over to the
+     *  individual components, hence each part reports a lower bound of zero.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] components           The connected components of the input graph, each sorted in ascending order.
+     *  @param[in] componentIndices     The index of the connected component of each vertex of the input graph.
+     *  @param[in] componentHyperedges  The hyperedges of each connected component.
+     *  @param[out] target              The vector to which the preprocessed graph of each connected component shall be appended.
+     */
+    static void splitPreprocessedGraph(const htd::IPreprocessedGraph & preprocessedGraph,
+                                       const std::vector<std::vector<htd::vertex_t>> & components,
+                                       const std::vector<htd::index_t> & componentIndices,
+                                       const std::vector<std::vector<std::vector<htd::vertex_t>>> & componentHyperedges,
+                                       std::vector<std::unique_ptr<htd::IPreprocessedGraph>> & target);
+
+    /**
+     *  Copy the given decomposition of a connected component into the joined decomposition.
+     *
+     *  @param[in] graph            The input graph.
+     *  @param[in] component        The vertices of the connected component, sorted in ascending order.
+     *  @param[in] edgePositions    The positions of the hyperedges of the connected component within the input graph.
+     *  @param[in] edgeIds          The identifiers of the hyperedges within the decomposed subgraph.
+     *  @param[in] decomposition    The decomposition of the connected component.
+     *  @param[in] target           The joined decomposition.
+     */
+    void appendDecomposition(const htd::IMultiHypergraph & graph,
+                             const std::vector<htd::vertex_t> & component,
+                             const std::vector<htd::index_t> & edgePositions,
+                             const std::vector<htd::id_t> & edgeIds,
+                             const htd::ITreeDecomposition & decomposition,
+                             htd::IMutableTreeDecomposition & target) const;
+};
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager, manager->treeDecompositionAlgorithmFactory().createInstance()))
+{
+
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm) : implementation_(new Implementation(manager, algorithm))
+{
+    HTD_ASSERT(algorithm != nullptr)
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) : implementation_(new Implementation(manager, algorithm))
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    setManipulationOperations(manipulationOperations);
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::ConnectedComponentTreeDecompositionAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::~ConnectedComponentTreeDecompositionAlgorithm()
+{
+
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph, nullptr);
+
+    if (ret != nullptr)
+    {
+        std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+        std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(operation);
+
+            if (labelingFunction != nullptr)
+            {
+                labelingFunctions.push_back(labelingFunction);
+            }
+
+            htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(operation);
+
+            if (manipulationOperation != nullptr)
+            {
+                postProcessingOperations.push_back(manipulationOperation);
+            }
+        }
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
+        {
+            operation->apply(graph, *ret);
+        }
+
+        for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+        {
+            operation->apply(graph, *ret);
+        }
+
+        for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+        {
+            for (htd::vertex_t vertex : ret->vertexVector())
+            {
+                htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+
+        for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+        {
+            for (htd::vertex_t vertex : ret->vertexVector())
+            {
+                htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph, &preprocessedGraph);
+
+    if (ret != nullptr)
+    {
+        std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+        std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(operation);
+
+            if (labelingFunction != nullptr)
+            {
+                labelingFunctions.push_back(labelingFunction);
+            }
+
+            htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(operation);
+
+            if (manipulationOperation != nullptr)
+            {
+                postProcessingOperations.push_back(manipulationOperation);
+            }
+        }
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
+        {
+            operation->apply(graph, *ret);
+        }
+
+        for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+        {
+            operation->apply(graph, *ret);
+        }
+
+        for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+        {
+            for (htd::vertex_t vertex : ret->vertexVector())
+            {
+                htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+
+        for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+        {
+            for (htd::vertex_t vertex : ret->vertexVector())
+            {
+                htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+}
+
+std::size_t htd::ConnectedComponentTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (auto & labelingFunction : implementation_->labelingFunctions_)
+    {
+        delete labelingFunction;
+    }
+
+    for (auto & postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        delete postProcessingOperation;
+    }
+
+    implementation_->labelingFunctions_.clear();
+
+    implementation_->postProcessingOperations_.clear();
+
+    addManipulationOperations(manipulationOperations);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation)
+{
+    bool assigned = false;
+
+    htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(manipulationOperation);
+
+    if (labelingFunction != nullptr)
+    {
+        implementation_->labelingFunctions_.emplace_back(labelingFunction);
+
+        assigned = true;
+    }
+
+    htd::ITreeDecompositionManipulationOperation * newManipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(manipulationOperation);
+
+    if (newManipulationOperation != nullptr)
+    {
+        implementation_->postProcessingOperations_.emplace_back(newManipulationOperation);
+
+        assigned = true;
+    }
+
+    if (!assigned)
+    {
+        delete manipulationOperation;
+    }
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        addManipulationOperation(operation);
+    }
+}
+
+bool htd::ConnectedComponentTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
+{
+    return false;
+}
+
+const htd::LibraryInstance * htd::ConnectedComponentTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+bool htd::ConnectedComponentTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
+{
+    return implementation_->algorithm_->isComputeInducedEdgesEnabled();
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled)
+{
+    implementation_->algorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm * htd::ConnectedComponentTreeDecompositionAlgorithm::clone(void) const
+{
+    return new htd::ConnectedComponentTreeDecompositionAlgorithm(*this);
+}
+
+htd::IMutableTreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph * preprocessedGraph) const
+{
+    std::vector<std::vector<htd::vertex_t>> components;
+
+    std::unique_ptr<htd::IConnectedComponentAlgorithm> connectedComponentAlgorithm(managementInstance_->connectedComponentAlgorithmFactory().createInstance());
+
+    connectedComponentAlgorithm->determineComponents(graph, components);
+
+    if (components.size() <= 1)
+    {
+        htd::ITreeDecomposition * decomposition = preprocessedGraph != nullptr ? algorithm_->computeDecomposition(graph, *preprocessedGraph) : algorithm_->computeDecomposition(graph);
+
+        if (decomposition == nullptr || managementInstance_->isTerminated())
+        {
+            delete decomposition;
+
+            return nullptr;
+        }
+
+        return &(managementInstance_->treeDecompositionFactory().accessMutableInstance(*decomposition));
+    }
+
+    std::vector<htd::index_t> componentIndices(graph.vertexAtPosition(graph.vertexCount() - 1) + 1, 0);
+
+    for (htd::index_t index = 0; index < components.size(); ++index)
+    {
+        std::vector<htd::vertex_t> & component = components[index];
+
+        std::sort(component.begin(), component.end());
+
+        for (htd::vertex_t vertex : component)
+        {
+            componentIndices[vertex] = index;
+        }
+    }
+
+    /* The hyperedges are distributed to the components up-front, so the worker threads never access the input graph. */
+    std::vector<std::vector<std::vector<htd::vertex_t>>> componentHyperedges(components.size());
+
+    std::vector<std::vector<htd::index_t>> componentEdgePositions(components.size());
+
+    htd::index_t position = 0;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        if (!hyperedge.empty())
+        {
+            htd::index_t componentIndex = componentIndices[hyperedge.elements()[0]];
+
+            const std::vector<htd::vertex_t> & component = components[componentIndex];
+
+            std::vector<htd::vertex_t> elements;
+
+            elements.reserve(hyperedge.elements().size());
+
+            for (htd::vertex_t vertex : hyperedge.elements())
+            {
+                elements.push_back(static_cast<htd::vertex_t>(std::lower_bound(component.begin(), component.end(), vertex) - component.begin()) + 1);
+            }
+
+            componentHyperedges[componentIndex].push_back(std::move(elements));
+
+            componentEdgePositions[componentIndex].push_back(position);
+        }
+
+        ++position;
+    }
+
+    /* The preprocessing of the input graph is re-used by splitting it along the connected components instead of preprocessing each component again. */
+    std::vector<std::unique_ptr<htd::IPreprocessedGraph>> componentPreprocessedGraphs;
+
+    if (preprocessedGraph != nullptr)
+    {
+        splitPreprocessedGraph(*preprocessedGraph, components, componentIndices, componentHyperedges, componentPreprocessedGraphs);
+    }
+
+    std::vector<htd::index_t> schedule(components.size());
+
+    std::iota(schedule.begin(), schedule.end(), 0);
+
+    std::stable_sort(schedule.begin(), schedule.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return components[index1].size() > components[index2].size();
+    });
+
+    std::vector<std::unique_ptr<htd::ITreeDecomposition>> decompositions(components.size());
+
+    std::vector<std::vector<htd::id_t>> componentEdgeIds(components.size());
+
+    std::size_t threadCount = threadCount_;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), (std::size_t)1);
+    }
+
+    threadCount = std::min(threadCount, components.size());
+
+    if (threadCount > 1)
+    {
+        /* The seeds are drawn up-front so that the result for each component does not depend on the scheduling of the worker threads. */
+        std::vector<unsigned int> seeds;
+
+        seeds.reserve(components.size());
+
+        for (htd::index_t index = 0; index < components.size(); ++index)
+        {
+            seeds.push_back(static_cast<unsigned int>(htd::randomNumber()));
+        }
+
+        std::atomic<htd::index_t> nextComponent(0);
+
+        auto worker = [&](void)
+        {
+            std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+            for (htd::index_t index = nextComponent++; index < schedule.size() && !managementInstance_->isTerminated(); index = nextComponent++)
+            {
+                htd::index_t componentIndex = schedule[index];
+
+                htd::seedThreadLocalRandomNumberGenerator(seeds[componentIndex]);
+
+                decompositions[componentIndex].reset(decomposeComponent(*algorithm, components[componentIndex].size(), componentHyperedges[componentIndex], componentPreprocessedGraphs.empty() ? nullptr : componentPreprocessedGraphs[componentIndex].get(), componentEdgeIds[componentIndex]));
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(threadCount);
+
+        for (htd::index_t index = 0; index < threadCount; ++index)
+        {
+            workers.emplace_back(worker);
+        }
+
+        for (std::thread & currentWorker : workers)
+        {
+            currentWorker.join();
+        }
+    }
+    else
+    {
+        for (htd::index_t index = 0; index < schedule.size() && !managementInstance_->isTerminated(); ++index)
+        {
+            htd::index_t componentIndex = schedule[index];
+
+            decompositions[componentIndex].reset(decomposeComponent(*algorithm_, components[componentIndex].size(), componentHyperedges[componentIndex], componentPreprocessedGraphs.empty() ? nullptr : componentPreprocessedGraphs[componentIndex].get(), componentEdgeIds[componentIndex]));
+        }
+    }
+
+    if (managementInstance_->isTerminated() || std::any_of(decompositions.begin(), decompositions.end(), [](const std::unique_ptr<htd::ITreeDecomposition> & decomposition) { return decomposition == nullptr; }))
+    {
+        return nullptr;
+    }
+
+    htd::IMutableTreeDecomposition * ret = managementInstance_->treeDecompositionFactory().createInstance();
+
+    for (htd::index_t index = 0; index < components.size(); ++index)
+    {
+        appendDecomposition(graph, components[index], componentEdgePositions[index], componentEdgeIds[index], *(decompositions[index]), *ret);
+
+        decompositions[index].reset();
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::decomposeComponent(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                                                                                std::size_t vertexCount,
+                                                                                                                const std::vector<std::vector<htd::vertex_t>> & hyperedges,
+                                                                                                                const htd::IPreprocessedGraph * preprocessedGraph,
+                                                                                                                std::vector<htd::id_t> & edgeIds) const
+{
+    htd::MultiHypergraph subgraph(managementInstance_, vertexCount);
+
+    std::vector<htd::vertex_t> elements;
+
+    std::vector<htd::index_t> offsets(1, 0);
+
+    offsets.reserve(hyperedges.size() + 1);
+
+    for (const std::vector<htd::vertex_t> & hyperedge : hyperedges)
+    {
+        elements.insert(elements.end(), hyperedge.begin(), hyperedge.end());
+
+        offsets.push_back(elements.size());
+    }
+
+    htd::id_t firstEdgeId = subgraph.addEdges(elements, offsets);
+
+    edgeIds.reserve(hyperedges.size());
+
+    for (htd::index_t index = 0; index < hyperedges.size(); ++index)
+    {
+        edgeIds.push_back(firstEdgeId + index);
+    }
+
+    return preprocessedGraph != nullptr ? algorithm.computeDecomposition(subgraph, *preprocessedGraph) : algorithm.computeDecomposition(subgraph);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::splitPreprocessedGraph(const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                               const std::vector<std::vector<htd::vertex_t>> & components,
+                                                                                               const std::vector<htd::index_t> & componentIndices,
+                                                                                               const std::vector<std::vector<std::vector<htd::vertex_t>>> & componentHyperedges,
+                                                                                               std::vector<std::unique_ptr<htd::IPreprocessedGraph>> & target)
+{
+    std::size_t componentCount = components.size();
+
+    std::vector<htd::vertex_t> localIds(componentIndices.size(), 0);
+
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        htd::vertex_t localId = 1;
+
+        for (htd::vertex_t vertex : component)
+        {
+            localIds[vertex] = localId++;
+        }
+    }
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> neighborhoods(componentCount);
+
+    std::vector<std::vector<htd::vertex_t>> eliminationSequences(componentCount);
+
+    std::vector<std::vector<htd::vertex_t>> remainingVertices(componentCount);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        neighborhoods[index].resize(components[index].size());
+    }
+
+    const htd::CompressedNeighborhood & neighborhood = preprocessedGraph.compressedNeighborhood();
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        htd::vertex_t vertexName = preprocessedGraph.vertexName(vertex);
+
+        htd::index_t componentIndex = componentIndices[vertexName];
+
+        htd::vertex_t localVertex = localIds[vertexName] - 1;
+
+        std::vector<htd::vertex_t> & localNeighborhood = neighborhoods[componentIndex][localVertex];
+
+        localNeighborhood.reserve(neighborhood.neighborCount(vertex));
+
+        for (auto it = neighborhood.begin(vertex); it != neighborhood.end(vertex); ++it)
+        {
+            localNeighborhood.push_back(localIds[preprocessedGraph.vertexName(*it)] - 1);
+        }
+
+        std::sort(localNeighborhood.begin(), localNeighborhood.end());
+
+        remainingVertices[componentIndex].push_back(localVertex);
+    }
+
+    for (htd::vertex_t vertex : preprocessedGraph.eliminationSequence())
+    {
+        eliminationSequences[componentIndices[vertex]].push_back(localIds[vertex]);
+    }
+
+    target.reserve(target.size() + componentCount);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        std::vector<htd::vertex_t> vertexNames(components[index].size());
+
+        std::iota(vertexNames.begin(), vertexNames.end(), 1);
+
+        std::sort(remainingVertices[index].begin(), remainingVertices[index].end());
+
+        target.emplace_back(new htd::PreprocessedGraph(std::move(vertexNames),
+                                                       std::move(neighborhoods[index]),
+                                                       std::move(eliminationSequences[index]),
+                                                       std::move(remainingVertices[index]),
+                                                       componentHyperedges[index].size(),
+                                                       0));
+    }
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::appendDecomposition(const htd::IMultiHypergraph & graph,
+                                                                                            const std::vector<htd::vertex_t> & component,
+                                                                                            const std::vector<htd::index_t> & edgePositions,
+                                                                                            const std::vector<htd::id_t> & edgeIds,
+                                                                                            const htd::ITreeDecomposition & decomposition,
+                                                                                            htd::IMutableTreeDecomposition & target) const
+{
+    auto translateBag = [&](htd::vertex_t node)
+    {
+        std::vector<htd::vertex_t> ret;
+
+        ret.reserve(decomposition.bagSize(node));
+
+        /* The vertices of the component are numbered in ascending order, hence the translated bag remains sorted. */
+        for (htd::vertex_t vertex : decomposition.bagContent(node))
+        {
+            ret.push_back(component[vertex - 1]);
+        }
+
+        return ret;
+    };
+
+    auto translateInducedEdges = [&](htd::vertex_t node)
+    {
+        std::vector<htd::index_t> positions;
+
+        for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+        {
+            /* Because the identifiers are assigned in ascending order, std::lower_bound always finds the identifier of 'hyperedge'. */
+            positions.push_back(edgePositions[std::lower_bound(edgeIds.begin(), edgeIds.end(), hyperedge.id()) - edgeIds.begin()]);
+        }
+
+        return graph.hyperedgesAtPositions(std::move(positions));
+    };
+
+    htd::vertex_t root = decomposition.root();
+
+    htd::vertex_t newRoot = htd::Vertex::UNKNOWN;
+
+    if (target.vertexCount() == 0)
+    {
+        newRoot = target.insertRoot(translateBag(root), translateInducedEdges(root));
+    }
+    else
+    {
+        newRoot = target.addChild(target.root(), translateBag(root), translateInducedEdges(root));
+    }
+
+    std::stack<std::pair<htd::vertex_t, htd::vertex_t>> originStack;
+
+    originStack.emplace(root, newRoot);
+
+    while (!originStack.empty())
+    {
+        std::pair<htd::vertex_t, htd::vertex_t> current = originStack.top();
+
+        originStack.pop();
+
+        for (htd::vertex_t child : decomposition.childVector(current.first))
+        {
+            originStack.emplace(child, target.addChild(current.second, translateBag(child), translateInducedEdges(child)));
+        }
+    }
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP */
@@ -99,7 +99,7 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
 
             originDeque.pop_front();
 
-            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
+            const std::vector<htd::vertex_t> & neighborCollection = graph.neighborVector(currentVertex);
 
             auto it = neighborCollection.begin();
 
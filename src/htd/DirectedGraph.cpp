@@ -183,6 +183,11 @@ void htd::DirectedGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::
     base_->copyNeighborsTo(vertex, target);
 }
 
+const std::vector<htd::vertex_t> & htd::DirectedGraph::neighborVector(htd::vertex_t vertex) const
+{
+    return base_->neighborVector(vertex);
+}
+
 htd::vertex_t htd::DirectedGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return base_->neighborAtPosition(vertex, index);
@@ -213,6 +218,11 @@ htd::ConstCollection<htd::vertex_t> htd::DirectedGraph::vertices(void) const
     return base_->vertices();
 }
 
+const std::vector<htd::vertex_t> & htd::DirectedGraph::vertexVector(void) const
+{
+    return base_->vertexVector();
+}
+
 void htd::DirectedGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     base_->copyVerticesTo(target);
@@ -263,6 +273,11 @@ const htd::Hyperedge & htd::DirectedGraph::hyperedgeAtPosition(htd::index_t inde
     return base_->hyperedgeAtPosition(index);
 }
 
+void htd::DirectedGraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    base_->copyHyperedgeElementsTo(index, target);
+}
+
 const htd::Hyperedge & htd::DirectedGraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     return base_->hyperedgeAtPosition(index, vertex);
@@ -282,6 +282,13 @@ void htd::DirectedMultiGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<
     implementation_->base_->copyNeighborsTo(vertex, target);
 }
 
+const std::vector<htd::vertex_t> & htd::DirectedMultiGraph::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->base_->neighborVector(vertex);
+}
+
 htd::vertex_t htd::DirectedMultiGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return implementation_->base_->neighborAtPosition(vertex, index);
@@ -352,6 +359,11 @@ htd::ConstCollection<htd::vertex_t> htd::DirectedMultiGraph::vertices(void) cons
     return implementation_->base_->vertices();
 }
 
+const std::vector<htd::vertex_t> & htd::DirectedMultiGraph::vertexVector(void) const
+{
+    return implementation_->base_->vertexVector();
+}
+
 void htd::DirectedMultiGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     implementation_->base_->copyVerticesTo(target);
@@ -402,6 +414,11 @@ const htd::Hyperedge & htd::DirectedMultiGraph::hyperedgeAtPosition(htd::index_t
     return implementation_->base_->hyperedgeAtPosition(index);
 }
 
+void htd::DirectedMultiGraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    implementation_->base_->copyHyperedgeElementsTo(index, target);
+}
+
 const htd::Hyperedge & htd::DirectedMultiGraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     return implementation_->base_->hyperedgeAtPosition(index, vertex);
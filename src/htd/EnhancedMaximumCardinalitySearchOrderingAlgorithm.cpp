@@ -129,7 +129,7 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
 
             if (!ret)
             {
-                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
+                const std::vector<htd::vertex_t> & neighborCollection = graph.neighborVector(currentVertex);
 
                 auto it = neighborCollection.begin();
 
@@ -257,6 +257,13 @@ void htd::FlowNetworkStructure::copyNeighborsTo(htd::vertex_t vertex, std::vecto
     target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
 }
 
+const std::vector<htd::vertex_t> & htd::FlowNetworkStructure::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborhood_[vertex];
+}
+
 htd::vertex_t htd::FlowNetworkStructure::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -273,6 +280,11 @@ htd::ConstCollection<htd::vertex_t> htd::FlowNetworkStructure::vertices(void) co
     return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
 }
 
+const std::vector<htd::vertex_t> & htd::FlowNetworkStructure::vertexVector(void) const
+{
+    return implementation_->vertices_;
+}
+
 void htd::FlowNetworkStructure::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     target.insert(target.end(), implementation_->vertices_.begin(), implementation_->vertices_.end());
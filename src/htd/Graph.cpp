@@ -163,6 +163,13 @@ void htd::Graph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t
     base_->copyNeighborsTo(vertex, target);
 }
 
+const std::vector<htd::vertex_t> & htd::Graph::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return base_->neighborVector(vertex);
+}
+
 htd::vertex_t htd::Graph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return base_->neighborAtPosition(vertex, index);
@@ -173,6 +180,11 @@ htd::ConstCollection<htd::vertex_t> htd::Graph::vertices(void) const
     return base_->vertices();
 }
 
+const std::vector<htd::vertex_t> & htd::Graph::vertexVector(void) const
+{
+    return base_->vertexVector();
+}
+
 void htd::Graph::copyVerticesTo(std::vector<htd::vertex_t> &target) const
 {
     base_->copyVerticesTo(target);
@@ -223,6 +235,11 @@ const htd::Hyperedge & htd::Graph::hyperedgeAtPosition(htd::index_t index) const
     return base_->hyperedgeAtPosition(index);
 }
 
+void htd::Graph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    base_->copyHyperedgeElementsTo(index, target);
+}
+
 const htd::Hyperedge & htd::Graph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     return base_->hyperedgeAtPosition(index, vertex);
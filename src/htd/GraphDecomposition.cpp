@@ -45,7 +45,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::GraphDecomposition & orig
 
 htd::GraphDecomposition::GraphDecomposition(const htd::IMultiHypergraph & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
 
@@ -55,7 +55,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::IMultiHypergraph & origin
 
 htd::GraphDecomposition::GraphDecomposition(const htd::ILabeledMultiHypergraph & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
 
@@ -65,7 +65,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::ILabeledMultiHypergraph &
 
 htd::GraphDecomposition::GraphDecomposition(const htd::IGraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         bagContent_[vertex] = original.bagContent(vertex);
 
@@ -175,7 +175,7 @@ std::size_t htd::GraphDecomposition::minimumBagSize(void) const
 
     std::size_t ret = 0;
 
-    for (htd::vertex_t vertex : vertices())
+    for (htd::vertex_t vertex : vertexVector())
     {
         std::size_t currentBagSize = bagSize(vertex);
 
@@ -194,7 +194,7 @@ std::size_t htd::GraphDecomposition::maximumBagSize(void) const
 {
     std::size_t ret = 0;
 
-    for (htd::vertex_t vertex : vertices())
+    for (htd::vertex_t vertex : vertexVector())
     {
         std::size_t currentBagSize = bagSize(vertex);
 
@@ -30,8 +30,9 @@
 #include <htd/GraphLabeling.hpp>
 
 #include <stdexcept>
+#include <utility>
 
-htd::GraphLabeling::GraphLabeling(void) : vertexLabels_(), edgeLabels_()
+htd::GraphLabeling::GraphLabeling(void) : vertexLabels_(), edgeLabels_(), vertexLabelCount_(0), edgeLabelCount_(0)
 {
 
 }
@@ -43,190 +44,209 @@ htd::GraphLabeling::~GraphLabeling()
 
 std::size_t htd::GraphLabeling::vertexLabelCount(void) const
 {
-    return vertexLabels_.size();
+    return vertexLabelCount_;
 }
 
 std::size_t htd::GraphLabeling::edgeLabelCount(void) const
 {
-    return edgeLabels_.size();
+    return edgeLabelCount_;
 }
 
 bool htd::GraphLabeling::isLabeledVertex(htd::vertex_t vertex) const
 {
-    return vertexLabels_.find(vertex) != vertexLabels_.end();
+    return find(vertexLabels_, vertex) != nullptr;
 }
 
 bool htd::GraphLabeling::isLabeledEdge(htd::id_t edgeId) const
 {
-    return edgeLabels_.find(edgeId) != edgeLabels_.end();
+    return find(edgeLabels_, edgeId) != nullptr;
 }
 
 const htd::ILabel & htd::GraphLabeling::vertexLabel(htd::vertex_t vertex) const
 {
-    auto label = vertexLabels_.find(vertex);
+    htd::ILabel * label = find(vertexLabels_, vertex);
 
-    HTD_ASSERT(label != vertexLabels_.end())
+    HTD_ASSERT(label != nullptr)
 
-    return *(label->second);
+    return *label;
 }
 
 const htd::ILabel & htd::GraphLabeling::edgeLabel(htd::id_t edgeId) const
 {
-    auto label = edgeLabels_.find(edgeId);
+    htd::ILabel * label = find(edgeLabels_, edgeId);
 
-    HTD_ASSERT(label != edgeLabels_.end())
+    HTD_ASSERT(label != nullptr)
 
-    return *(label->second);
+    return *label;
 }
 
 void htd::GraphLabeling::setVertexLabel(htd::vertex_t vertex, htd::ILabel * label)
 {
-    auto position = vertexLabels_.find(vertex);
+    htd::ILabel * & position = slot(vertexLabels_, vertex);
 
-    if (position != vertexLabels_.end())
+    if (position != nullptr)
     {
-        if (!(*(position->second) == *label))
+        if (!(*position == *label))
         {
-            delete position->second;
+            delete position;
         }
     }
+    else
+    {
+        ++vertexLabelCount_;
+    }
 
-    vertexLabels_[vertex] = label;
+    position = label;
 }
 
 void htd::GraphLabeling::setEdgeLabel(htd::id_t edgeId, htd::ILabel * label)
 {
-    auto position = edgeLabels_.find(edgeId);
+    htd::ILabel * & position = slot(edgeLabels_, edgeId);
 
-    if (position != edgeLabels_.end())
+    if (position != nullptr)
     {
-        if (!(*(position->second) == *label))
+        if (!(*position == *label))
         {
-            delete position->second;
+            delete position;
         }
     }
+    else
+    {
+        ++edgeLabelCount_;
+    }
 
-    edgeLabels_[edgeId] = label;
+    position = label;
 }
 
 void htd::GraphLabeling::swapVertexLabels(htd::vertex_t vertex1, htd::vertex_t vertex2)
 {
-    auto position1 = vertexLabels_.find(vertex1);
-    auto position2 = vertexLabels_.find(vertex2);
-
-    HTD_ASSERT(position1 != vertexLabels_.end())
-    HTD_ASSERT(position2 != vertexLabels_.end())
+    HTD_ASSERT(isLabeledVertex(vertex1))
+    HTD_ASSERT(isLabeledVertex(vertex2))
 
-    htd::ILabel * label1 = position1->second;
-
-    position1->second = position2->second;
-
-    position2->second = label1;
+    std::swap(vertexLabels_[vertex1], vertexLabels_[vertex2]);
 }
 
 void htd::GraphLabeling::swapEdgeLabels(htd::id_t edgeId1, htd::id_t edgeId2)
 {
-    auto position1 = edgeLabels_.find(edgeId1);
-    auto position2 = edgeLabels_.find(edgeId2);
-
-    HTD_ASSERT(position1 != edgeLabels_.end())
-    HTD_ASSERT(position2 != edgeLabels_.end())
-
-    htd::ILabel * label1 = position1->second;
+    HTD_ASSERT(isLabeledEdge(edgeId1))
+    HTD_ASSERT(isLabeledEdge(edgeId2))
 
-    position1->second = position2->second;
-
-    position2->second = label1;
+    std::swap(edgeLabels_[edgeId1], edgeLabels_[edgeId2]);
 }
 
 htd::ILabel * htd::GraphLabeling::transferVertexLabel(htd::vertex_t vertex)
 {
-    auto position = vertexLabels_.find(vertex);
+    HTD_ASSERT(isLabeledVertex(vertex))
 
-    HTD_ASSERT(position != vertexLabels_.end())
+    htd::ILabel * ret = vertexLabels_[vertex];
 
-    htd::ILabel * ret = position->second;
+    vertexLabels_[vertex] = nullptr;
 
-    vertexLabels_.erase(vertex);
+    --vertexLabelCount_;
 
     return ret;
 }
 
 htd::ILabel * htd::GraphLabeling::transferEdgeLabel(htd::id_t edgeId)
 {
-    auto position = edgeLabels_.find(edgeId);
+    HTD_ASSERT(isLabeledEdge(edgeId))
 
-    HTD_ASSERT(position != edgeLabels_.end())
+    htd::ILabel * ret = edgeLabels_[edgeId];
 
-    htd::ILabel * ret = position->second;
+    edgeLabels_[edgeId] = nullptr;
 
-    edgeLabels_.erase(edgeId);
+    --edgeLabelCount_;
 
     return ret;
 }
 
 void htd::GraphLabeling::removeVertexLabel(htd::vertex_t vertex)
 {
-    auto position = vertexLabels_.find(vertex);
-
-    if (position != vertexLabels_.end())
+    if (isLabeledVertex(vertex))
     {
-        delete position->second;
+        delete vertexLabels_[vertex];
+
+        vertexLabels_[vertex] = nullptr;
 
-        vertexLabels_.erase(position);
+        --vertexLabelCount_;
     }
 }
 
 void htd::GraphLabeling::removeEdgeLabel(htd::id_t edgeId)
 {
-    auto position = edgeLabels_.find(edgeId);
-
-    if (position != edgeLabels_.end())
+    if (isLabeledEdge(edgeId))
     {
-        delete position->second;
+        delete edgeLabels_[edgeId];
+
+        edgeLabels_[edgeId] = nullptr;
 
-        edgeLabels_.erase(position);
+        --edgeLabelCount_;
     }
 }
 
 void htd::GraphLabeling::clear(void)
 {
-    for (auto & label : vertexLabels_)
+    for (htd::ILabel * label : vertexLabels_)
     {
-        if (label.second != nullptr)
-        {
-            delete label.second;
-        }
+        delete label;
     }
 
-    for (auto & label : edgeLabels_)
+    for (htd::ILabel * label : edgeLabels_)
     {
-        if (label.second != nullptr)
-        {
-            delete label.second;
-        }
+        delete label;
     }
 
     vertexLabels_.clear();
 
     edgeLabels_.clear();
+
+    vertexLabelCount_ = 0;
+
+    edgeLabelCount_ = 0;
 }
 
 htd::GraphLabeling * htd::GraphLabeling::clone(void) const
 {
     GraphLabeling * ret = new GraphLabeling();
 
-    for (auto label : vertexLabels_)
+    ret->vertexLabels_.resize(vertexLabels_.size(), nullptr);
+    ret->edgeLabels_.resize(edgeLabels_.size(), nullptr);
+
+    for (htd::index_t index = 0; index < vertexLabels_.size(); ++index)
     {
-        ret->setVertexLabel(label.first, label.second->clone());
+        if (vertexLabels_[index] != nullptr)
+        {
+            ret->vertexLabels_[index] = vertexLabels_[index]->clone();
+        }
     }
 
-    for (auto label : edgeLabels_)
+    for (htd::index_t index = 0; index < edgeLabels_.size(); ++index)
     {
-        ret->setEdgeLabel(label.first, label.second->clone());
+        if (edgeLabels_[index] != nullptr)
+        {
+            ret->edgeLabels_[index] = edgeLabels_[index]->clone();
+        }
     }
 
+    ret->vertexLabelCount_ = vertexLabelCount_;
+    ret->edgeLabelCount_ = edgeLabelCount_;
+
     return ret;
 }
 
+htd::ILabel * & htd::GraphLabeling::slot(std::vector<htd::ILabel *> & labels, htd::id_t id)
+{
+    if (id >= labels.size())
+    {
+        labels.resize(id + 1, nullptr);
+    }
+
+    return labels[id];
+}
+
+htd::ILabel * htd::GraphLabeling::find(const std::vector<htd::ILabel *> & labels, htd::id_t id)
+{
+    return id < labels.size() ? labels[id] : nullptr;
+}
+
 #endif /* HTD_HTD_GRAPHLABELING_CPP */
@@ -33,310 +33,15 @@
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
-#include <htd/ConnectedComponentAlgorithmFactory.hpp>
-#include <htd/IConnectedComponentAlgorithm.hpp>
-#include <htd/VectorAdapter.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
+#include <htd/MultiHypergraph.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <numeric>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
-
-namespace htd
-{
-    /**
-     *  This class is designed to hold the information of a connected component of a preprocessed graph.
-     */
-    class PreprocessedGraphComponent : public htd::IPreprocessedGraph
-    {
-        public:
-            /**
-             *  Constructor for a new, preprocessed graph component data structure.
-             *
-             *  @param[in] preprocessedGraph    The base graph containing the component represented by the new graph component data structure.
-             *  @param[in] remainingVertices    The set of vertices which were not eliminated during the preprocessing phase.
-             *  @param[in] minTreeWidth         The lower bound for the treewidth of the preprocessed graph component.
-             */
-            PreprocessedGraphComponent(const htd::IPreprocessedGraph & preprocessedGraph,
-                                       std::vector<htd::vertex_t> && remainingVertices,
-                                       std::size_t minTreeWidth) : baseGraph_(preprocessedGraph), remainingVertices_(std::move(remainingVertices)), eliminationSequence_(), minTreeWidth_(minTreeWidth), edgeCount_(0)
-            {
-                updateEdgeCount();
-            }
-
-            /**
-             *  Copy constructor for a preprocessed graph component data structure.
-             *
-             *  @param[in] original  The original preprocessed graph component data structure.
-             */
-            PreprocessedGraphComponent(const htd::PreprocessedGraphComponent & original) : baseGraph_(original.baseGraph_), remainingVertices_(original.remainingVertices_), eliminationSequence_(original.eliminationSequence_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_)
-            {
-
-            }
-
-            /**
-             *  Destructor for a preprocessed graph component data structure.
-             */
-            virtual ~PreprocessedGraphComponent()
-            {
-
-            }
-
-            std::size_t vertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return remainingVertices_.size();
-            }
-
-            std::size_t inputGraphVertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.inputGraphVertexCount();
-            }
-
-            std::size_t edgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return edgeCount_;
-            }
-
-            std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return neighborCount(vertex);
-            }
-
-            std::size_t inputGraphEdgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.inputGraphEdgeCount();
-            }
-
-            htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE
-            {
-                return htd::ConstCollection<htd::vertex_t>::getInstance(remainingVertices_);
-            }
-
-            void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                target.insert(target.end(), remainingVertices_.begin(), remainingVertices_.end());
-            }
-
-            htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(index < remainingVertices_.size())
-
-                return remainingVertices_[index];
-            }
-
-            bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return std::binary_search(remainingVertices_.begin(),
-                                          remainingVertices_.end(),
-                                          vertex);
-            }
-
-            std::size_t isolatedVertexCount(void) const HTD_OVERRIDE
-            {
-                std::size_t ret = 0;
-
-                for (htd::vertex_t vertex : remainingVertices_)
-                {
-                    if (baseGraph_.neighborhood(vertex).empty())
-                    {
-                        ret++;
-                    }
-                }
-
-                return ret;
-            }
-
-            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE
-            {
-                htd::VectorAdapter<htd::vertex_t> ret;
-
-                auto & result = ret.container();
-
-                for (htd::vertex_t vertex : remainingVertices_)
-                {
-                    if (baseGraph_.neighborhood(vertex).empty())
-                    {
-                        result.push_back(vertex);
-                    }
-                }
-
-                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
-            }
-
-            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
-
-                HTD_ASSERT(index < isolatedVertexCollection.size())
-
-                htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
-
-                std::advance(it, index);
-
-                return *it;
-            }
-
-            bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.isIsolatedVertex(vertex);
-            }
-
-            std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighborCount(vertex);
-            }
-
-            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighbors(vertex);
-            }
-
-            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                baseGraph_.copyNeighborsTo(vertex, target);
-            }
-
-            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighborAtPosition(vertex, index);
-            }
-
-            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
-
-                return baseGraph_.isNeighbor(vertex, neighbor);
-            }
-
-            bool isConnected(void) const HTD_OVERRIDE
-            {
-                return true;
-            }
-
-            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE
-            {
-                HTD_UNUSED(vertex1)
-                HTD_UNUSED(vertex2)
-
-                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
-
-                return true;
-            }
-
-            const std::vector<htd::vertex_t> & vertexNames(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.vertexNames();
-            }
-
-            htd::vertex_t vertexName(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.vertexName(vertex);
-            }
-
-            const std::vector<std::vector<htd::vertex_t>> & neighborhood(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.neighborhood();
-            }
-
-            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighborhood(vertex);
-            }
-
-            const std::vector<htd::vertex_t> & eliminationSequence(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return eliminationSequence_;
-            }
-
-            const std::vector<htd::vertex_t> & remainingVertices(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return remainingVertices_;
-            }
-
-            std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return minTreeWidth_;
-            }
-
-    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            PreprocessedGraphComponent * clone(void) const HTD_OVERRIDE
-            {
-                return new htd::PreprocessedGraphComponent(*this);
-            }
-    #else
-            /**
-             *  Create a deep copy of the current preprocessed graph component.
-             *
-             *  @return A new PreprocessedGraphComponent object identical to the current preprocessed graph component.
-             */
-            PreprocessedGraphComponent * clone(void) const
-            {
-                return new htd::PreprocessedGraphComponent(*this);
-            }
-
-            htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE
-            {
-                return clone();
-            }
-    #endif
-
-        private:
-            /**
-             *  The base graph containing the component represented by this graph component data structure.
-             */
-            const htd::IPreprocessedGraph & baseGraph_;
-
-            /**
-             *  The set of vertices which were not eliminated during the preprocessing phase.
-             */
-            std::vector<htd::vertex_t> remainingVertices_;
-
-            /**
-             *  A partial vertex elimination ordering computed during the preprocessing phase.
-             */
-            std::vector<htd::vertex_t> eliminationSequence_;
-
-            /**
-             *  The lower bound of the treewidth of the input graph.
-             */
-            std::size_t minTreeWidth_;
-
-            /**
-             *  The number of edges in the preprocessed graph.
-             */
-            std::size_t edgeCount_;
-
-            /**
-             *  Recompute the number of edges in the graph to update the result of the function edgeCount().
-             */
-            void updateEdgeCount(void)
-            {
-                edgeCount_ = 0;
-
-                for (htd::vertex_t vertex : remainingVertices_)
-                {
-                    edgeCount_ += baseGraph_.neighborhood(vertex).size();
-                }
-
-                edgeCount_ = edgeCount_ >> 1;
-            }
-    };
-}
 
 /**
  *  Private implementation details of class htd::GraphPreprocessor.
@@ -353,8 +58,10 @@ struct htd::GraphPreprocessor::Implementation
                                                                  applyPreprocessing2_(false),
                                                                  applyPreprocessing3_(false),
                                                                  applyPreprocessing4_(false),
+                                                                 applyPreprocessing5_(false),
                                                                  iterationCount_(1),
                                                                  nonImprovementLimit_(0),
+                                                                 threadCount_(1),
                                                                  orderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager))
     {
 
@@ -399,6 +106,14 @@ struct htd::GraphPreprocessor::Implementation
      */
     bool applyPreprocessing4_;
 
+    /**
+     *  A boolean flag indicating whether the
+     *  remaining graph shall be split at safe
+     *  separators, i.e., at articulation points
+     *  and at clique minimal separators.
+     */
+    bool applyPreprocessing5_;
+
     /**
      *  The number of iterations of the base ordering algorithm which shall be performed for each component.
      */
@@ -409,6 +124,18 @@ struct htd::GraphPreprocessor::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of worker threads which decompose the parts split off at safe separators concurrently (0=one per hardware thread).
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The maximum number of remaining vertices for which clique minimal separators are searched.
+     *
+     *  The search is based on MCS-M and requires quadratic time, articulation points are always considered.
+     */
+    static const std::size_t CLIQUE_SEPARATOR_VERTEX_LIMIT = 1024;
+
     /**
      *  The base ordering algorithm which shall be used to eliminate all but the largest biconnected component.
      */
@@ -509,7 +236,7 @@ struct htd::GraphPreprocessor::Implementation
 
                         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[mappedVertex];
 
-                        const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
+                        const std::vector<htd::vertex_t> & neighborCollection = graph.neighborVector(vertex);
 
                         auto position2 = neighborCollection.begin();
 
@@ -573,85 +300,353 @@ struct htd::GraphPreprocessor::Implementation
     };
 
     /**
-     *  Eliminate all vertices of degree less than 2 from the graph.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  Set of vertices with 0-based identifiers supporting insertion, removal and membership tests in constant time.
      *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     *  The elements are stored densely so that iterating over the set only visits the contained vertices.
      */
-    static bool eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                     std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                     std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                     std::vector<htd::vertex_t> & ordering);
+    class VertexSet
+    {
+        public:
+            /**
+             *  Constructor for an empty vertex set.
+             *
+             *  @param[in] vertexCount  The number of vertices in the underlying graph, i.e., all vertices must be smaller than this value.
+             */
+            VertexSet(std::size_t vertexCount) : elements_(), positions_(vertexCount, (htd::index_t)-1)
+            {
 
-    /**
-     *  Eliminate all vertices of degree 2 from the graph.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                              std::vector<htd::vertex_t> & ordering);
+            }
 
-    /**
-     *  Eliminate all vertices of degree 3 from the graph in
-     *  case that at least two of its neighbors are adjacent.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                std::vector<htd::vertex_t> & ordering);
+            /**
+             *  Getter for the number of vertices in the set.
+             *
+             *  @return The number of vertices in the set.
+             */
+            std::size_t size(void) const HTD_NOEXCEPT
+            {
+                return elements_.size();
+            }
 
-    /**
-     *  If two vertices of degree 3 have exactly the same neighbors,
-     *  eliminate both of them and connect the three neighbors so
-     *  that they form a triangle.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                              std::vector<htd::vertex_t> & ordering);
+            /**
+             *  Check whether the set is empty.
+             *
+             *  @return True if the set is empty, false otherwise.
+             */
+            bool empty(void) const HTD_NOEXCEPT
+            {
+                return elements_.empty();
+            }
 
-    /**
-     *  Eliminate all vertices from the graph for which
-     *  it holds that all its neighbors form a clique.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *  @param[in] maxDegree        The degree up to which a vertex shall be considered for this preprocessing.
-     *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                            std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                            std::vector<htd::vertex_t> & ordering,
+            /**
+             *  Check whether the given vertex is contained in the set.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if the given vertex is contained in the set, false otherwise.
+             */
+            bool contains(htd::vertex_t vertex) const
+            {
+                return positions_[vertex] != (htd::index_t)-1;
+            }
+
+            /**
+             *  Insert the given vertex into the set.
+             *
+             *  @param[in] vertex   The vertex which shall be inserted.
+             */
+            void insert(htd::vertex_t vertex)
+            {
+                if (!contains(vertex))
+                {
+                    positions_[vertex] = elements_.size();
+
+                    elements_.push_back(vertex);
+                }
+            }
+
+            /**
+             *  Remove the given vertex from the set.
+             *
+             *  @note The vertex which was stored last takes the position of the removed vertex.
+             *
+             *  @param[in] vertex   The vertex which shall be removed.
+             */
+            void erase(htd::vertex_t vertex)
+            {
+                htd::index_t position = positions_[vertex];
+
+                if (position != (htd::index_t)-1)
+                {
+                    htd::vertex_t last = elements_.back();
+
+                    elements_[position] = last;
+
+                    positions_[last] = position;
+
+                    elements_.pop_back();
+
+                    positions_[vertex] = (htd::index_t)-1;
+                }
+            }
+
+            /**
+             *  Getter for an iterator to the first vertex of the set.
+             *
+             *  @return An iterator to the first vertex of the set.
+             */
+            std::vector<htd::vertex_t>::const_iterator begin(void) const
+            {
+                return elements_.begin();
+            }
+
+            /**
+             *  Getter for an iterator past the last vertex of the set.
+             *
+             *  @return An iterator past the last vertex of the set.
+             */
+            std::vector<htd::vertex_t>::const_iterator end(void) const
+            {
+                return elements_.end();
+            }
+
+        private:
+            /**
+             *  The vertices contained in the set.
+             */
+            std::vector<htd::vertex_t> elements_;
+
+            /**
+             *  The position of each vertex within the vector elements_ or (htd::index_t)-1 if it is not contained in the set.
+             */
+            std::vector<htd::index_t> positions_;
+    };
+
+    /**
+     *  Buckets grouping the vertices of small degree, implemented as intrusive doubly-linked lists.
+     *
+     *  Moving a vertex between buckets requires neither hashing nor memory allocations. The lists store
+     *  all vertices incremented by one so that htd::Vertex::UNKNOWN (0) can act as terminator.
+     */
+    class DegreeBuckets
+    {
+        public:
+            /**
+             *  Constructor for empty degree buckets.
+             *
+             *  @param[in] vertexCount  The number of vertices in the underlying graph, i.e., all vertices must be smaller than this value.
+             *  @param[in] bucketCount  The number of buckets. Vertices with a degree of at least this value are not tracked.
+             */
+            DegreeBuckets(std::size_t vertexCount, std::size_t bucketCount) : heads_(bucketCount, htd::Vertex::UNKNOWN), next_(vertexCount, htd::Vertex::UNKNOWN), previous_(vertexCount, htd::Vertex::UNKNOWN), buckets_(vertexCount, bucketCount)
+            {
+
+            }
+
+            /**
+             *  Update the bucket to which the given vertex belongs.
+             *
+             *  @param[in] vertex   The vertex which shall be assigned to a bucket.
+             *  @param[in] degree   The new degree of the vertex.
+             */
+            void update(htd::vertex_t vertex, std::size_t degree)
+            {
+                if (buckets_[vertex] != degree)
+                {
+                    erase(vertex);
+
+                    if (degree < heads_.size())
+                    {
+                        htd::vertex_t head = heads_[degree];
+
+                        next_[vertex] = head;
+                        previous_[vertex] = htd::Vertex::UNKNOWN;
+
+                        if (head != htd::Vertex::UNKNOWN)
+                        {
+                            previous_[head - 1] = vertex + 1;
+                        }
+
+                        heads_[degree] = vertex + 1;
+
+                        buckets_[vertex] = degree;
+                    }
+                }
+            }
+
+            /**
+             *  Remove the given vertex from its bucket.
+             *
+             *  @param[in] vertex   The vertex which shall be removed.
+             */
+            void erase(htd::vertex_t vertex)
+            {
+                std::size_t bucket = buckets_[vertex];
+
+                if (bucket < heads_.size())
+                {
+                    htd::vertex_t next = next_[vertex];
+                    htd::vertex_t previous = previous_[vertex];
+
+                    if (previous != htd::Vertex::UNKNOWN)
+                    {
+                        next_[previous - 1] = next;
+                    }
+                    else
+                    {
+                        heads_[bucket] = next;
+                    }
+
+                    if (next != htd::Vertex::UNKNOWN)
+                    {
+                        previous_[next - 1] = previous;
+                    }
+
+                    buckets_[vertex] = heads_.size();
+                }
+            }
+
+            /**
+             *  Check whether the given bucket is empty.
+             *
+             *  @param[in] bucket   The bucket.
+             *
+             *  @return True if the given bucket is empty, false otherwise.
+             */
+            bool empty(std::size_t bucket) const
+            {
+                return heads_[bucket] == htd::Vertex::UNKNOWN;
+            }
+
+            /**
+             *  Append the vertices of the given bucket to the end of the given vector.
+             *
+             *  @param[in] bucket   The bucket.
+             *  @param[out] target  The target vector.
+             */
+            void copyBucketTo(std::size_t bucket, std::vector<htd::vertex_t> & target) const
+            {
+                for (htd::vertex_t current = heads_[bucket]; current != htd::Vertex::UNKNOWN; current = next_[current - 1])
+                {
+                    target.push_back(current - 1);
+                }
+            }
+
+            /**
+             *  Remove all vertices from the given bucket.
+             *
+             *  @param[in] bucket   The bucket.
+             */
+            void clear(std::size_t bucket)
+            {
+                for (htd::vertex_t current = heads_[bucket]; current != htd::Vertex::UNKNOWN; current = next_[current - 1])
+                {
+                    buckets_[current - 1] = heads_.size();
+                }
+
+                heads_[bucket] = htd::Vertex::UNKNOWN;
+            }
+
+        private:
+            /**
+             *  The first vertex (incremented by one) of each bucket.
+             */
+            std::vector<htd::vertex_t> heads_;
+
+            /**
+             *  The successor (incremented by one) of each vertex within its bucket.
+             */
+            std::vector<htd::vertex_t> next_;
+
+            /**
+             *  The predecessor (incremented by one) of each vertex within its bucket.
+             */
+            std::vector<htd::vertex_t> previous_;
+
+            /**
+             *  The bucket of each vertex or the bucket count if the vertex is not tracked.
+             */
+            std::vector<std::size_t> buckets_;
+    };
+
+    /**
+     *  Eliminate all vertices of degree less than 2 from the graph.
+     *
+     *  @param[in] vertices         The set of all available vertices.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *
+     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     */
+    static bool eliminateVerticesOfDegreeLessThanTwo(VertexSet & vertices,
+                                                     DegreeBuckets & verticesByDegree,
+                                                     std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                                     std::vector<htd::vertex_t> & ordering);
+
+    /**
+     *  Eliminate all vertices of degree 2 from the graph.
+     *
+     *  @param[in] vertices         The set of all available vertices.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *
+     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     */
+    static bool contractPaths(VertexSet & vertices,
+                              DegreeBuckets & verticesByDegree,
+                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                              std::vector<htd::vertex_t> & ordering);
+
+    /**
+     *  Eliminate all vertices of degree 3 from the graph in
+     *  case that at least two of its neighbors are adjacent.
+     *
+     *  @param[in] vertices         The set of all available vertices.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *
+     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     */
+    static bool shrinkTriangles(VertexSet & vertices,
+                                DegreeBuckets & verticesByDegree,
+                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                std::vector<htd::vertex_t> & ordering);
+
+    /**
+     *  If two vertices of degree 3 have exactly the same neighbors,
+     *  eliminate both of them and connect the three neighbors so
+     *  that they form a triangle.
+     *
+     *  @param[in] vertices         The set of all available vertices.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *
+     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     */
+    static bool handleBuddies(VertexSet & vertices,
+                              DegreeBuckets & verticesByDegree,
+                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                              std::vector<htd::vertex_t> & ordering);
+
+    /**
+     *  Eliminate all vertices from the graph for which
+     *  it holds that all its neighbors form a clique.
+     *
+     *  @param[in] vertices         The set of all available vertices.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  @param[in] maxDegree        The degree up to which a vertex shall be considered for this preprocessing.
+     *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
+     *
+     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     */
+    static bool eliminateSimplicialVertices(VertexSet & vertices,
+                                            DegreeBuckets & verticesByDegree,
+                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                            std::vector<htd::vertex_t> & ordering,
                                             std::size_t maxDegree,
                                             std::size_t & minTreeWidth);
 
@@ -661,88 +656,131 @@ struct htd::GraphPreprocessor::Implementation
      *  form a clique.
      *
      *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateAlmostSimplicialVertices(VertexSet & vertices,
+                                                  DegreeBuckets & verticesByDegree,
                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                   std::vector<htd::vertex_t> & ordering,
                                                   std::size_t & minTreeWidth);
 
     /**
-     *  Update the group to which the given vertex belongs.
+     *  Apply the enabled reduction rules to the remaining graph until none of them is applicable any more.
      *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     *  @param[in] oldDegree        The old degree of the vertex.
+     *  @param[in] vertices         The set of all available vertices.
+     *  @param[in] verticesByDegree The buckets grouping the vertices of degree 0 to 3 by their degree.
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
      */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree,
-                                    std::size_t oldDegree);
+    void applyReductionRules(VertexSet & vertices,
+                             DegreeBuckets & verticesByDegree,
+                             std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                             std::vector<htd::vertex_t> & ordering,
+                             std::size_t & minTreeWidth) const;
 
     /**
-     *  Update the group to which the given vertex belongs.
+     *  Apply the enabled reduction rules to the vertices remaining in the given preprocessed graph.
      *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
      */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree);
+    void applyReductionRules(htd::PreprocessedGraph & preprocessedGraph) const;
 
     /**
-     *  Decompose two sets of vertices into vertices only in the first set and vertices in both sets.
+     *  Preprocess the graph given by its neighborhood relation.
      *
-     *  @param[in] set1                 The first set of vertices, sorted in ascending order.
-     *  @param[in] set2                 The second set of vertices, sorted in ascending order.
-     *  @param[out] resultOnlySet1      The set of vertices which are found only in the first set, sorted in ascending order.
-     *  @param[out] resultIntersection  The set of vertices which are found in both sets, sorted in ascending order.
+     *  @param[in] vertexNames  The actual identifiers of the vertices.
+     *  @param[in] neighborhood The neighborhood relation of the graph where the vertex identifiers are replaced by their zero-based indices.
+     *  @param[in] edgeCount    The number of edges in the input graph.
+     *
+     *  @return The preprocessed graph.
      */
-    void splitSets(const std::vector<htd::vertex_t> & set1,
-                   const std::vector<htd::vertex_t> & set2,
-                   std::vector<htd::vertex_t> & resultOnlySet1,
-                   std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT;
+    htd::PreprocessedGraph * prepare(std::vector<htd::vertex_t> && vertexNames,
+                                     std::vector<std::vector<htd::vertex_t>> && neighborhood,
+                                     std::size_t edgeCount) const;
 
     /**
-     *  Compute largest biconnected component of the given graph and eliminate all vertices contained in the remainder.
+     *  Repeatedly split the given preprocessed graph at safe separators until it consists of a single atom.
+     *
+     *  All parts apart from the largest atom are decomposed independently (and concurrently if more than one
+     *  thread is configured) and their elimination orderings are appended to the elimination sequence of the
+     *  preprocessed graph. Because each part is attached to the remainder via a clique, eliminating it first
+     *  neither introduces fill edges in the remaining atom nor increases the width of the remainder.
      *
-     *  @param[in] graph                The graph which shall be preprocessed.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
      */
-    void applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                htd::PreprocessedGraph & preprocessedGraph,
-                                                std::unordered_set<htd::vertex_t> & vertices) const;
+    void applySeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph) const;
 
     /**
-     *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
+     *  Split the given preprocessed graph at its articulation points and retain only a largest biconnected component.
      *
-     *  @param[in] graph                The graph underlying the operation.
-     *  @param[in] vertices             The vertices which shall be eliminated.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
+     *
+     *  @return True if at least one vertex was split off, false otherwise.
      */
-    void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
-                           htd::PreprocessedGraph & preprocessedGraph,
-                           std::size_t & minTreeWidth) const;
+    bool splitAtArticulationPoints(htd::PreprocessedGraph & preprocessedGraph) const;
 
     /**
-     *  Iteratively compute the clique minimal separators of the given graph and remove them from the graph.
+     *  Split the given preprocessed graph at a clique minimal separator and retain only the separator and a largest component of the remainder.
      *
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
+     *
+     *  @return True if at least one vertex was split off, false otherwise.
+     */
+    bool splitAtCliqueSeparator(htd::PreprocessedGraph & preprocessedGraph) const;
+
+    /**
+     *  Retain only the given atom in the preprocessed graph and eliminate all other remaining vertices.
+     *
+     *  @note The neighbors of each connected component of the remaining vertices outside the atom must form a clique.
+     *
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in] atom                 The vertices which shall be retained, sorted in ascending order.
+     *
+     *  @return True if at least one vertex was eliminated, false otherwise.
      */
-    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                           std::unordered_set<htd::vertex_t> & vertices) const;
+    bool separateAtom(htd::PreprocessedGraph & preprocessedGraph,
+                      const std::vector<htd::vertex_t> & atom) const;
+
+    /**
+     *  Compute the elimination ordering of a part of the graph which was split off at a safe separator.
+     *
+     *  The vertices of the part are identified by their position, the vertices of the component which shall be
+     *  eliminated occupy the positions 0 to componentSize - 1 and the vertices of the separator the positions
+     *  afterwards. Only the vertices of the component are written to the target vector.
+     *
+     *  @param[in] part             The part of the graph in preprocessed format.
+     *  @param[in] componentSize    The number of vertices of the component which shall be eliminated.
+     *  @param[in] algorithm        The ordering algorithm which shall be used.
+     *  @param[out] target          The target vector to which the best elimination ordering found for the component shall be appended.
+     *
+     *  @return The maximum bag size which is induced by eliminating the component in the order written to the target vector.
+     */
+    std::size_t computePartOrdering(const htd::IPreprocessedGraph & part,
+                                    std::size_t componentSize,
+                                    const htd::IWidthLimitableOrderingAlgorithm & algorithm,
+                                    std::vector<htd::vertex_t> & target) const;
+
+    /**
+     *  Create the subgraph induced by the given vertices in preprocessed format.
+     *
+     *  The vertices of the subgraph are identified by their position in the given vector, the vertex names are
+     *  consecutive and start at htd::Id::FIRST so that the subgraph can be paired with a matching input graph.
+     *
+     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
+     *  @param[in] vertices         The vertices of the subgraph.
+     *  @param[in] localIndex       A vector of the size of the input graph containing only zeros which is used as scratch space.
+     *
+     *  @return The subgraph induced by the given vertices in preprocessed format.
+     */
+    static htd::PreprocessedGraph * createPart(const htd::CompressedNeighborhood & neighborhood,
+                                               const std::vector<htd::vertex_t> & vertices,
+                                               std::vector<htd::index_t> & localIndex);
 };
 
 htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -757,159 +795,18 @@ htd::GraphPreprocessor::~GraphPreprocessor()
 
 htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
 {
-    htd::PreprocessedGraph * ret = nullptr;
-
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
-
-    htd::GraphPreprocessor::Implementation::PreparedInput input(managementInstance, graph);
-
-    std::size_t size = input.vertexNames.size();
-
-    std::vector<htd::vertex_t> vertexNames(input.vertexNames.begin(), input.vertexNames.end());
-
-    std::vector<std::vector<htd::vertex_t>> neighborhood(input.neighborhood.begin(), input.neighborhood.end());
-
-    if (implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_)
-    {
-        std::unordered_set<htd::vertex_t> vertices(size);
-
-        std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
-
-        std::vector<htd::vertex_t> ordering;
-        ordering.reserve(size);
-
-        std::size_t minTreeWidth = 0;
-
-        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
-        {
-            vertices.insert(vertex);
-
-            implementation_->assignVertexToGroup(vertex, verticesByDegree, neighborhood[vertex].size());
-        }
-
-        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-        {
-
-        }
-
-        bool ok = false;
-
-        if (!vertices.empty() && implementation_->applyPreprocessing2_)
-        {
-            minTreeWidth = 2;
-
-            while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-            {
-                ok = true;
-            }
-
-            if (ok)
-            {
-                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                {
-
-                }
-            }
-        }
-
-        if (!vertices.empty() && implementation_->applyPreprocessing3_)
-        {
-            minTreeWidth = 3;
-
-            while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
-            {
-                ok = false;
-
-                while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-                {
-                    ok = true;
-                }
+    htd::GraphPreprocessor::Implementation::PreparedInput input(*(implementation_->managementInstance_), graph);
 
-                if (ok)
-                {
-                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                    {
-
-                    }
-                }
-            }
-        }
-
-        if (!vertices.empty() && implementation_->applyPreprocessing4_)
-        {
-            if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
-            {
-                while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
-                {
-                    ok = false;
-
-                    while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-                    {
-                        ok = true;
-                    }
-
-                    if (ok)
-                    {
-                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                        {
-
-                        }
-                    }
-                }
-
-                while (implementation_->eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth))
-                {
-                    while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
-                    {
-                        ok = false;
-
-                        while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-                        {
-                            ok = true;
-                        }
-
-                        if (ok)
-                        {
-                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                            {
-
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        for (htd::index_t index = 0; index < ordering.size(); ++index)
-        {
-            ordering[index] = vertexNames[ordering[index]];
-        }
-
-        std::vector<htd::vertex_t> remainingVertices(vertices.begin(), vertices.end());
-
-        std::sort(remainingVertices.begin(), remainingVertices.end());
-
-        ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(ordering), std::move(remainingVertices), graph.edgeCount(), minTreeWidth);
-
-        if (implementation_->applyPreprocessing4_)
-        {
-            //TODO
-            //implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
+    return implementation_->prepare(std::move(input.vertexNames), std::move(input.neighborhood), graph.edgeCount());
+}
 
-            //TODO
-            //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
-        }
-    }
-    else
-    {
-        std::vector<htd::vertex_t> remainingVertices(size);
+htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(std::vector<std::vector<htd::vertex_t>> && neighborhood, std::size_t edgeCount) const HTD_NOEXCEPT
+{
+    std::vector<htd::vertex_t> vertexNames(neighborhood.size());
 
-        std::iota(remainingVertices.begin(), remainingVertices.end(), 0);
+    std::iota(vertexNames.begin(), vertexNames.end(), htd::Vertex::FIRST);
 
-        ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), graph.edgeCount(), 0);
-    }
-
-    return ret;
+    return implementation_->prepare(std::move(vertexNames), std::move(neighborhood), edgeCount);
 }
 
 void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
@@ -920,6 +817,7 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = false;
         implementation_->applyPreprocessing3_ = false;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyPreprocessing5_ = false;
     }
     else if (level == 1)
     {
@@ -927,6 +825,7 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = false;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyPreprocessing5_ = false;
     }
     else if (level == 2)
     {
@@ -934,13 +833,23 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = true;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyPreprocessing5_ = false;
     }
-    else if (level > 2)
+    else if (level == 3)
     {
         implementation_->applyPreprocessing1_ = true;
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = true;
         implementation_->applyPreprocessing4_ = true;
+        implementation_->applyPreprocessing5_ = false;
+    }
+    else
+    {
+        implementation_->applyPreprocessing1_ = true;
+        implementation_->applyPreprocessing2_ = true;
+        implementation_->applyPreprocessing3_ = true;
+        implementation_->applyPreprocessing4_ = true;
+        implementation_->applyPreprocessing5_ = true;
     }
 }
 
@@ -976,6 +885,16 @@ void htd::GraphPreprocessor::setNonImprovementLimit(std::size_t nonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::GraphPreprocessor::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::GraphPreprocessor::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAlgorithm * algorithm)
 {
     HTD_ASSERT(algorithm != nullptr)
@@ -987,51 +906,93 @@ void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAl
 
 htd::GraphPreprocessor * htd::GraphPreprocessor::clone(void) const
 {
-    return new htd::GraphPreprocessor(implementation_->managementInstance_);
+    htd::GraphPreprocessor * ret = new htd::GraphPreprocessor(implementation_->managementInstance_);
+
+    ret->implementation_->applyPreprocessing1_ = implementation_->applyPreprocessing1_;
+    ret->implementation_->applyPreprocessing2_ = implementation_->applyPreprocessing2_;
+    ret->implementation_->applyPreprocessing3_ = implementation_->applyPreprocessing3_;
+    ret->implementation_->applyPreprocessing4_ = implementation_->applyPreprocessing4_;
+    ret->implementation_->applyPreprocessing5_ = implementation_->applyPreprocessing5_;
+
+    ret->implementation_->iterationCount_ = implementation_->iterationCount_;
+    ret->implementation_->nonImprovementLimit_ = implementation_->nonImprovementLimit_;
+    ret->implementation_->threadCount_ = implementation_->threadCount_;
+
+    ret->setOrderingAlgorithm(implementation_->orderingAlgorithm_->clone());
+
+    return ret;
 }
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree)
+htd::PreprocessedGraph * htd::GraphPreprocessor::Implementation::prepare(std::vector<htd::vertex_t> && vertexNames,
+                                                                        std::vector<std::vector<htd::vertex_t>> && neighborhood,
+                                                                        std::size_t edgeCount) const
 {
-    if (newDegree < verticesByDegree.size())
+    htd::PreprocessedGraph * ret = nullptr;
+
+    std::size_t size = vertexNames.size();
+
+    if (applyPreprocessing1_ || applyPreprocessing2_ || applyPreprocessing3_ || applyPreprocessing4_)
     {
-        verticesByDegree[newDegree].insert(vertex);
-    }
-}
+        VertexSet vertices(size);
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree,
-                                                                 std::size_t oldDegree)
-{
-    if (oldDegree < verticesByDegree.size())
+        DegreeBuckets verticesByDegree(size, 4);
+
+        std::vector<htd::vertex_t> ordering;
+        ordering.reserve(size);
+
+        std::size_t minTreeWidth = 0;
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            vertices.insert(vertex);
+
+            verticesByDegree.update(vertex, neighborhood[vertex].size());
+        }
+
+        applyReductionRules(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth);
+
+        for (htd::index_t index = 0; index < ordering.size(); ++index)
+        {
+            ordering[index] = vertexNames[ordering[index]];
+        }
+
+        std::vector<htd::vertex_t> remainingVertices(vertices.begin(), vertices.end());
+
+        std::sort(remainingVertices.begin(), remainingVertices.end());
+
+        ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(ordering), std::move(remainingVertices), edgeCount, minTreeWidth);
+
+        if (applyPreprocessing5_)
+        {
+            applySeparatorPreprocessing(*ret);
+        }
+    }
+    else
     {
-        verticesByDegree[oldDegree].erase(vertex);
+        std::vector<htd::vertex_t> remainingVertices(size);
+
+        std::iota(remainingVertices.begin(), remainingVertices.end(), 0);
+
+        ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), edgeCount, 0);
     }
 
-    assignVertexToGroup(vertex, verticesByDegree, newDegree);
+    return ret;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(VertexSet & vertices,
+                                                                                  DegreeBuckets & verticesByDegree,
                                                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                   std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-
-    for (htd::vertex_t vertex : verticesDegree0)
-    {
-        ordering.push_back(vertex);
-    }
+    verticesByDegree.copyBucketTo(0, ordering);
 
-    verticesDegree0.clear();
+    verticesByDegree.clear(0);
 
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree1.begin(), verticesDegree1.end());
+    verticesByDegree.copyBucketTo(1, relevantVertices);
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1047,17 +1008,13 @@ bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTw
             // coverity[use_iterator]
             otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-            assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+            verticesByDegree.update(neighbor, otherNeighborhood.size());
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
-
-            verticesDegree1.erase(vertex);
-        }
-        else
-        {
-            verticesDegree0.erase(vertex);
         }
 
+        verticesByDegree.erase(vertex);
+
         ordering.push_back(vertex);
     }
 
@@ -1069,16 +1026,16 @@ bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTw
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::contractPaths(VertexSet & vertices,
+                                                           DegreeBuckets & verticesByDegree,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                            std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree2.begin(), verticesDegree2.end());
+    verticesByDegree.copyBucketTo(2, relevantVertices);
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1104,8 +1061,8 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 
             if (position != otherNeighborhood1.end() && *position == neighbor2)
             {
-                assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), otherNeighborhood1.size() + 1);
-                assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                verticesByDegree.update(neighbor1, otherNeighborhood1.size());
+                verticesByDegree.update(neighbor2, otherNeighborhood2.size());
             }
             else
             {
@@ -1115,7 +1072,7 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
 
-            verticesDegree2.erase(vertex);
+            verticesByDegree.erase(vertex);
 
             ordering.push_back(vertex);
 
@@ -1126,16 +1083,16 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                                             std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::shrinkTriangles(VertexSet & vertices,
+                                                             DegreeBuckets & verticesByDegree,
                                                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                              std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    verticesByDegree.copyBucketTo(3, relevantVertices);
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1234,22 +1191,22 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
 
                 if (neighborDegree1 != otherNeighborhood1.size())
                 {
-                    assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), neighborDegree1);
+                    verticesByDegree.update(neighbor1, otherNeighborhood1.size());
                 }
 
                 if (neighborDegree2 != otherNeighborhood2.size())
                 {
-                    assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), neighborDegree2);
+                    verticesByDegree.update(neighbor2, otherNeighborhood2.size());
                 }
 
                 if (neighborDegree3 != otherNeighborhood3.size())
                 {
-                    assignVertexToGroup(neighbor3, verticesByDegree, otherNeighborhood3.size(), neighborDegree3);
+                    verticesByDegree.update(neighbor3, otherNeighborhood3.size());
                 }
 
                 std::vector<htd::vertex_t>().swap(currentNeighborhood);
 
-                verticesDegree3.erase(vertex);
+                verticesByDegree.erase(vertex);
 
                 ordering.push_back(vertex);
 
@@ -1261,16 +1218,16 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::handleBuddies(VertexSet & vertices,
+                                                           DegreeBuckets & verticesByDegree,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                            std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    verticesByDegree.copyBucketTo(3, relevantVertices);
 
     if (relevantVertices.size() > 1)
     {
@@ -1302,14 +1259,6 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                             htd::vertex_t neighbor2 = currentNeighborhood1[1];
                             htd::vertex_t neighbor3 = currentNeighborhood1[2];
 
-                            std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
-                            std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
-                            std::vector<htd::vertex_t> & otherNeighborhood3 = neighborhood[neighbor3];
-
-                            std::size_t neighborDegree1 = otherNeighborhood1.size();
-                            std::size_t neighborDegree2 = otherNeighborhood2.size();
-                            std::size_t neighborDegree3 = otherNeighborhood3.size();
-
                             for (htd::vertex_t vertex : currentNeighborhood1)
                             {
                                 std::vector<htd::vertex_t> & currentNeighborhood3 = neighborhood[vertex];
@@ -1348,9 +1297,9 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                                 }
                             }
 
-                            assignVertexToGroup(neighbor1, verticesByDegree, neighborhood[neighbor1].size(), neighborDegree1);
-                            assignVertexToGroup(neighbor2, verticesByDegree, neighborhood[neighbor2].size(), neighborDegree2);
-                            assignVertexToGroup(neighbor3, verticesByDegree, neighborhood[neighbor3].size(), neighborDegree3);
+                            verticesByDegree.update(neighbor1, neighborhood[neighbor1].size());
+                            verticesByDegree.update(neighbor2, neighborhood[neighbor2].size());
+                            verticesByDegree.update(neighbor3, neighborhood[neighbor3].size());
 
                             std::vector<htd::vertex_t>().swap(currentNeighborhood1);
                             std::vector<htd::vertex_t>().swap(currentNeighborhood2);
@@ -1369,15 +1318,15 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
         {
             vertices.erase(*it);
 
-            verticesDegree3.erase(*it);
+            verticesByDegree.erase(*it);
         }
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                         std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(VertexSet & vertices,
+                                                                         DegreeBuckets & verticesByDegree,
                                                                          std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                          std::vector<htd::vertex_t> & ordering,
                                                                          std::size_t maxDegree,
@@ -1410,7 +1359,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
                     // coverity[use_iterator]
                     otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    verticesByDegree.update(neighbor, otherNeighborhood.size());
                 }
 
                 minTreewidth = std::max(minTreewidth, currentNeighborhood.size());
@@ -1422,26 +1371,18 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
     for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
         vertices.erase(*it);
 
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
+        verticesByDegree.erase(*it);
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                               std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(VertexSet & vertices,
+                                                                               DegreeBuckets & verticesByDegree,
                                                                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                std::vector<htd::vertex_t> & ordering,
                                                                                std::size_t & minTreeWidth)
@@ -1483,7 +1424,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                     // coverity[use_iterator]
                     otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    verticesByDegree.update(neighbor, otherNeighborhood.size());
                 }
 
                 minTreeWidth = std::max(minTreeWidth, currentNeighborhood.size());
@@ -1530,7 +1471,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
 
                                 otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), culprit), culprit);
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() - 1);
+                                verticesByDegree.update(neighbor, otherNeighborhood2.size());
                             }
 
                             std::size_t middle = otherNeighborhood.size();
@@ -1539,7 +1480,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
 
                             std::inplace_merge(otherNeighborhood.begin(), otherNeighborhood.begin() + middle, otherNeighborhood.end());
 
-                            assignVertexToGroup(culprit, verticesByDegree, otherNeighborhood.size(), middle);
+                            verticesByDegree.update(culprit, otherNeighborhood.size());
 
                             for (htd::vertex_t neighbor : currentNeighborhood)
                             {
@@ -1549,7 +1490,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                                 // coverity[use_iterator]
                                 otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                                verticesByDegree.update(neighbor, otherNeighborhood2.size());
                             }
 
                             std::vector<htd::vertex_t>().swap(currentNeighborhood);
@@ -1562,67 +1503,176 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
+    {
+        vertices.erase(*it);
+
+        verticesByDegree.erase(*it);
+    }
+
+    return ordering.size() > oldOrderingSize;
+}
+
+void htd::GraphPreprocessor::Implementation::applyReductionRules(VertexSet & vertices,
+                                                                 DegreeBuckets & verticesByDegree,
+                                                                 std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                                                 std::vector<htd::vertex_t> & ordering,
+                                                                 std::size_t & minTreeWidth) const
+{
+    while (eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+    {
+
+    }
+
+    bool ok = false;
+
+    if (!vertices.empty() && applyPreprocessing2_)
+    {
+        minTreeWidth = 2;
+
+        while (contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+        {
+            ok = true;
+        }
+
+        if (ok)
+        {
+            while (eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+            {
+
+            }
+        }
+    }
+
+    if (!vertices.empty() && applyPreprocessing3_)
+    {
+        minTreeWidth = 3;
+
+        while (shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+        {
+            ok = false;
+
+            while (contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+            {
+                ok = true;
+            }
+
+            if (ok)
+            {
+                while (eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                {
+
+                }
+            }
+        }
+    }
+
+    if (!vertices.empty() && applyPreprocessing4_)
+    {
+        if (eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
+        {
+            while (shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+            {
+                ok = false;
+
+                while (contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                {
+                    ok = true;
+                }
+
+                if (ok)
+                {
+                    while (eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                    {
+
+                    }
+                }
+            }
+
+            while (eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth))
+            {
+                while (shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                {
+                    ok = false;
+
+                    while (contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                    {
+                        ok = true;
+                    }
+
+                    if (ok)
+                    {
+                        while (eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                        {
+
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void htd::GraphPreprocessor::Implementation::applyReductionRules(htd::PreprocessedGraph & preprocessedGraph) const
+{
+    std::size_t size = preprocessedGraph.inputGraphVertexCount();
+
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
 
-    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
+    VertexSet vertices(size);
+
+    DegreeBuckets verticesByDegree(size, 4);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
     {
-        vertices.erase(*it);
+        vertices.insert(vertex);
 
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
+        verticesByDegree.update(vertex, neighborhood[vertex].size());
     }
 
-    return ordering.size() > oldOrderingSize;
-}
+    std::vector<htd::vertex_t> ordering;
 
-void htd::GraphPreprocessor::Implementation::splitSets(const std::vector<htd::vertex_t> & set1,
-                                                       const std::vector<htd::vertex_t> & set2,
-                                                       std::vector<htd::vertex_t> & resultOnlySet1,
-                                                       std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT
-{
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t minTreeWidth = 0;
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    applyReductionRules(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth);
 
-    while (first1 != last1 && first2 != last2)
+    if (!ordering.empty())
     {
-        if (*first1 < *first2)
-        {
-            resultOnlySet1.push_back(*first1);
+        std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
 
-            ++first1;
-        }
-        else if (*first2 < *first1)
+        for (htd::vertex_t vertex : ordering)
         {
-            ++first2;
+            eliminationSequence.push_back(preprocessedGraph.vertexName(vertex));
         }
-        else
-        {
-            resultIntersection.push_back(*first1);
 
-            ++first1;
+        std::vector<htd::vertex_t> remainingVertices(vertices.begin(), vertices.end());
+
+        std::sort(remainingVertices.begin(), remainingVertices.end());
+
+        preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
 
-            //Skip common value in set 2.
-            ++first2;
-        }
+        preprocessedGraph.updateEdgeCount();
     }
 
-    if (first1 != last1)
+    preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
+}
+
+void htd::GraphPreprocessor::Implementation::applySeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph) const
+{
+    bool split = true;
+
+    while (split && preprocessedGraph.vertexCount() > 0 && !managementInstance_->isTerminated())
     {
-        resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
+        split = splitAtArticulationPoints(preprocessedGraph) || splitAtCliqueSeparator(preprocessedGraph);
+
+        if (split)
+        {
+            applyReductionRules(preprocessedGraph);
+        }
     }
 }
 
-void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                                                    htd::PreprocessedGraph & preprocessedGraph,
-                                                                                    std::unordered_set<htd::vertex_t> & vertices) const
+bool htd::GraphPreprocessor::Implementation::splitAtArticulationPoints(htd::PreprocessedGraph & preprocessedGraph) const
 {
     htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
 
@@ -1632,245 +1682,359 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
 
     biconnectedComponentAlgorithm.determineComponents(preprocessedGraph, components, articulationPoints);
 
-    if (components.size() > 1)
+    if (components.size() <= 1 || managementInstance_->isTerminated())
     {
-        std::vector<htd::index_t> pool;
-        htd::index_t index = 0;
-        std::size_t max = 0;
-        for (const std::vector<htd::vertex_t> & component : components)
-        {
-            std::size_t size = component.size();
+        return false;
+    }
 
-            if (size >= max)
-            {
-                if (size > max)
-                {
-                    max = size;
+    std::vector<htd::index_t> pool;
+    htd::index_t index = 0;
+    std::size_t max = 0;
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        std::size_t size = component.size();
 
-                    pool.clear();
-                }
+        if (size >= max)
+        {
+            if (size > max)
+            {
+                max = size;
 
-                pool.push_back(index);
+                pool.clear();
             }
 
-            ++index;
+            pool.push_back(index);
         }
 
-        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
+        ++index;
+    }
 
-        std::vector<htd::vertex_t> relevantArticulationPoints;
+    std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
 
-        std::set_intersection(selectedComponent.begin(), selectedComponent.end(),
-                              articulationPoints.begin(), articulationPoints.end(),
-                              std::back_inserter(relevantArticulationPoints));
+    std::sort(selectedComponent.begin(), selectedComponent.end());
 
-        for (htd::vertex_t vertex : relevantArticulationPoints)
-        {
-            std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+    return separateAtom(preprocessedGraph, selectedComponent);
+}
 
-            std::vector<htd::vertex_t> newNeighborhood;
-            std::vector<htd::vertex_t> otherNeighbors;
+bool htd::GraphPreprocessor::Implementation::splitAtCliqueSeparator(htd::PreprocessedGraph & preprocessedGraph) const
+{
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
 
-            splitSets(currentNeighborhood, selectedComponent, otherNeighbors, newNeighborhood);
+    if (remainingVertices.size() < 3 || remainingVertices.size() > CLIQUE_SEPARATOR_VERTEX_LIMIT)
+    {
+        return false;
+    }
 
-            currentNeighborhood.swap(newNeighborhood);
+    const htd::CompressedNeighborhood & neighborhood = preprocessedGraph.compressedNeighborhood();
 
-            for (htd::vertex_t neighbor : otherNeighbors)
-            {
-                std::vector<htd::vertex_t> & otherNeighborhood = preprocessedGraph.neighborhood(neighbor);
+    std::vector<htd::index_t> localIndex(preprocessedGraph.inputGraphVertexCount(), 0);
 
-                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-                // coverity[use_iterator]
-                otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
-            }
-        }
+    /* The clique minimal separator algorithm relies on consecutive vertex identifiers, hence it operates on a compact copy of the remaining graph. */
+    std::unique_ptr<htd::PreprocessedGraph> remainingGraph(createPart(neighborhood, remainingVertices, localIndex));
 
-        preprocessedGraph.updateEdgeCount();
+    htd::CliqueMinimalSeparatorAlgorithm cliqueMinimalSeparatorAlgorithm(managementInstance_);
 
-        htd::IConnectedComponentAlgorithm * connectedComponentAlgorithm = managementInstance_->connectedComponentAlgorithmFactory().createInstance();
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(cliqueMinimalSeparatorAlgorithm.computeSeparator(*remainingGraph));
 
-        std::vector<std::vector<htd::vertex_t>> connectedComponents;
+    if (separator->empty() || managementInstance_->isTerminated())
+    {
+        return false;
+    }
 
-        connectedComponentAlgorithm->determineComponents(preprocessedGraph, connectedComponents);
+    std::vector<bool> visited(preprocessedGraph.inputGraphVertexCount(), false);
 
-        delete connectedComponentAlgorithm;
+    std::vector<htd::vertex_t> atom;
 
-        auto position = std::find_if(connectedComponents.begin(), connectedComponents.end(),
-                                     [&](const std::vector<htd::vertex_t> & component)
-        {
-            return std::binary_search(component.begin(), component.end(), selectedComponent[0]);
-        });
+    for (htd::vertex_t vertex : *separator)
+    {
+        htd::vertex_t separatorVertex = remainingVertices[vertex];
 
-        HTD_ASSERT(position != connectedComponents.end())
+        visited[separatorVertex] = true;
 
-        /*
-         * After separating the largest biconnected component from the remainder of the graph,
-         * it forms a connected component of the graph, i.e., the iterator 'position' always
-         * points to a valid position within the set of connected components.
-         */
-        // coverity[deref_iterator]
-        position->swap(*(connectedComponents.rbegin()));
+        atom.push_back(separatorVertex);
+    }
 
-        std::sort(connectedComponents.begin(), connectedComponents.end() - 1,
-                  [](const std::vector<htd::vertex_t> & component1, const std::vector<htd::vertex_t> & component2)
-        {
-           return component1.size() < component2.size();
-        });
+    std::vector<std::vector<htd::vertex_t>> components;
 
-        for (const std::vector<htd::vertex_t> & component : connectedComponents)
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        if (!visited[vertex])
         {
-            std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+            visited[vertex] = true;
 
-            std::size_t oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+            components.emplace_back(1, vertex);
 
-            std::unordered_set<htd::vertex_t> componentVertices(component.begin(), component.end());
+            std::vector<htd::vertex_t> & component = components.back();
 
-            std::size_t minTreeWidth = 0;
-
-            for (htd::vertex_t vertex : component)
+            for (htd::index_t index = 0; index < component.size(); ++index)
             {
-                assignVertexToGroup(vertex, verticesByDegree, preprocessedGraph.neighborhood(vertex).size());
+                for (auto it = neighborhood.begin(component[index]); it != neighborhood.end(component[index]); ++it)
+                {
+                    if (!visited[*it])
+                    {
+                        visited[*it] = true;
+
+                        component.push_back(*it);
+                    }
+                }
             }
+        }
+    }
+
+    if (components.size() <= 1)
+    {
+        return false;
+    }
+
+    std::vector<htd::index_t> pool;
+    htd::index_t index = 0;
+    std::size_t max = 0;
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        std::size_t size = component.size();
 
-            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+        if (size >= max)
+        {
+            if (size > max)
             {
+                max = size;
 
+                pool.clear();
             }
 
-            bool ok = false;
+            pool.push_back(index);
+        }
 
-            if (!componentVertices.empty())
-            {
-                minTreeWidth = 2;
+        ++index;
+    }
 
-                while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                {
-                    ok = true;
-                }
+    const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
 
-                if (ok)
-                {
-                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
+    atom.insert(atom.end(), selectedComponent.begin(), selectedComponent.end());
 
-                    }
-                }
-            }
+    std::sort(atom.begin(), atom.end());
 
-            if (!componentVertices.empty())
-            {
-                minTreeWidth = 3;
+    return separateAtom(preprocessedGraph, atom);
+}
 
-                while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                {
-                    ok = false;
+bool htd::GraphPreprocessor::Implementation::separateAtom(htd::PreprocessedGraph & preprocessedGraph,
+                                                          const std::vector<htd::vertex_t> & atom) const
+{
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
 
-                    while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = true;
-                    }
+    if (atom.size() >= remainingVertices.size())
+    {
+        return false;
+    }
 
-                    if (ok)
-                    {
-                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
+    std::size_t size = preprocessedGraph.inputGraphVertexCount();
 
-                        }
-                    }
-                }
-            }
+    std::vector<bool> keptVertices(size, false);
+
+    for (htd::vertex_t vertex : atom)
+    {
+        keptVertices[vertex] = true;
+    }
+
+    const htd::CompressedNeighborhood & neighborhood = preprocessedGraph.compressedNeighborhood();
+
+    std::vector<bool> visited(size, false);
+
+    /* Each part consists of a connected component of the eliminated vertices followed by its neighbors in the atom. */
+    std::vector<std::vector<htd::vertex_t>> parts;
+
+    std::vector<std::size_t> componentSizes;
+
+    std::vector<htd::vertex_t> attachmentVertices;
+
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        if (!keptVertices[vertex] && !visited[vertex])
+        {
+            visited[vertex] = true;
+
+            parts.emplace_back(1, vertex);
+
+            std::vector<htd::vertex_t> & part = parts.back();
 
-            if (!componentVertices.empty())
+            for (htd::index_t index = 0; index < part.size(); ++index)
             {
-                if (eliminateSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
+                for (auto it = neighborhood.begin(part[index]); it != neighborhood.end(part[index]); ++it)
                 {
-                    while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    htd::vertex_t neighbor = *it;
+
+                    if (!visited[neighbor])
                     {
-                        ok = false;
+                        visited[neighbor] = true;
 
-                        while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                        if (keptVertices[neighbor])
                         {
-                            ok = true;
+                            attachmentVertices.push_back(neighbor);
                         }
-
-                        if (ok)
+                        else
                         {
-                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
-
-                            }
+                            part.push_back(neighbor);
                         }
                     }
+                }
+            }
 
-                    while (eliminateAlmostSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
-                    {
-                        while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = false;
-
-                            while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
-                                ok = true;
-                            }
+            std::sort(part.begin(), part.end());
 
-                            if (ok)
-                            {
-                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                                {
+            std::sort(attachmentVertices.begin(), attachmentVertices.end());
 
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+            componentSizes.push_back(part.size());
 
-            for (auto it = preprocessedGraph.eliminationSequence().begin() + oldOrderingSize; it != preprocessedGraph.eliminationSequence().end(); ++it)
+            for (htd::vertex_t attachmentVertex : attachmentVertices)
             {
-                vertices.erase(*it);
+                visited[attachmentVertex] = false;
 
-                *it = preprocessedGraph.vertexName(*it);
+                part.push_back(attachmentVertex);
             }
 
-            if (!std::binary_search(component.begin(), component.end(), selectedComponent[0]))
-            {
-                oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+            attachmentVertices.clear();
+        }
+    }
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+    std::vector<std::vector<htd::vertex_t>> orderings(parts.size());
 
-                for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
-                {
-                    vertices.erase(*it);
-                }
-            }
-            else
+    std::vector<std::size_t> maxBagSizes(parts.size(), 0);
+
+    std::size_t threadCount = threadCount_;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), (std::size_t)1);
+    }
+
+    threadCount = std::min(threadCount, parts.size());
+
+    if (threadCount > 1)
+    {
+        /* The seeds are drawn up-front so that the result for each part does not depend on the scheduling of the worker threads. */
+        std::vector<unsigned int> seeds;
+
+        seeds.reserve(parts.size());
+
+        for (htd::index_t index = 0; index < parts.size(); ++index)
+        {
+            seeds.push_back(static_cast<unsigned int>(htd::randomNumber()));
+        }
+
+        std::atomic<htd::index_t> nextPart(0);
+
+        auto worker = [&](void)
+        {
+            std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> algorithm(orderingAlgorithm_->clone());
+
+            std::vector<htd::index_t> localIndex(size, 0);
+
+            for (htd::index_t index = nextPart++; index < parts.size(); index = nextPart++)
             {
-                std::vector<htd::vertex_t> remainingVertices(componentVertices.begin(), componentVertices.end());
+                htd::seedThreadLocalRandomNumberGenerator(seeds[index]);
 
-                std::sort(remainingVertices.begin(), remainingVertices.end());
+                std::unique_ptr<htd::PreprocessedGraph> part(createPart(neighborhood, parts[index], localIndex));
 
-                preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
+                maxBagSizes[index] = computePartOrdering(*part, componentSizes[index], *algorithm, orderings[index]);
             }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(threadCount);
+
+        for (htd::index_t index = 0; index < threadCount; ++index)
+        {
+            workers.emplace_back(worker);
+        }
+
+        for (std::thread & currentWorker : workers)
+        {
+            currentWorker.join();
+        }
+    }
+    else
+    {
+        std::vector<htd::index_t> localIndex(size, 0);
+
+        for (htd::index_t index = 0; index < parts.size(); ++index)
+        {
+            std::unique_ptr<htd::PreprocessedGraph> part(createPart(neighborhood, parts[index], localIndex));
+
+            maxBagSizes[index] = computePartOrdering(*part, componentSizes[index], *orderingAlgorithm_, orderings[index]);
+        }
+    }
+
+    /* From here on, the compressed neighborhood must not be accessed any more as the neighborhoods are modified. */
+    std::vector<std::vector<htd::vertex_t>> & currentNeighborhood = preprocessedGraph.neighborhood();
+
+    std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
+
+    for (htd::index_t index = 0; index < parts.size(); ++index)
+    {
+        const std::vector<htd::vertex_t> & part = parts[index];
+
+        for (htd::vertex_t vertex : orderings[index])
+        {
+            eliminationSequence.push_back(preprocessedGraph.vertexName(part[vertex]));
+        }
+
+        for (auto it = part.begin() + componentSizes[index]; it != part.end(); ++it)
+        {
+            std::vector<htd::vertex_t> & attachmentNeighborhood = currentNeighborhood[*it];
 
-            preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
+            attachmentNeighborhood.erase(std::remove_if(attachmentNeighborhood.begin(), attachmentNeighborhood.end(), [&](htd::vertex_t neighbor) { return !keptVertices[neighbor]; }), attachmentNeighborhood.end());
+        }
+
+        for (auto it = part.begin(); it != part.begin() + componentSizes[index]; ++it)
+        {
+            std::vector<htd::vertex_t>().swap(currentNeighborhood[*it]);
+        }
+
+        if (maxBagSizes[index] > 0)
+        {
+            /* The width of a heuristic ordering is no lower bound for the treewidth, it only restricts decompositions based on the partial ordering. */
+            preprocessedGraph.eliminationSequenceWidth() = std::max(preprocessedGraph.eliminationSequenceWidth(), maxBagSizes[index] - 1);
         }
     }
+
+    preprocessedGraph.setRemainingVertices(atom);
+
+    preprocessedGraph.updateEdgeCount();
+
+    return true;
 }
 
-void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
-                                                               htd::PreprocessedGraph & preprocessedGraph,
-                                                               std::size_t & minTreeWidth) const
+std::size_t htd::GraphPreprocessor::Implementation::computePartOrdering(const htd::IPreprocessedGraph & part,
+                                                                        std::size_t componentSize,
+                                                                        const htd::IWidthLimitableOrderingAlgorithm & algorithm,
+                                                                        std::vector<htd::vertex_t> & target) const
 {
-    std::vector<htd::vertex_t> remainingComponentVertices(vertices.begin(), vertices.end());
+    const htd::CompressedNeighborhood & partNeighborhood = part.compressedNeighborhood();
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> partEdges;
+
+    partEdges.reserve(part.edgeCount());
+
+    for (htd::vertex_t vertex = 0; vertex < part.vertexCount(); ++vertex)
+    {
+        for (auto it = partNeighborhood.begin(vertex); it != partNeighborhood.end(vertex); ++it)
+        {
+            if (*it > vertex)
+            {
+                partEdges.emplace_back(part.vertexName(vertex), part.vertexName(*it));
+            }
+        }
+    }
 
-    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
+    /* The ordering algorithms receive the subgraph induced by the part, the vertices of the part are named consecutively starting at htd::Id::FIRST. */
+    htd::MultiHypergraph partGraph(managementInstance_, part.vertexCount());
 
-    htd::PreprocessedGraphComponent component(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth);
+    partGraph.addEdges(partEdges);
 
-    htd::IWidthLimitedVertexOrdering * optimalOrdering = nullptr;
+    std::unique_ptr<htd::IWidthLimitedVertexOrdering> optimalOrdering;
 
-    std::size_t bestMaxBagSize = 0;
+    std::size_t bestMaxBagSize = (std::size_t)-1;
 
     htd::index_t iteration = 0;
 
@@ -1883,7 +2047,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             remainingIterations = std::min(remainingIterations, nonImprovementLimit_);
         }
 
-        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm_->computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
+        std::unique_ptr<htd::IWidthLimitedVertexOrdering> currentOrdering(algorithm.computeOrdering(partGraph, part, bestMaxBagSize == (std::size_t)-1 ? bestMaxBagSize : bestMaxBagSize - 1, remainingIterations));
 
         if (currentOrdering->requiredIterations() < nonImprovementLimit_)
         {
@@ -1896,65 +2060,144 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 
         std::size_t currentMaxBagSize = currentOrdering->maximumBagSize();
 
-        if (!managementInstance_->isTerminated())
+        if (!managementInstance_->isTerminated() && !currentOrdering->sequence().empty() && (optimalOrdering == nullptr || currentMaxBagSize < bestMaxBagSize))
         {
-            if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
-            {
-                if (iteration > 1)
-                {
-                    delete optimalOrdering;
-                }
+            optimalOrdering = std::move(currentOrdering);
 
-                optimalOrdering = currentOrdering;
+            bestMaxBagSize = currentMaxBagSize;
+        }
+    }
 
-                bestMaxBagSize = currentMaxBagSize;
-            }
-            else
+    std::size_t oldTargetSize = target.size();
+
+    if (optimalOrdering != nullptr)
+    {
+        for (htd::vertex_t vertex : optimalOrdering->sequence())
+        {
+            if (vertex - htd::Id::FIRST < componentSize)
             {
-                delete currentOrdering;
+                target.push_back(vertex - htd::Id::FIRST);
             }
         }
-        else
+    }
+    else
+    {
+        /* Fall back to an arbitrary, but valid, elimination ordering if the computation was terminated. */
+        for (htd::vertex_t vertex = 0; vertex < componentSize; ++vertex)
         {
-            delete currentOrdering;
+            target.push_back(vertex);
         }
     }
 
-    if (optimalOrdering != nullptr)
+    /*
+     * The ordering of the part may eliminate separator vertices before vertices of the component, hence the
+     * width induced by eliminating only the component in the given order is determined explicitly.
+     */
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    part.compressedNeighborhood().copyTo(neighborhood);
+
+    std::vector<htd::vertex_t> newNeighborhood;
+
+    std::size_t ret = 0;
+
+    for (auto it = target.begin() + oldTargetSize; it != target.end(); ++it)
     {
-        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
+        htd::vertex_t vertex = *it;
+
+        std::vector<htd::vertex_t> & eliminatedNeighborhood = neighborhood[vertex];
+
+        ret = std::max(ret, eliminatedNeighborhood.size() + 1);
+
+        for (htd::vertex_t neighbor : eliminatedNeighborhood)
+        {
+            std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+            newNeighborhood.clear();
+
+            for (auto it2 = eliminatedNeighborhood.begin(), it3 = otherNeighborhood.begin(); it2 != eliminatedNeighborhood.end() || it3 != otherNeighborhood.end();)
+            {
+                htd::vertex_t current = 0;
+
+                if (it3 == otherNeighborhood.end() || (it2 != eliminatedNeighborhood.end() && *it2 < *it3))
+                {
+                    current = *it2;
+
+                    ++it2;
+                }
+                else
+                {
+                    if (it2 != eliminatedNeighborhood.end() && *it2 == *it3)
+                    {
+                        ++it2;
+                    }
+
+                    current = *it3;
 
-        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), optimalOrdering->maximumBagSize() - 1);
+                    ++it3;
+                }
+
+                if (current != vertex && current != neighbor)
+                {
+                    newNeighborhood.push_back(current);
+                }
+            }
+
+            otherNeighborhood.swap(newNeighborhood);
+        }
 
-        delete optimalOrdering;
+        std::vector<htd::vertex_t>().swap(eliminatedNeighborhood);
     }
+
+    return ret;
 }
 
-void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                                                               std::unordered_set<htd::vertex_t> & vertices) const
+htd::PreprocessedGraph * htd::GraphPreprocessor::Implementation::createPart(const htd::CompressedNeighborhood & neighborhood,
+                                                                            const std::vector<htd::vertex_t> & vertices,
+                                                                            std::vector<htd::index_t> & localIndex)
 {
-    htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
+    std::size_t size = vertices.size();
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        localIndex[vertices[index]] = index + 1;
+    }
 
-    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(preprocessedGraph);
+    std::vector<std::vector<htd::vertex_t>> partNeighborhood(size);
 
-    while (separator != nullptr && !separator->empty())
+    std::size_t edgeCount = 0;
+
+    for (htd::index_t index = 0; index < size; ++index)
     {
-        for (htd::vertex_t vertex : *separator)
-        {
-            preprocessedGraph.removeVertex(vertex);
+        std::vector<htd::vertex_t> & currentNeighborhood = partNeighborhood[index];
 
-            vertices.erase(vertex);
+        for (auto it = neighborhood.begin(vertices[index]); it != neighborhood.end(vertices[index]); ++it)
+        {
+            if (localIndex[*it] > 0)
+            {
+                currentNeighborhood.push_back(static_cast<htd::vertex_t>(localIndex[*it] - 1));
+            }
         }
 
-        delete separator;
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
 
-        separator = algorithm.computeSeparator(preprocessedGraph);
+        edgeCount += currentNeighborhood.size();
     }
 
-    if (separator != nullptr)
+    for (htd::vertex_t vertex : vertices)
     {
-        delete separator;
+        localIndex[vertex] = 0;
     }
+
+    std::vector<htd::vertex_t> vertexNames(size);
+
+    std::iota(vertexNames.begin(), vertexNames.end(), htd::Id::FIRST);
+
+    std::vector<htd::vertex_t> remainingVertices(size);
+
+    std::iota(remainingVertices.begin(), remainingVertices.end(), 0);
+
+    return new htd::PreprocessedGraph(std::move(vertexNames), std::move(partNeighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), edgeCount / 2, 0);
 }
 
 #endif /* HTD_HTD_GRAPHPREPROCESSOR_CPP */
@@ -27,6 +27,21 @@
 
 #include <htd/Helpers.hpp>
 
+#include <random>
+
+namespace
+{
+    /**
+     *  Boolean flag indicating whether the calling thread uses its private pseudo-random number generator.
+     */
+    thread_local bool threadLocalRandomNumberGeneratorSeeded = false;
+
+    /**
+     *  The private pseudo-random number generator of the calling thread.
+     */
+    thread_local std::mt19937 threadLocalRandomNumberGenerator;
+}
+
 htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
     htd::LibraryInstance * ret = new htd::LibraryInstance(id);
@@ -36,6 +51,25 @@ htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
     return ret;
 }
 
+void htd::seedThreadLocalRandomNumberGenerator(unsigned int seed)
+{
+    threadLocalRandomNumberGenerator.seed(static_cast<std::mt19937::result_type>(seed));
+
+    threadLocalRandomNumberGeneratorSeeded = true;
+}
+
+std::size_t htd::randomNumber(void)
+{
+    if (threadLocalRandomNumberGeneratorSeeded)
+    {
+        return static_cast<std::size_t>(threadLocalRandomNumberGenerator());
+    }
+
+    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
+    // coverity[dont_call]
+    return static_cast<std::size_t>(std::rand());
+}
+
 void htd::print(bool input)
 {
     print(input, std::cout);
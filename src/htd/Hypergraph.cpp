@@ -162,6 +162,13 @@ void htd::Hypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::ver
     base_->copyNeighborsTo(vertex, target);
 }
 
+const std::vector<htd::vertex_t> & htd::Hypergraph::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return base_->neighborVector(vertex);
+}
+
 htd::vertex_t htd::Hypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return base_->neighborAtPosition(vertex, index);
@@ -172,6 +179,11 @@ htd::ConstCollection<htd::vertex_t> htd::Hypergraph::vertices(void) const
     return base_->vertices();
 }
 
+const std::vector<htd::vertex_t> & htd::Hypergraph::vertexVector(void) const
+{
+    return base_->vertexVector();
+}
+
 void htd::Hypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     base_->copyVerticesTo(target);
@@ -232,6 +244,11 @@ const htd::Hyperedge & htd::Hypergraph::hyperedgeAtPosition(htd::index_t index)
     return base_->hyperedgeAtPosition(index);
 }
 
+void htd::Hypergraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    base_->copyHyperedgeElementsTo(index, target);
+}
+
 const htd::Hyperedge & htd::Hypergraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     return base_->hyperedgeAtPosition(index, vertex);
@@ -46,7 +46,7 @@ htd::HypertreeDecomposition::HypertreeDecomposition(const htd::HypertreeDecompos
 
 htd::HypertreeDecomposition::HypertreeDecomposition(const htd::ITree & original) : htd::TreeDecomposition(original), coveringEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         coveringEdges_[vertex] = std::vector<htd::Hyperedge>();
     }
@@ -54,7 +54,7 @@ htd::HypertreeDecomposition::HypertreeDecomposition(const htd::ITree & original)
 
 htd::HypertreeDecomposition::HypertreeDecomposition(const htd::ILabeledTree & original) : htd::TreeDecomposition(original), coveringEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         coveringEdges_[vertex] = std::vector<htd::Hyperedge>();
     }
@@ -62,7 +62,7 @@ htd::HypertreeDecomposition::HypertreeDecomposition(const htd::ILabeledTree & or
 
 htd::HypertreeDecomposition::HypertreeDecomposition(const htd::ITreeDecomposition & original) : htd::TreeDecomposition(original), coveringEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         coveringEdges_[vertex] = std::vector<htd::Hyperedge>();
     }
@@ -70,7 +70,7 @@ htd::HypertreeDecomposition::HypertreeDecomposition(const htd::ITreeDecompositio
 
 htd::HypertreeDecomposition::HypertreeDecomposition(const htd::IHypertreeDecomposition & original) : htd::TreeDecomposition(original), coveringEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         coveringEdges_[vertex] = original.coveringEdges(vertex);
     }
@@ -224,7 +224,7 @@ std::size_t htd::HypertreeDecomposition::minimumCoveringEdgeAmount(void) const
 
     std::size_t ret = 0;
 
-    for (htd::vertex_t vertex : vertices())
+    for (htd::vertex_t vertex : vertexVector())
     {
         std::size_t currentCoveringEdgeAmount = coveringEdges(vertex).size();
 
@@ -243,7 +243,7 @@ std::size_t htd::HypertreeDecomposition::maximumCoveringEdgeAmount(void) const
 {
     std::size_t ret = 0;
 
-    for (htd::vertex_t vertex : vertices())
+    for (htd::vertex_t vertex : vertexVector())
     {
         std::size_t currentCoveringEdgeAmount = coveringEdges(vertex).size();
 
@@ -356,7 +356,7 @@ htd::HypertreeDecomposition & htd::HypertreeDecomposition::operator=(const htd::
 
         coveringEdges_.clear();
 
-        for (htd::vertex_t vertex : original.vertices())
+        for (htd::vertex_t vertex : original.vertexVector())
         {
             coveringEdges_[vertex] = std::vector<htd::Hyperedge>();
         }
@@ -373,7 +373,7 @@ htd::HypertreeDecomposition & htd::HypertreeDecomposition::operator=(const htd::
 
         coveringEdges_.clear();
 
-        for (htd::vertex_t vertex : original.vertices())
+        for (htd::vertex_t vertex : original.vertexVector())
         {
             coveringEdges_[vertex] = std::vector<htd::Hyperedge>();
         }
@@ -390,7 +390,7 @@ htd::HypertreeDecomposition & htd::HypertreeDecomposition::operator=(const htd::
 
         coveringEdges_.clear();
 
-        for (htd::vertex_t vertex : original.vertices())
+        for (htd::vertex_t vertex : original.vertexVector())
         {
             coveringEdges_[vertex] = std::vector<htd::Hyperedge>();
         }
@@ -407,7 +407,7 @@ htd::HypertreeDecomposition & htd::HypertreeDecomposition::operator=(const htd::
 
         coveringEdges_.clear();
 
-        for (htd::vertex_t vertex : original.vertices())
+        for (htd::vertex_t vertex : original.vertexVector())
         {
             coveringEdges_[vertex] = original.coveringEdges(vertex);
         }
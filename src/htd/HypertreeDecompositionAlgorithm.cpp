@@ -190,7 +190,7 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
 
     for (const auto & labelingFunction : implementation_->labelingFunctions_)
     {
-        for (htd::vertex_t vertex : ret->vertices())
+        for (htd::vertex_t vertex : ret->vertexVector())
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
@@ -204,7 +204,7 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
 
     for (const auto & labelingFunction : labelingFunctions)
     {
-        for (htd::vertex_t vertex : ret->vertices())
+        for (htd::vertex_t vertex : ret->vertexVector())
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
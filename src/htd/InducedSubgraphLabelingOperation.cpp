@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/InducedSubgraphLabelingOperation.hpp>
+#include <htd/LabelHandle.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
 
 #include <algorithm>
@@ -102,6 +103,8 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
     std::vector<htd::state_t> hyperedgeState(hyperedges.size(), 1);
     std::vector<htd::state_t> childHyperedgeState(hyperedges.size(), 1);
 
+    htd::label_handle_t inducedSubgraphLabel = htd::LabelHandle::UNKNOWN;
+
     htd::PostOrderTreeTraversal treeTraversal;
 
     treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
@@ -119,13 +122,23 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 
         if (decomposition.childCount(vertex) > 0)
         {
-            for (htd::vertex_t child : decomposition.children(vertex))
+            /* The labeling exists as soon as the first leaf was labeled, its handle is then resolved once per call. */
+            if (inducedSubgraphLabel == htd::LabelHandle::UNKNOWN)
+            {
+                inducedSubgraphLabel = decomposition.labelings().labelHandle(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER);
+            }
+
+            const htd::IGraphLabeling * inducedSubgraphLabeling = decomposition.labelings().findLabeling(inducedSubgraphLabel);
+
+            HTD_ASSERT(inducedSubgraphLabeling != nullptr)
+
+            for (htd::vertex_t child : decomposition.childVector(vertex))
             {
                 std::vector<htd::vertex_t> forgottenVertices;
 
                 decomposition.copyForgottenVerticesTo(vertex, forgottenVertices, child);
 
-                for (const htd::Hyperedge & hyperedge : htd::accessLabel<std::vector<htd::Hyperedge>>(decomposition.vertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, child)))
+                for (const htd::Hyperedge & hyperedge : htd::accessLabel<std::vector<htd::Hyperedge>>(inducedSubgraphLabeling->vertexLabel(child)))
                 {
                     index = hyperedgeIndices[hyperedge.id()];
 
@@ -248,6 +261,8 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
     std::vector<htd::state_t> hyperedgeState(hyperedges.size(), 1);
     std::vector<htd::state_t> childHyperedgeState(hyperedges.size(), 1);
 
+    htd::label_handle_t inducedSubgraphLabel = htd::LabelHandle::UNKNOWN;
+
     htd::PostOrderTreeTraversal treeTraversal;
 
     treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
@@ -265,13 +280,23 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 
         if (decomposition.childCount(vertex) > 0)
         {
-            for (htd::vertex_t child : decomposition.children(vertex))
+            /* The labeling exists as soon as the first leaf was labeled, its handle is then resolved once per call. */
+            if (inducedSubgraphLabel == htd::LabelHandle::UNKNOWN)
+            {
+                inducedSubgraphLabel = decomposition.labelings().labelHandle(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER);
+            }
+
+            const htd::IGraphLabeling * inducedSubgraphLabeling = decomposition.labelings().findLabeling(inducedSubgraphLabel);
+
+            HTD_ASSERT(inducedSubgraphLabeling != nullptr)
+
+            for (htd::vertex_t child : decomposition.childVector(vertex))
             {
                 std::vector<htd::vertex_t> forgottenVertices;
 
                 decomposition.copyForgottenVerticesTo(vertex, forgottenVertices, child);
 
-                for (const htd::Hyperedge & hyperedge : htd::accessLabel<std::vector<htd::Hyperedge>>(decomposition.vertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, child)))
+                for (const htd::Hyperedge & hyperedge : htd::accessLabel<std::vector<htd::Hyperedge>>(inducedSubgraphLabeling->vertexLabel(child)))
                 {
                     index = hyperedgeIndices[hyperedge.id()];
 
@@ -29,8 +29,14 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/IWidthLimitableTreeDecompositionAlgorithm.hpp>
+#include <htd/Helpers.hpp>
 
+#include <algorithm>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::IterativeImprovementTreeDecompositionAlgorithm.
@@ -45,7 +51,7 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @param[in] fitnessFunction  The fitness function which will be used to evaluate the constructed tree decompositions.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction)
-        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
+        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1), widthPruningEnabled_(false), algorithm_(algorithm), fitnessFunction_(fitnessFunction), lowerBoundAlgorithm_(nullptr), labelingFunctions_(), postProcessingOperations_()
     {
 
     }
@@ -56,6 +62,8 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
 
         delete fitnessFunction_;
 
+        delete lowerBoundAlgorithm_;
+
         for (auto & labelingFunction : labelingFunctions_)
         {
             delete labelingFunction;
@@ -82,6 +90,16 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of worker threads which shall perform iterations concurrently.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  A boolean flag indicating whether iterations which cannot improve the width of the best decomposition shall be abandoned early.
+     */
+    bool widthPruningEnabled_;
+
     /**
      *  The decomposition algorithm which will be called repeatedly.
      */
@@ -92,6 +110,11 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     htd::ITreeDecompositionFitnessFunction * fitnessFunction_;
 
+    /**
+     *  The algorithm which is used to compute a lower bound for the treewidth of the input graph (or nullptr).
+     */
+    htd::ITreeWidthLowerBoundAlgorithm * lowerBoundAlgorithm_;
+
     /**
      *  The labeling functions which are applied after a new decomposition was computed.
      */
@@ -110,6 +133,63 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @return A mutable tree decompostion of the given graph.
      */
     htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Compute a new decomposition of the given graph using the given base decomposition algorithm.
+     *
+     *  If width pruning is enabled and the base decomposition algorithm implements htd::IWidthLimitableTreeDecompositionAlgorithm,
+     *  the computation is abandoned as soon as the maximum bag size of the new decomposition is known to exceed the given bound.
+     *
+     *  @param[in] algorithm            The base decomposition algorithm.
+     *  @param[in] graph                The input graph to decompose.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] maxBagSize           The maximum bag size of the best decomposition found so far.
+     *
+     *  @return A new mutable tree decomposition of the given graph or nullptr if the computation was abandoned.
+     */
+    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                                 const htd::IMultiHypergraph & graph,
+                                                                 const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                 std::size_t maxBagSize) const;
+
+    /**
+     *  Apply the given manipulation operations and labeling functions to a freshly computed decomposition.
+     *
+     *  @param[in] graph                    The graph which was decomposed.
+     *  @param[in] decomposition            The decomposition which shall be post-processed.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied in the given order.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied in the given order.
+     */
+    void postProcessDecomposition(const htd::IMultiHypergraph & graph,
+                                  htd::IMutableTreeDecomposition & decomposition,
+                                  const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                  const std::vector<htd::ILabelingFunction *> & labelingFunctions) const;
+
+    /**
+     *  Perform the iterations of the algorithm concurrently on the given number of worker threads.
+     *
+     *  Each worker thread uses its own clone of the base decomposition algorithm, the fitness function,
+     *  the manipulation operations and the labeling functions as well as its own random number stream.
+     *  The best decomposition found so far, the progress callback and the iteration and non-improvement
+     *  counters are shared between all worker threads.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied to each decomposition.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked for each decomposition computed by the algorithm.
+     *  @param[in] minimumMaxBagSize        A lower bound for the maximum bag size of any decomposition of the input graph.
+     *  @param[in] threadCount              The number of worker threads.
+     *
+     *  @return The best decomposition found or nullptr if no decomposition was found.
+     */
+    htd::ITreeDecomposition * computeDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                             const htd::IPreprocessedGraph & preprocessedGraph,
+                                                             const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                             const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                             const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                             std::size_t minimumMaxBagSize,
+                                                             std::size_t threadCount) const;
 };
 
 htd::IterativeImprovementTreeDecompositionAlgorithm::IterativeImprovementTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction) : implementation_(new Implementation(manager, algorithm, fitnessFunction))
@@ -207,118 +287,321 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         }
     }
 
+    postProcessingOperations.insert(postProcessingOperations.begin(), implementation_->postProcessingOperations_.begin(), implementation_->postProcessingOperations_.end());
+
+    labelingFunctions.insert(labelingFunctions.begin(), implementation_->labelingFunctions_.begin(), implementation_->labelingFunctions_.end());
+
     htd::ITreeDecomposition * ret = nullptr;
 
     htd::FitnessEvaluation * bestEvaluation = nullptr;
 
-    std::size_t nonImprovementCount = 0;
+    std::size_t minimumMaxBagSize = 0;
+
+    if (implementation_->lowerBoundAlgorithm_ != nullptr)
+    {
+        minimumMaxBagSize = implementation_->lowerBoundAlgorithm_->computeLowerBound(graph, preprocessedGraph) + 1;
+    }
+
+    std::size_t threadCount = implementation_->threadCount_;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    if (threadCount == 0)
+    {
+        threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), (std::size_t)1);
+    }
 
-    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    if (threadCount > 1)
+    {
+        ret = implementation_->computeDecompositionInParallel(graph, preprocessedGraph, postProcessingOperations, labelingFunctions, progressCallback, minimumMaxBagSize, threadCount);
+    }
+    else
     {
-        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
+        std::size_t nonImprovementCount = 0;
 
-        if (currentDecomposition != nullptr)
+        std::size_t bestMaxBagSize = (std::size_t)-1;
+
+        const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+        for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && bestMaxBagSize > minimumMaxBagSize && !managementInstance.isTerminated(); ++iteration)
         {
-            for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+            htd::IMutableTreeDecomposition * currentDecomposition = implementation_->computeMutableDecomposition(*(implementation_->algorithm_), graph, preprocessedGraph, bestMaxBagSize);
 
-            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+            if (currentDecomposition != nullptr)
             {
-                operation->apply(graph, *currentDecomposition);
-            }
+                implementation_->postProcessDecomposition(graph, *currentDecomposition, postProcessingOperations, labelingFunctions);
 
-            for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
+                if (!managementInstance.isTerminated())
                 {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+                    htd::FitnessEvaluation * currentEvaluation = implementation_->fitnessFunction_->fitness(graph, *currentDecomposition);
+
+                    if (!managementInstance.isTerminated())
+                    {
+                        progressCallback(graph, *currentDecomposition, *currentEvaluation);
+
+                        if (iteration == 0 || *currentEvaluation > *bestEvaluation)
+                        {
+                            if (iteration > 0)
+                            {
+                                delete ret;
+
+                                delete bestEvaluation;
+                            }
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+                            ret = currentDecomposition;
 
-                    delete labelCollection;
+                            bestEvaluation = currentEvaluation;
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+                            nonImprovementCount = 0;
+
+                            if (minimumMaxBagSize > 0 || implementation_->widthPruningEnabled_)
+                            {
+                                bestMaxBagSize = ret->maximumBagSize();
+                            }
+                        }
+                        else
+                        {
+                            delete currentDecomposition;
+
+                            delete currentEvaluation;
+
+                            ++nonImprovementCount;
+                        }
+                    }
+                    else
+                    {
+                        delete currentDecomposition;
+
+                        delete currentEvaluation;
+                    }
+                }
+                else
+                {
+                    delete currentDecomposition;
                 }
             }
+            else
+            {
+                ++nonImprovementCount;
+            }
+        }
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    if (bestEvaluation != nullptr)
+    {
+        delete bestEvaluation;
+    }
+
+    return ret;
+}
+
+htd::IMutableTreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                                                                                             const htd::IMultiHypergraph & graph,
+                                                                                                                             const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                             std::size_t maxBagSize) const
+{
+    if (widthPruningEnabled_ && maxBagSize != (std::size_t)-1)
+    {
+        const htd::IWidthLimitableTreeDecompositionAlgorithm * widthLimitableAlgorithm = dynamic_cast<const htd::IWidthLimitableTreeDecompositionAlgorithm *>(&algorithm);
+
+        if (widthLimitableAlgorithm != nullptr)
+        {
+            return dynamic_cast<htd::IMutableTreeDecomposition *>(widthLimitableAlgorithm->computeDecomposition(graph, preprocessedGraph, maxBagSize, 1).first);
+        }
+    }
+
+    return dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph, preprocessedGraph));
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::postProcessDecomposition(const htd::IMultiHypergraph & graph,
+                                                                                                   htd::IMutableTreeDecomposition & decomposition,
+                                                                                                   const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                                                                   const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+    {
+        operation->apply(graph, decomposition);
+    }
 
-            for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    for (const htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    {
+        for (htd::vertex_t vertex : decomposition.vertexVector())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+}
+
+htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::computeDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                                                                            const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                            const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                                                                                            const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                                                                                            const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                                                                            std::size_t minimumMaxBagSize,
+                                                                                                                            std::size_t threadCount) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::mutex mutex;
+
+    std::size_t startedIterations = 0;
+
+    std::size_t nonImprovementCount = 0;
+
+    std::size_t bestMaxBagSize = (std::size_t)-1;
+
+    htd::ITreeDecomposition * ret = nullptr;
+
+    htd::FitnessEvaluation * bestEvaluation = nullptr;
+
+    auto worker = [&](unsigned int seed)
+    {
+        htd::seedThreadLocalRandomNumberGenerator(seed);
+
+        std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+        std::unique_ptr<htd::ITreeDecompositionFitnessFunction> fitnessFunction(fitnessFunction_->clone());
+
+        std::vector<htd::ITreeDecompositionManipulationOperation *> clonedPostProcessingOperations;
+
+        std::vector<htd::ILabelingFunction *> clonedLabelingFunctions;
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            clonedPostProcessingOperations.push_back(operation->clone());
+#else
+            clonedPostProcessingOperations.push_back(operation->cloneTreeDecompositionManipulationOperation());
+#endif
+        }
+
+        for (const htd::ILabelingFunction * labelingFunction : labelingFunctions)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            clonedLabelingFunctions.push_back(labelingFunction->clone());
+#else
+            clonedLabelingFunctions.push_back(labelingFunction->cloneLabelingFunction());
+#endif
+        }
+
+        bool finished = false;
+
+        std::size_t currentMaxBagSize = (std::size_t)-1;
+
+        while (!finished)
+        {
             {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+                std::lock_guard<std::mutex> lock(mutex);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+                currentMaxBagSize = bestMaxBagSize;
 
-                    delete labelCollection;
+                finished = !((startedIterations == 0 || iterationCount_ == 0 || startedIterations < iterationCount_) && nonImprovementCount <= nonImprovementLimit_ && bestMaxBagSize > minimumMaxBagSize && !managementInstance.isTerminated());
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+                if (!finished)
+                {
+                    ++startedIterations;
                 }
             }
 
-            if (!managementInstance.isTerminated())
+            if (!finished)
             {
-                htd::FitnessEvaluation * currentEvaluation = implementation_->fitnessFunction_->fitness(graph, *currentDecomposition);
+                htd::IMutableTreeDecomposition * currentDecomposition = computeMutableDecomposition(*algorithm, graph, preprocessedGraph, currentMaxBagSize);
 
-                if (!managementInstance.isTerminated())
+                if (currentDecomposition != nullptr)
                 {
-                    progressCallback(graph, *currentDecomposition, *currentEvaluation);
+                    postProcessDecomposition(graph, *currentDecomposition, clonedPostProcessingOperations, clonedLabelingFunctions);
+
+                    htd::FitnessEvaluation * currentEvaluation = nullptr;
+
+                    if (!managementInstance.isTerminated())
+                    {
+                        currentEvaluation = fitnessFunction->fitness(graph, *currentDecomposition);
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
 
-                    if (iteration == 0 || *currentEvaluation > *bestEvaluation)
+                    if (currentEvaluation != nullptr && !managementInstance.isTerminated())
                     {
-                        if (iteration > 0)
+                        progressCallback(graph, *currentDecomposition, *currentEvaluation);
+
+                        if (bestEvaluation == nullptr || *currentEvaluation > *bestEvaluation)
                         {
                             delete ret;
 
                             delete bestEvaluation;
-                        }
 
-                        ret = currentDecomposition;
+                            ret = currentDecomposition;
+
+                            bestEvaluation = currentEvaluation;
+
+                            nonImprovementCount = 0;
+
+                            if (minimumMaxBagSize > 0 || widthPruningEnabled_)
+                            {
+                                bestMaxBagSize = ret->maximumBagSize();
+                            }
+                        }
+                        else
+                        {
+                            delete currentDecomposition;
 
-                        bestEvaluation = currentEvaluation;
+                            delete currentEvaluation;
 
-                        nonImprovementCount = 0;
+                            ++nonImprovementCount;
+                        }
                     }
                     else
                     {
                         delete currentDecomposition;
 
                         delete currentEvaluation;
-
-                        ++nonImprovementCount;
                     }
                 }
                 else
                 {
-                    delete currentDecomposition;
+                    std::lock_guard<std::mutex> lock(mutex);
 
-                    delete currentEvaluation;
+                    ++nonImprovementCount;
                 }
             }
-            else
-            {
-                delete currentDecomposition;
-            }
         }
-        else
+
+        for (htd::ITreeDecompositionManipulationOperation * operation : clonedPostProcessingOperations)
         {
-            ++nonImprovementCount;
+            delete operation;
         }
-    }
 
-    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        for (htd::ILabelingFunction * labelingFunction : clonedLabelingFunctions)
+        {
+            delete labelingFunction;
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    workers.reserve(threadCount);
+
+    for (htd::index_t index = 0; index < threadCount; ++index)
     {
-        delete operation;
+        workers.emplace_back(worker, static_cast<unsigned int>(htd::randomNumber()));
     }
 
-    if (bestEvaluation != nullptr)
+    for (std::thread & currentWorker : workers)
     {
-        delete bestEvaluation;
+        currentWorker.join();
     }
 
+    delete bestEvaluation;
+
     return ret;
 }
 
@@ -437,6 +720,38 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setNonImprovementLimit
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::IterativeImprovementTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
+const htd::ITreeWidthLowerBoundAlgorithm * htd::IterativeImprovementTreeDecompositionAlgorithm::lowerBoundAlgorithm(void) const
+{
+    return implementation_->lowerBoundAlgorithm_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setLowerBoundAlgorithm(htd::ITreeWidthLowerBoundAlgorithm * algorithm)
+{
+    delete implementation_->lowerBoundAlgorithm_;
+
+    implementation_->lowerBoundAlgorithm_ = algorithm;
+}
+
+bool htd::IterativeImprovementTreeDecompositionAlgorithm::isWidthPruningEnabled(void) const
+{
+    return implementation_->widthPruningEnabled_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setWidthPruningEnabled(bool widthPruningEnabled)
+{
+    implementation_->widthPruningEnabled_ = widthPruningEnabled;
+}
+
 const htd::LibraryInstance * htd::IterativeImprovementTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -473,6 +788,13 @@ htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementT
 
     ret->setIterationCount(implementation_->iterationCount_);
     ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
+    ret->setWidthPruningEnabled(implementation_->widthPruningEnabled_);
+
+    if (implementation_->lowerBoundAlgorithm_ != nullptr)
+    {
+        ret->setLowerBoundAlgorithm(implementation_->lowerBoundAlgorithm_->clone());
+    }
 
     return ret;
 }
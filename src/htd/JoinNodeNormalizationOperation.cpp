@@ -110,11 +110,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
         {
             if (decomposition.isRoot(node) || decomposition.bagContent(decomposition.parent(node)) != bag)
             {
-                htd::vertex_t newParent = decomposition.addParent(node);
-
-                decomposition.mutableBagContent(newParent) = bag;
-
-                decomposition.mutableInducedHyperedges(newParent) = inducedHyperedges;
+                htd::vertex_t newParent = decomposition.addParent(node, bag, inducedHyperedges);
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
@@ -185,11 +181,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
             {
                 if (decomposition.isRoot(vertex) || decomposition.bagContent(decomposition.parent(vertex)) != bag)
                 {
-                    htd::vertex_t newParent = decomposition.addParent(vertex);
-
-                    decomposition.mutableBagContent(newParent) = bag;
-
-                    decomposition.mutableInducedHyperedges(newParent) = inducedHyperedges;
+                    htd::vertex_t newParent = decomposition.addParent(vertex, bag, inducedHyperedges);
 
                     for (auto & labelingFunction : labelingFunctions)
                     {
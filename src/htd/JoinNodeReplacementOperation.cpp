@@ -142,7 +142,7 @@ void htd::JoinNodeReplacementOperation::apply(const htd::IMultiHypergraph & grap
 
         std::vector<htd::vertex_t> requiredVertices;
 
-        const htd::ConstCollection<htd::vertex_t> & childCollection = decomposition.children(currentNode);
+        const std::vector<htd::vertex_t> & childCollection = decomposition.childVector(currentNode);
 
         std::unordered_set<htd::vertex_t> availableChildren(childCollection.begin(), childCollection.end());
 
@@ -230,7 +230,7 @@ void htd::JoinNodeReplacementOperation::apply(const htd::IMultiHypergraph & grap
 
                     availableChildren.clear();
 
-                    const htd::ConstCollection<htd::vertex_t> & newChildCollection = decomposition.children(currentNode);
+                    const std::vector<htd::vertex_t> & newChildCollection = decomposition.childVector(currentNode);
 
                     availableChildren.insert(newChildCollection.begin(), newChildCollection.end());
 
@@ -435,7 +435,7 @@ void htd::JoinNodeReplacementOperation::Implementation::getChildrenVertexLabelSe
 {
     std::unordered_set<htd::vertex_t> result;
 
-    for (htd::vertex_t child : decomposition.children(vertex))
+    for (htd::vertex_t child : decomposition.childVector(vertex))
     {
         const std::vector<htd::vertex_t> & childLabel = decomposition.bagContent(child);
 
@@ -34,24 +34,33 @@
 #include <htd/ILabelCollection.hpp>
 #include <htd/LabelCollection.hpp>
 #include <htd/ConstCollection.hpp>
+#include <htd/LabelHandle.hpp>
 
 #include <algorithm>
 #include <stdexcept>
 
-htd::LabelingCollection::LabelingCollection(void) : labelNames_(), content_()
+htd::LabelingCollection::LabelingCollection(void) : labelNames_(), labelings_(), labelHandles_(), handleNames_(), labelingsByHandle_(), content_()
 {
 
 }
 
-htd::LabelingCollection::LabelingCollection(const LabelingCollection & original)
+htd::LabelingCollection::LabelingCollection(const LabelingCollection & original) : labelNames_(original.labelNames_), labelings_(), labelHandles_(original.labelHandles_), handleNames_(original.handleNames_), labelingsByHandle_(original.labelingsByHandle_.size(), nullptr), content_()
 {
-    for (const std::string & labelName : original.labelNames_)
+    labelings_.reserve(original.labelings_.size());
+
+    for (htd::index_t index = 0; index < labelNames_.size(); ++index)
     {
-        setLabeling(labelName, original.content_.at(labelName)->clone());
+        htd::IGraphLabeling * labeling = original.labelings_[index]->clone();
+
+        labelings_.push_back(labeling);
+
+        labelingsByHandle_[labelHandles_[index]] = labeling;
+
+        content_.emplace(labelNames_[index], labeling);
     }
 }
 
-htd::LabelingCollection::LabelingCollection(const htd::ILabelingCollection & original)
+htd::LabelingCollection::LabelingCollection(const htd::ILabelingCollection & original) : labelNames_(), labelings_(), labelHandles_(), handleNames_(), labelingsByHandle_(), content_()
 {
     for (const std::string & labelName : original.labelNames())
     {
@@ -83,69 +92,104 @@ const std::string & htd::LabelingCollection::labelNameAtPosition(htd::index_t in
 
 htd::IGraphLabeling & htd::LabelingCollection::labeling(const std::string & labelName)
 {
-    auto position = content_.find(labelName);
+    htd::index_t index = position(labelName);
 
-    HTD_ASSERT(position != content_.end())
+    HTD_ASSERT(index < labelings_.size())
 
-    return *(position->second);
+    return *(labelings_[index]);
 }
 
 const htd::IGraphLabeling & htd::LabelingCollection::labeling(const std::string & labelName) const
 {
-    auto position = content_.find(labelName);
+    htd::index_t index = position(labelName);
+
+    HTD_ASSERT(index < labelings_.size())
 
-    HTD_ASSERT(position != content_.end())
+    return *(labelings_[index]);
+}
 
-    return *(position->second);
+htd::label_handle_t htd::LabelingCollection::labelHandle(const std::string & labelName) const
+{
+    htd::index_t index = position(labelName);
+
+    return index < labelHandles_.size() ? labelHandles_[index] : htd::LabelHandle::UNKNOWN;
+}
+
+htd::IGraphLabeling * htd::LabelingCollection::findLabeling(htd::label_handle_t handle)
+{
+    return handle < labelingsByHandle_.size() ? labelingsByHandle_[handle] : nullptr;
+}
+
+const htd::IGraphLabeling * htd::LabelingCollection::findLabeling(htd::label_handle_t handle) const
+{
+    return handle < labelingsByHandle_.size() ? labelingsByHandle_[handle] : nullptr;
 }
 
 bool htd::LabelingCollection::isLabelName(const std::string & labelName) const
 {
-    return content_.find(labelName) != content_.end();
+    return position(labelName) < labelNames_.size();
 }
 
 void htd::LabelingCollection::setLabeling(const std::string & labelName, htd::IGraphLabeling * labeling)
 {
-    auto position = content_.find(labelName);
+    htd::index_t index = position(labelName);
 
-    if (position == content_.end())
+    if (index == labelNames_.size())
     {
-        content_[labelName] = labeling;
+        index = static_cast<htd::index_t>(std::lower_bound(labelNames_.begin(), labelNames_.end(), labelName) - labelNames_.begin());
+
+        labelNames_.insert(labelNames_.begin() + index, labelName);
+
+        labelings_.insert(labelings_.begin() + index, labeling);
 
-        labelNames_.push_back(labelName);
+        /* A name keeps its handle when its labeling is removed, so that handles stay valid when the labeling is added again. */
+        htd::label_handle_t handle = static_cast<htd::label_handle_t>(std::find(handleNames_.begin(), handleNames_.end(), labelName) - handleNames_.begin());
 
-        std::sort(labelNames_.begin(), labelNames_.end());
+        if (handle == handleNames_.size())
+        {
+            handleNames_.push_back(labelName);
+
+            labelingsByHandle_.push_back(nullptr);
+        }
+
+        labelHandles_.insert(labelHandles_.begin() + index, handle);
     }
     else
     {
-        delete position->second;
+        delete labelings_[index];
 
-        content_[labelName] = labeling;
+        labelings_[index] = labeling;
     }
+
+    labelingsByHandle_[labelHandles_[index]] = labeling;
+
+    content_[labelName] = labeling;
 }
 
 void htd::LabelingCollection::removeLabeling(const std::string & labelName)
 {
-    auto position = content_.find(labelName);
+    htd::index_t index = position(labelName);
 
-    if (position != content_.end())
+    if (index < labelNames_.size())
     {
-        delete position->second;
+        delete labelings_[index];
+
+        content_.erase(labelName);
+
+        labelingsByHandle_[labelHandles_[index]] = nullptr;
 
-        content_.erase(position);
+        labelNames_.erase(labelNames_.begin() + index);
 
-        auto position2 = std::find(labelNames_.begin(), labelNames_.end(), labelName);
+        labelings_.erase(labelings_.begin() + index);
 
-        labelNames_.erase(position2);
+        labelHandles_.erase(labelHandles_.begin() + index);
     }
 }
 
 void htd::LabelingCollection::removeVertexLabels(htd::vertex_t vertex)
 {
-    for (const std::string & labelName : labelNames_)
+    for (htd::IGraphLabeling * labeling : labelings_)
     {
-        auto labeling = content_.at(labelName);
-
         if (labeling->isLabeledVertex(vertex))
         {
             labeling->removeVertexLabel(vertex);
@@ -155,10 +199,8 @@ void htd::LabelingCollection::removeVertexLabels(htd::vertex_t vertex)
 
 void htd::LabelingCollection::removeEdgeLabels(htd::id_t edgeId)
 {
-    for (const std::string & labelName : labelNames_)
+    for (htd::IGraphLabeling * labeling : labelings_)
     {
-        auto labeling = content_.at(labelName);
-
         if (labeling->isLabeledEdge(edgeId))
         {
             labeling->removeEdgeLabel(edgeId);
@@ -168,17 +210,17 @@ void htd::LabelingCollection::removeEdgeLabels(htd::id_t edgeId)
 
 void htd::LabelingCollection::swapVertexLabels(htd::vertex_t vertex1, htd::vertex_t vertex2)
 {
-    for (const std::string & labelName : labelNames_)
+    for (htd::IGraphLabeling * labeling : labelings_)
     {
-        content_.at(labelName)->swapVertexLabels(vertex1, vertex2);
+        labeling->swapVertexLabels(vertex1, vertex2);
     }
 }
 
 void htd::LabelingCollection::swapEdgeLabels(htd::id_t edgeId1, htd::id_t edgeId2)
 {
-    for (const std::string & labelName : labelNames_)
+    for (htd::IGraphLabeling * labeling : labelings_)
     {
-        content_.at(labelName)->swapEdgeLabels(edgeId1, edgeId2);
+        labeling->swapEdgeLabels(edgeId1, edgeId2);
     }
 }
 
@@ -186,13 +228,13 @@ htd::ILabelCollection * htd::LabelingCollection::exportVertexLabelCollection(htd
 {
     htd::ILabelCollection * ret = new LabelCollection();
 
-    for (const std::string & labelName : labelNames_)
+    for (htd::index_t index = 0; index < labelings_.size(); ++index)
     {
-        const htd::IGraphLabeling * labeling = content_.at(labelName);
+        const htd::IGraphLabeling * labeling = labelings_[index];
 
         if (labeling != nullptr && labeling->isLabeledVertex(vertex))
         {
-            ret->setLabel(labelName, labeling->vertexLabel(vertex).clone());
+            ret->setLabel(labelNames_[index], labeling->vertexLabel(vertex).clone());
         }
     }
 
@@ -203,13 +245,13 @@ htd::ILabelCollection * htd::LabelingCollection::exportEdgeLabelCollection(htd::
 {
     htd::ILabelCollection * ret = new LabelCollection();
 
-    for (const std::string & labelName : labelNames_)
+    for (htd::index_t index = 0; index < labelings_.size(); ++index)
     {
-        const htd::IGraphLabeling * labeling = content_.at(labelName);
+        const htd::IGraphLabeling * labeling = labelings_[index];
 
         if (labeling != nullptr && labeling->isLabeledEdge(edgeId))
         {
-            ret->setLabel(labelName, labeling->edgeLabel(edgeId).clone());
+            ret->setLabel(labelNames_[index], labeling->edgeLabel(edgeId).clone());
         }
     }
 
@@ -218,27 +260,25 @@ htd::ILabelCollection * htd::LabelingCollection::exportEdgeLabelCollection(htd::
 
 void htd::LabelingCollection::clear(void)
 {
-    for (auto & labeling : content_)
+    for (htd::IGraphLabeling * labeling : labelings_)
     {
-        if (labeling.second != nullptr)
-        {
-            delete labeling.second;
-        }
+        delete labeling;
     }
 
+    labelNames_.clear();
+
+    labelings_.clear();
+
+    labelHandles_.clear();
+
+    std::fill(labelingsByHandle_.begin(), labelingsByHandle_.end(), nullptr);
+
     content_.clear();
 }
 
 htd::LabelingCollection * htd::LabelingCollection::clone(void) const
 {
-    htd::LabelingCollection * ret = new htd::LabelingCollection();
-
-    for (const std::string & labelName : labelNames_)
-    {
-        ret->setLabeling(labelName, content_.at(labelName)->clone());
-    }
-
-    return ret;
+    return new htd::LabelingCollection(*this);
 }
 
 htd::IGraphLabeling & htd::LabelingCollection::operator[](const std::string & labelName)
@@ -271,4 +311,11 @@ const htd::ConstIterator<std::pair<const std::string, htd::IGraphLabeling *>> ht
     return htd::ConstIterator<std::pair<const std::string, htd::IGraphLabeling *>>(content_.end());
 }
 
+htd::index_t htd::LabelingCollection::position(const std::string & labelName) const
+{
+    auto position = std::lower_bound(labelNames_.begin(), labelNames_.end(), labelName);
+
+    return position != labelNames_.end() && *position == labelName ? static_cast<htd::index_t>(position - labelNames_.begin()) : labelNames_.size();
+}
+
 #endif /* HTD_HTD_LABELINGCOLLECTION_CPP */
@@ -55,8 +55,11 @@
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
+#include <htd/MemoryArena.hpp>
 
+#include <atomic>
 #include <csignal>
+#include <limits>
 
 /**
  *  Private implementation details of class htd::LibraryInstance.
@@ -68,7 +71,7 @@ struct htd::LibraryInstance::Implementation
      *
      *  @param[in] id   The identifier of the management instance.
      */
-    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false)
+    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false), deadline_(NO_DEADLINE), arenaAllocationEnabled_(true), arenaCount_(0), arenaAllocationCount_(0), arenaAllocatedBytes_(0), arenaPeakReservedBytes_(0)
     {
 
     }
@@ -131,7 +134,42 @@ struct htd::LibraryInstance::Implementation
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
+
+    /**
+     *  The deadline of the management instance, given in ticks of std::chrono::steady_clock since the clock's epoch.
+     */
+    std::atomic<std::chrono::steady_clock::rep> deadline_;
+
+    /**
+     *  The value of deadline_ indicating that no deadline was set.
+     */
+    static constexpr std::chrono::steady_clock::rep NO_DEADLINE = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+
+    /**
+     *  A boolean flag indicating whether the algorithms of the library shall use arena allocation.
+     */
+    std::atomic<bool> arenaAllocationEnabled_;
+
+    /**
+     *  The number of recorded memory arenas.
+     */
+    std::atomic<std::size_t> arenaCount_;
+
+    /**
+     *  The total number of allocations served by the recorded memory arenas.
+     */
+    std::atomic<std::size_t> arenaAllocationCount_;
+
+    /**
+     *  The total number of bytes allocated from the recorded memory arenas.
+     */
+    std::atomic<std::size_t> arenaAllocatedBytes_;
+
+    /**
+     *  The largest number of bytes reserved by a single recorded memory arena.
+     */
+    std::atomic<std::size_t> arenaPeakReservedBytes_;
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
@@ -296,17 +334,137 @@ htd::id_t htd::LibraryInstance::id(void) const
 
 bool htd::LibraryInstance::isTerminated(void) const
 {
-    return implementation_->terminated_;
+    if (implementation_->terminated_.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    std::chrono::steady_clock::rep deadline = implementation_->deadline_.load(std::memory_order_relaxed);
+
+    if (deadline != Implementation::NO_DEADLINE && std::chrono::steady_clock::now().time_since_epoch().count() >= deadline)
+    {
+        implementation_->terminated_.store(true, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    return false;
 }
 
 void htd::LibraryInstance::terminate(void)
 {
-    implementation_->terminated_ = true;
+    implementation_->terminated_.store(true, std::memory_order_relaxed);
 }
 
 void htd::LibraryInstance::reset(void)
 {
-    implementation_->terminated_ = false;
+    implementation_->deadline_.store(Implementation::NO_DEADLINE, std::memory_order_relaxed);
+
+    implementation_->terminated_.store(false, std::memory_order_relaxed);
+}
+
+void htd::LibraryInstance::setDeadline(const std::chrono::steady_clock::time_point & deadline)
+{
+    std::chrono::steady_clock::rep value = deadline.time_since_epoch().count();
+
+    implementation_->deadline_.store(value < Implementation::NO_DEADLINE ? value : Implementation::NO_DEADLINE - 1, std::memory_order_relaxed);
+}
+
+void htd::LibraryInstance::setTimeout(const std::chrono::steady_clock::duration & timeout)
+{
+    std::chrono::steady_clock::rep now = std::chrono::steady_clock::now().time_since_epoch().count();
+
+    if (timeout.count() >= Implementation::NO_DEADLINE - now)
+    {
+        implementation_->deadline_.store(Implementation::NO_DEADLINE - 1, std::memory_order_relaxed);
+    }
+    else
+    {
+        implementation_->deadline_.store(now + timeout.count(), std::memory_order_relaxed);
+    }
+}
+
+bool htd::LibraryInstance::hasDeadline(void) const
+{
+    return implementation_->deadline_.load(std::memory_order_relaxed) != Implementation::NO_DEADLINE;
+}
+
+void htd::LibraryInstance::clearDeadline(void)
+{
+    implementation_->deadline_.store(Implementation::NO_DEADLINE, std::memory_order_relaxed);
+}
+
+std::chrono::steady_clock::duration htd::LibraryInstance::remainingTime(void) const
+{
+    std::chrono::steady_clock::rep deadline = implementation_->deadline_.load(std::memory_order_relaxed);
+
+    if (deadline == Implementation::NO_DEADLINE)
+    {
+        return std::chrono::steady_clock::duration::max();
+    }
+
+    std::chrono::steady_clock::rep now = std::chrono::steady_clock::now().time_since_epoch().count();
+
+    if (now >= deadline)
+    {
+        return std::chrono::steady_clock::duration::zero();
+    }
+
+    return std::chrono::steady_clock::duration(deadline - now);
+}
+
+bool htd::LibraryInstance::isArenaAllocationEnabled(void) const
+{
+    return implementation_->arenaAllocationEnabled_.load(std::memory_order_relaxed);
+}
+
+void htd::LibraryInstance::setArenaAllocationEnabled(bool arenaAllocationEnabled)
+{
+    implementation_->arenaAllocationEnabled_.store(arenaAllocationEnabled, std::memory_order_relaxed);
+}
+
+void htd::LibraryInstance::recordArenaUsage(const htd::MemoryArena & arena) const
+{
+    implementation_->arenaCount_.fetch_add(1, std::memory_order_relaxed);
+    implementation_->arenaAllocationCount_.fetch_add(arena.allocationCount(), std::memory_order_relaxed);
+    implementation_->arenaAllocatedBytes_.fetch_add(arena.allocatedBytes(), std::memory_order_relaxed);
+
+    std::size_t reservedBytes = arena.reservedBytes();
+
+    std::size_t peakReservedBytes = implementation_->arenaPeakReservedBytes_.load(std::memory_order_relaxed);
+
+    while (reservedBytes > peakReservedBytes && !implementation_->arenaPeakReservedBytes_.compare_exchange_weak(peakReservedBytes, reservedBytes, std::memory_order_relaxed))
+    {
+
+    }
+}
+
+std::size_t htd::LibraryInstance::arenaCount(void) const
+{
+    return implementation_->arenaCount_.load(std::memory_order_relaxed);
+}
+
+std::size_t htd::LibraryInstance::arenaAllocationCount(void) const
+{
+    return implementation_->arenaAllocationCount_.load(std::memory_order_relaxed);
+}
+
+std::size_t htd::LibraryInstance::arenaAllocatedBytes(void) const
+{
+    return implementation_->arenaAllocatedBytes_.load(std::memory_order_relaxed);
+}
+
+std::size_t htd::LibraryInstance::arenaPeakReservedBytes(void) const
+{
+    return implementation_->arenaPeakReservedBytes_.load(std::memory_order_relaxed);
+}
+
+void htd::LibraryInstance::resetArenaStatistics(void)
+{
+    implementation_->arenaCount_.store(0, std::memory_order_relaxed);
+    implementation_->arenaAllocationCount_.store(0, std::memory_order_relaxed);
+    implementation_->arenaAllocatedBytes_.store(0, std::memory_order_relaxed);
+    implementation_->arenaPeakReservedBytes_.store(0, std::memory_order_relaxed);
 }
 
 htd::ConnectedComponentAlgorithmFactory & htd::LibraryInstance::connectedComponentAlgorithmFactory(void)
@@ -117,11 +117,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
 
             while (childCount - index > implementation_->limit_)
             {
-                htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
-
-                decomposition.mutableBagContent(newNode) = bag;
-
-                decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
+                htd::vertex_t newNode = decomposition.addChild(attachmentPoint, bag, inducedHyperedges);
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
@@ -146,11 +142,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
 
             if (index < childCount)
             {
-                htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
-
-                decomposition.mutableBagContent(newNode) = bag;
-
-                decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
+                htd::vertex_t newNode = decomposition.addChild(attachmentPoint, bag, inducedHyperedges);
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
@@ -203,11 +195,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
 
             while (childCount - index > implementation_->limit_)
             {
-                htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
-
-                decomposition.mutableBagContent(newNode) = bag;
-
-                decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
+                htd::vertex_t newNode = decomposition.addChild(attachmentPoint, bag, inducedHyperedges);
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
@@ -234,11 +222,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
 
             if (index < childCount)
             {
-                htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
-
-                decomposition.mutableBagContent(newNode) = bag;
-
-                decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
+                htd::vertex_t newNode = decomposition.addChild(attachmentPoint, bag, inducedHyperedges);
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
@@ -34,7 +34,7 @@
 #include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::MaximumCardinalitySearchOrderingAlgorithm.
@@ -92,11 +92,9 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    const htd::CompressedNeighborhood & neighborhood = preprocessedGraph.compressedNeighborhood();
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
-
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    std::vector<bool> numberedVertices(preprocessedGraph.inputGraphVertexCount(), false);
 
     htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
 
@@ -122,27 +120,22 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        numberedVertices[selectedVertex] = true;
 
-        for (htd::vertex_t neighbor : selectedNeighborhood)
+        for (auto it = neighborhood.begin(selectedVertex); it != neighborhood.end(selectedVertex); ++it)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
-
-            /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
-            // coverity[use_iterator]
-            currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+            htd::vertex_t neighbor = *it;
 
-            std::size_t & currentWeight = weights[neighbor];
+            if (!numberedVertices[neighbor])
+            {
+                std::size_t & currentWeight = weights[neighbor];
 
-            priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
+                priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
 
-            ++currentWeight;
+                ++currentWeight;
+            }
         }
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
-
-        vertices.erase(selectedVertex);
-
         --size;
 
         ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
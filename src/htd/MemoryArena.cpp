@@ -0,0 +1,145 @@
+/*
+ * File:   MemoryArena.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_MEMORYARENA_CPP
+#define HTD_HTD_MEMORYARENA_CPP
+
+#include <htd/MemoryArena.hpp>
+
+#include <algorithm>
+#include <new>
+
+htd::MemoryArena::MemoryArena(std::size_t blockSize) : blockSize_(std::max(blockSize, static_cast<std::size_t>(alignof(std::max_align_t)))), blocks_(), nextBlock_(0), current_(nullptr), end_(nullptr), allocationCount_(0), allocatedBytes_(0), reservedBytes_(0)
+{
+
+}
+
+htd::MemoryArena::~MemoryArena()
+{
+    release();
+}
+
+void htd::MemoryArena::reset(void)
+{
+    nextBlock_ = 0;
+
+    current_ = nullptr;
+    end_ = nullptr;
+
+    allocationCount_ = 0;
+    allocatedBytes_ = 0;
+}
+
+void htd::MemoryArena::release(void)
+{
+    for (const Block & block : blocks_)
+    {
+        ::operator delete(block.memory);
+    }
+
+    blocks_.clear();
+
+    reservedBytes_ = 0;
+
+    reset();
+}
+
+std::size_t htd::MemoryArena::allocationCount(void) const
+{
+    return allocationCount_;
+}
+
+std::size_t htd::MemoryArena::allocatedBytes(void) const
+{
+    return allocatedBytes_;
+}
+
+std::size_t htd::MemoryArena::reservedBytes(void) const
+{
+    return reservedBytes_;
+}
+
+std::size_t htd::MemoryArena::blockCount(void) const
+{
+    return blocks_.size();
+}
+
+void * htd::MemoryArena::allocateFromNextBlock(std::size_t size, std::size_t alignment)
+{
+    std::uintptr_t position = 0;
+
+    while (nextBlock_ < blocks_.size())
+    {
+        const Block & block = blocks_[nextBlock_];
+
+        ++nextBlock_;
+
+        current_ = block.memory;
+        end_ = block.memory + block.capacity;
+
+        position = (reinterpret_cast<std::uintptr_t>(current_) + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+        if (position + size <= reinterpret_cast<std::uintptr_t>(end_))
+        {
+            current_ = reinterpret_cast<char *>(position + size);
+
+            ++allocationCount_;
+
+            allocatedBytes_ += size;
+
+            return reinterpret_cast<void *>(position);
+        }
+    }
+
+    /* Each new block is at least as large as all previous blocks together, so the number of blocks grows logarithmically. */
+    std::size_t capacity = std::max(std::max(blockSize_, reservedBytes_), size + alignment);
+
+    blocks_.reserve(blocks_.size() + 1);
+
+    Block block;
+
+    block.memory = static_cast<char *>(::operator new(capacity));
+    block.capacity = capacity;
+
+    blocks_.push_back(block);
+
+    nextBlock_ = blocks_.size();
+
+    reservedBytes_ += capacity;
+
+    current_ = block.memory;
+    end_ = block.memory + capacity;
+
+    position = (reinterpret_cast<std::uintptr_t>(current_) + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+    current_ = reinterpret_cast<char *>(position + size);
+
+    ++allocationCount_;
+
+    allocatedBytes_ += size;
+
+    return reinterpret_cast<void *>(position);
+}
+
+#endif /* HTD_HTD_MEMORYARENA_CPP */
@@ -31,7 +31,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -65,12 +65,13 @@ struct htd::MinDegreeOrderingAlgorithm::Implementation
      *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
      *
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in,out] neighborhood     The working copy of the neighborhoods which is overwritten by the function. Re-using it across iterations avoids re-allocating all neighborhoods.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
      *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
-    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & neighborhood, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
 };
 
 htd::MinDegreeOrderingAlgorithm::MinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -114,6 +115,8 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
     std::vector<htd::vertex_t> ordering;
     ordering.reserve(graph.vertexCount());
 
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
     std::size_t iterations = 0;
 
     std::size_t currentMaxBagSize = (std::size_t)-1;
@@ -122,7 +125,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
     {
         ordering.clear();
 
-        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, neighborhood, ordering, maxBagSize);
 
         ++iterations;
     }
@@ -138,7 +141,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
-std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & neighborhood, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
@@ -148,17 +151,17 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    preprocessedGraph.compressedNeighborhood().copyTo(neighborhood);
 
     std::vector<htd::vertex_t> difference;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(neighborhood.size(), neighborhood.size() + 1);
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
-    ret = preprocessedGraph.minTreeWidth() + 1;
+    ret = preprocessedGraph.eliminationSequenceWidth() + 1;
 
     for (htd::vertex_t vertex : vertices)
     {
@@ -190,8 +193,6 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
         {
             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
 
-            std::size_t oldNeighborhoodSize = currentNeighborhood.size();
-
             /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
             // coverity[use_iterator]
             currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
@@ -207,7 +208,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
                 difference.clear();
             }
 
-            priorityQueue.updatePriority(neighbor, oldNeighborhoodSize, currentNeighborhood.size());
+            priorityQueue.updatePriority(neighbor, currentNeighborhood.size());
         }
 
         std::vector<htd::vertex_t>().swap(selectedNeighborhood);
@@ -31,7 +31,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -74,25 +74,22 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *  Compute the number of edges between a set of vertices.
          *
          *  @param[in] availableNeighborhoods   The neighborhoods of the provided vertices.
-         *  @param[in] vertices                 The vertices for which the number of edges shall be returned.
+         *  @param[in] first                    An iterator to the first of the (sorted) vertices for which the number of edges shall be returned.
+         *  @param[in] last                     An iterator past the last of the (sorted) vertices for which the number of edges shall be returned.
          *
          *  @return The number of edges between the provided vertices.
          */
-        std::size_t computeEdgeCount(const std::vector<std::vector<htd::vertex_t>> & availableNeighborhoods, const std::vector<htd::vertex_t> & vertices)
+        std::size_t computeEdgeCount(const htd::CompressedNeighborhood & availableNeighborhoods, htd::CompressedNeighborhood::const_iterator first, htd::CompressedNeighborhood::const_iterator last)
         {
             std::size_t ret = 0;
 
-            std::size_t remainder = vertices.size();
-
-            for (auto it = vertices.begin(); remainder > 0; --remainder)
+            for (auto it = first; it != last;)
             {
                 htd::vertex_t vertex = *it;
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = availableNeighborhoods[vertex];
-
                 ++it;
 
-                ret += htd::set_intersection_size(it, vertices.end(), std::upper_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), currentNeighborhood.end());
+                ret += htd::set_intersection_size(it, last, std::upper_bound(availableNeighborhoods.begin(vertex), availableNeighborhoods.end(vertex), vertex), availableNeighborhoods.end(vertex));
             }
 
             return ret;
@@ -112,11 +109,13 @@ struct htd::MinFillOrderingAlgorithm::Implementation
 
             fillValue.resize(size, 0);
 
+            const htd::CompressedNeighborhood & neighborhood = preprocessedGraph.compressedNeighborhood();
+
             for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
             {
-                const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+                std::size_t neighborCount = neighborhood.neighborCount(vertex);
 
-                std::size_t currentFillValue = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood);
+                std::size_t currentFillValue = ((neighborCount * (neighborCount - 1)) / 2) - computeEdgeCount(neighborhood, neighborhood.begin(vertex), neighborhood.end(vertex));
 
                 fillValue[vertex] = currentFillValue;
 
@@ -150,12 +149,13 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[in] input                The preprocessed, algorithm-specific input data.
+     *  @param[in,out] neighborhood     The working copy of the neighborhoods which is overwritten by the function. Re-using it across iterations avoids re-allocating all neighborhoods.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
      *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
-    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<std::vector<htd::vertex_t>> & neighborhood, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
 };
 
 htd::MinFillOrderingAlgorithm::MinFillOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -201,6 +201,8 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
 
     htd::MinFillOrderingAlgorithm::Implementation::PreparedInput input(managementInstance, preprocessedGraph);
 
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
     std::size_t iterations = 0;
 
     std::size_t currentMaxBagSize = (std::size_t)-1;
@@ -209,7 +211,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     {
         ordering.clear();
 
-        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, input, ordering, maxBagSize);
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, input, neighborhood, ordering, maxBagSize);
 
         ++iterations;
     }
@@ -225,7 +227,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
-std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<std::vector<htd::vertex_t>> & neighborhood, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
@@ -237,9 +239,9 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    preprocessedGraph.compressedNeighborhood().copyTo(neighborhood);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(neighborhood.size(), neighborhood.size() + 1);
 
     std::size_t totalFill = input.totalFill;
 
@@ -256,7 +258,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
-    ret = preprocessedGraph.minTreeWidth() + 1;
+    ret = preprocessedGraph.eliminationSequenceWidth() + 1;
 
     size = preprocessedGraph.remainingVertices().size();
 
@@ -313,7 +315,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -454,7 +456,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill += fillUpdate;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -463,7 +465,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 {
                     totalFill -= tmp;
 
-                    priorityQueue.updatePriority(vertex, fillValue[vertex], 0);
+                    priorityQueue.updatePriority(vertex, 0);
 
                     fillValue[vertex] = 0;
                 }
@@ -518,7 +520,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -80,7 +80,7 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
 
     std::unordered_map<htd::vertex_t, htd::index_t> indices;
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::vertex_t vertex : graph.vertexVector())
     {
         indices.emplace(vertex, index);
 
@@ -89,13 +89,13 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
 
     htd::FlowNetworkStructure flowNetwork(n * 2);
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::vertex_t vertex : graph.vertexVector())
     {
         htd::index_t vertexIndex = indices.at(vertex);
 
         flowNetwork.updateCapacity(vertexIndex, vertexIndex + n, 1);
 
-        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        for (htd::vertex_t neighbor : graph.neighborVector(vertex))
         {
             htd::index_t neighborIndex = indices.at(neighbor);
 
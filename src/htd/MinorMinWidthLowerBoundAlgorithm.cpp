@@ -0,0 +1,205 @@
+/* 
+ * File:   MinorMinWidthLowerBoundAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef HTD_HTD_MINORMINWIDTHLOWERBOUNDALGORITHM_CPP
+#define HTD_HTD_MINORMINWIDTHLOWERBOUNDALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/MinorMinWidthLowerBoundAlgorithm.hpp>
+#include <htd/BucketPriorityQueue.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::MinorMinWidthLowerBoundAlgorithm.
+ */
+struct htd::MinorMinWidthLowerBoundAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+};
+
+htd::MinorMinWidthLowerBoundAlgorithm::MinorMinWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::MinorMinWidthLowerBoundAlgorithm::~MinorMinWidthLowerBoundAlgorithm()
+{
+
+}
+
+std::size_t htd::MinorMinWidthLowerBoundAlgorithm::computeLowerBound(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    std::size_t ret = computeLowerBound(graph, *preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+std::size_t htd::MinorMinWidthLowerBoundAlgorithm::computeLowerBound(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    HTD_UNUSED(graph)
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::size_t ret = preprocessedGraph.minTreeWidth();
+
+    const htd::CompressedNeighborhood & inputNeighborhood = preprocessedGraph.compressedNeighborhood();
+
+    std::size_t vertexCount = inputNeighborhood.vertexCount();
+
+    std::vector<bool> remaining(vertexCount, false);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        remaining[vertex] = true;
+    }
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(vertexCount);
+
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(vertexCount, vertexCount + 1);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        for (auto it = inputNeighborhood.begin(vertex); it != inputNeighborhood.end(vertex); ++it)
+        {
+            htd::vertex_t neighbor = *it;
+
+            if (neighbor != vertex && remaining[neighbor])
+            {
+                currentNeighborhood.push_back(neighbor);
+            }
+        }
+
+        priorityQueue.push(vertex, currentNeighborhood.size());
+    }
+
+    /* No minor of the remaining graph can have a minimum degree larger than the number of remaining vertices minus one. */
+    while (priorityQueue.size() > ret + 1 && !managementInstance.isTerminated())
+    {
+        htd::vertex_t selectedVertex = priorityQueue.top();
+
+        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+
+        if (selectedNeighborhood.size() > ret)
+        {
+            ret = selectedNeighborhood.size();
+        }
+
+        priorityQueue.erase(selectedVertex);
+
+        if (!selectedNeighborhood.empty())
+        {
+            /* Contract the edge between the selected vertex and its neighbor of minimum degree (min-d strategy). */
+            htd::vertex_t target = selectedNeighborhood[0];
+
+            for (htd::vertex_t neighbor : selectedNeighborhood)
+            {
+                if (neighborhood[neighbor].size() < neighborhood[target].size())
+                {
+                    target = neighbor;
+                }
+            }
+
+            std::vector<htd::vertex_t> & targetNeighborhood = neighborhood[target];
+
+            for (htd::vertex_t neighbor : selectedNeighborhood)
+            {
+                if (neighbor != target)
+                {
+                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+
+                    currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+
+                    auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), target);
+
+                    if (position == currentNeighborhood.end() || *position != target)
+                    {
+                        currentNeighborhood.insert(position, target);
+
+                        targetNeighborhood.insert(std::lower_bound(targetNeighborhood.begin(), targetNeighborhood.end(), neighbor), neighbor);
+                    }
+
+                    priorityQueue.updatePriority(neighbor, currentNeighborhood.size());
+                }
+            }
+
+            targetNeighborhood.erase(std::lower_bound(targetNeighborhood.begin(), targetNeighborhood.end(), selectedVertex));
+
+            priorityQueue.updatePriority(target, targetNeighborhood.size());
+
+            std::vector<htd::vertex_t>().swap(selectedNeighborhood);
+        }
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::MinorMinWidthLowerBoundAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::MinorMinWidthLowerBoundAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::MinorMinWidthLowerBoundAlgorithm * htd::MinorMinWidthLowerBoundAlgorithm::clone(void) const
+{
+    return new htd::MinorMinWidthLowerBoundAlgorithm(implementation_->managementInstance_);
+}
+
+#endif /* HTD_HTD_MINORMINWIDTHLOWERBOUNDALGORITHM_CPP */
@@ -193,6 +193,11 @@ void htd::MultiGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::ver
     implementation_->base_->copyNeighborsTo(vertex, target);
 }
 
+const std::vector<htd::vertex_t> & htd::MultiGraph::neighborVector(htd::vertex_t vertex) const
+{
+    return implementation_->base_->neighborVector(vertex);
+}
+
 htd::vertex_t htd::MultiGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return implementation_->base_->neighborAtPosition(vertex, index);
@@ -203,6 +208,11 @@ htd::ConstCollection<htd::vertex_t> htd::MultiGraph::vertices(void) const
     return implementation_->base_->vertices();
 }
 
+const std::vector<htd::vertex_t> & htd::MultiGraph::vertexVector(void) const
+{
+    return implementation_->base_->vertexVector();
+}
+
 void htd::MultiGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     implementation_->base_->copyVerticesTo(target);
@@ -253,6 +263,11 @@ const htd::Hyperedge & htd::MultiGraph::hyperedgeAtPosition(htd::index_t index)
     return implementation_->base_->hyperedgeAtPosition(index);
 }
 
+void htd::MultiGraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    implementation_->base_->copyHyperedgeElementsTo(index, target);
+}
+
 const htd::Hyperedge & htd::MultiGraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     return implementation_->base_->hyperedgeAtPosition(index, vertex);
@@ -313,6 +328,11 @@ htd::id_t htd::MultiGraph::addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
     return implementation_->base_->addEdge(vertex1, vertex2);
 }
 
+htd::id_t htd::MultiGraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    return implementation_->base_->addEdges(edges);
+}
+
 void htd::MultiGraph::removeEdge(htd::id_t edgeId)
 {
     implementation_->base_->removeEdge(edgeId);
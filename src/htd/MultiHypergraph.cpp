@@ -35,14 +35,22 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <deque>
 #include <iterator>
+#include <mutex>
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 /**
  *  Private implementation details of class htd::MultiHypergraph.
+ *
+ *  The hyperedges are stored in a compact arena: Each hyperedge is represented by a fixed-size record and
+ *  hyperedges with at most two endpoints are stored inline within their record. htd::Hyperedge objects are
+ *  only created when they are requested by one of the corresponding accessors.
  */
 struct htd::MultiHypergraph::Implementation
 {
@@ -59,102 +67,1131 @@ struct htd::MultiHypergraph::Implementation
           vertices_(),
           selfLoops_(),
           deletions_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge>>()),
-          neighborhood_()
+          records_(),
+          edgeElements_(),
+          unusedEdgeElements_(0),
+          edges_(),
+          edgesAvailable_(false),
+          edgesMutex_(),
+          neighborhood_(),
+          edgeIndex_(nullptr),
+          edgeIndexMutex_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        invalidateEdgeIndex();
+    }
+
+    /**
+     *  Copy constructor of the implementation details structure.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original)
+        : managementInstance_(original.managementInstance_),
+          size_(original.size_),
+          next_edge_(original.next_edge_),
+          next_vertex_(original.next_vertex_),
+          vertices_(original.vertices_),
+          selfLoops_(original.selfLoops_),
+          deletions_(original.deletions_),
+          records_(original.records_),
+          edgeElements_(original.edgeElements_),
+          unusedEdgeElements_(original.unusedEdgeElements_),
+          edges_(),
+          edgesAvailable_(false),
+          edgesMutex_(),
+          neighborhood_(original.neighborhood_),
+          edgeIndex_(nullptr),
+          edgeIndexMutex_()
+    {
+
+    }
+
+    /**
+     *  Copy assignment operator for the implementation details structure.
+     *
+     *  @param[in] original  The original implementation details structure.
+     *
+     *  @return A reference to the modified implementation details structure.
+     */
+    Implementation & operator=(const Implementation & original)
+    {
+        if (this != &original)
+        {
+            invalidateEdgeIndex();
+
+            invalidateHyperedges();
+
+            managementInstance_ = original.managementInstance_;
+            size_ = original.size_;
+            next_edge_ = original.next_edge_;
+            next_vertex_ = original.next_vertex_;
+            vertices_ = original.vertices_;
+            selfLoops_ = original.selfLoops_;
+            deletions_ = original.deletions_;
+            records_ = original.records_;
+            edgeElements_ = original.edgeElements_;
+            unusedEdgeElements_ = original.unusedEdgeElements_;
+            neighborhood_ = original.neighborhood_;
+        }
+
+        return *this;
+    }
+
+    /**
+     *  Reset the multi-hypergraph to an empty one.
+     */
+    void reset(void)
+    {
+        size_ = 0;
+
+        next_edge_ = htd::Id::FIRST;
+
+        next_vertex_ = htd::Vertex::FIRST;
+
+        vertices_.clear();
+
+        selfLoops_.clear();
+
+        deletions_.clear();
+
+        records_.clear();
+
+        edgeElements_.clear();
+
+        unusedEdgeElements_ = 0;
+
+        neighborhood_.clear();
+
+        invalidateHyperedges();
+
+        invalidateEdgeIndex();
+    }
+
+    /**
+     *  Compact representation of a hyperedge.
+     *
+     *  The endpoints of hyperedges with at most two endpoints are stored inline. The endpoints of larger hyperedges are
+     *  stored in the element arena, starting at the given offset. They are followed by the number of distinct endpoints
+     *  and by the distinct endpoints in ascending order. If the endpoints are already sorted in ascending order and free
+     *  of duplicates, the number of distinct endpoints is stored as zero and the sorted copy is omitted.
+     */
+    struct HyperedgeRecord
+    {
+        /**
+         *  The ID of the hyperedge.
+         */
+        htd::id_t id;
+
+        /**
+         *  The number of endpoints of the hyperedge.
+         */
+        std::uint32_t size;
+
+        union
+        {
+            /**
+             *  The endpoints of the hyperedge if it has at most two endpoints.
+             */
+            htd::vertex_t endpoints[2];
+
+            /**
+             *  The position of the first endpoint of the hyperedge within the element arena if it has more than two endpoints.
+             */
+            std::size_t offset;
+        };
+    };
+
+    /**
+     *  A contiguous range of vertices.
+     */
+    struct VertexRange
     {
+        /**
+         *  A pointer to the first vertex of the range.
+         */
+        const htd::vertex_t * first;
+
+        /**
+         *  A pointer to the position after the last vertex of the range.
+         */
+        const htd::vertex_t * last;
+
+        const htd::vertex_t * begin(void) const
+        {
+            return first;
+        }
+
+        const htd::vertex_t * end(void) const
+        {
+            return last;
+        }
+
+        std::size_t size(void) const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+    };
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of vertices of the multi-hypergraph.
+     */
+    std::size_t size_;
+
+    /**
+     *  The ID the next edge added to the graph will get.
+     */
+    htd::id_t next_edge_;
+
+    /**
+     *  The ID the next vertex added to the graph will get.
+     */
+    htd::vertex_t next_vertex_;
+
+    /**
+     *  The vector of all vertices in the graph sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> vertices_;
+
+    /**
+     *  The set of vertices which have self-loops.
+     */
+    std::unordered_set<htd::vertex_t> selfLoops_;
+
+    /**
+     *  The set of vertices which were removed from the graph.
+     */
+    std::unordered_set<htd::vertex_t> deletions_;
+
+    /**
+     *  The records of the hyperedges sorted by ID in ascending order.
+     */
+    std::vector<HyperedgeRecord> records_;
+
+    /**
+     *  The arena holding the endpoints of all hyperedges with more than two endpoints.
+     */
+    std::vector<htd::vertex_t> edgeElements_;
+
+    /**
+     *  The number of entries of the element arena which belong to hyperedges which were removed or shrunk.
+     */
+    std::size_t unusedEdgeElements_;
+
+    /**
+     *  The collection of hyperedges sorted by ID in ascending order. It is only created when it is requested and
+     *  afterwards kept in sync with the records of the hyperedges.
+     */
+    mutable std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
+
+    /**
+     *  A boolean flag indicating whether the collection of hyperedges was created.
+     */
+    mutable std::atomic<bool> edgesAvailable_;
+
+    /**
+     *  The mutex which serializes the creation of the collection of hyperedges.
+     */
+    mutable std::mutex edgesMutex_;
+
+    /**
+     *  The vector of neighbors for each vertex in the hypergraph. The neighborhood of each vertex is sorted in ascending order.
+     */
+    std::vector<std::vector<htd::vertex_t>> neighborhood_;
+
+    /**
+     *  Lookup structures for the hyperedges of the multi-hypergraph.
+     */
+    struct EdgeIndex
+    {
+        /**
+         *  The IDs of the hyperedges, indexed by the hash code of their sequence of endpoints.
+         */
+        std::unordered_multimap<std::size_t, htd::id_t> edgesByElements;
+
+        /**
+         *  The IDs of the hyperedges containing each vertex, sorted in ascending order.
+         */
+        std::vector<std::vector<htd::id_t>> incidentEdges;
+    };
+
+    /**
+     *  The index of the hyperedges or a null pointer if it was not requested since the last structural change which could not be applied incrementally.
+     */
+    mutable std::atomic<EdgeIndex *> edgeIndex_;
+
+    /**
+     *  The mutex which serializes the construction of the index of the hyperedges.
+     */
+    mutable std::mutex edgeIndexMutex_;
+
+    /**
+     *  Getter for the endpoints of a hyperedge.
+     *
+     *  @param[in] record   The record of the hyperedge.
+     *
+     *  @return The endpoints of the hyperedge in their original order.
+     */
+    VertexRange elements(const HyperedgeRecord & record) const
+    {
+        const htd::vertex_t * first = record.size <= 2 ? record.endpoints : edgeElements_.data() + record.offset;
+
+        return VertexRange { first, first + record.size };
+    }
+
+    /**
+     *  Getter for the endpoints of a hyperedge in ascending order without duplicates.
+     *
+     *  @param[in] record   The record of the hyperedge.
+     *  @param[in] buffer   A buffer which is used if the endpoints of an edge with two endpoints are not sorted.
+     *
+     *  @return The endpoints of the hyperedge in ascending order without duplicates.
+     */
+    VertexRange sortedElements(const HyperedgeRecord & record, htd::vertex_t (&buffer)[2]) const
+    {
+        VertexRange ret = elements(record);
+
+        if (record.size == 2)
+        {
+            if (record.endpoints[0] == record.endpoints[1])
+            {
+                ret.last = ret.first + 1;
+            }
+            else if (record.endpoints[0] > record.endpoints[1])
+            {
+                buffer[0] = record.endpoints[1];
+                buffer[1] = record.endpoints[0];
+
+                ret = VertexRange { buffer, buffer + 2 };
+            }
+        }
+        else if (record.size > 2)
+        {
+            std::size_t count = edgeElements_[record.offset + record.size];
+
+            if (count > 0)
+            {
+                ret.first = ret.last + 1;
+
+                ret.last = ret.first + count;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Check whether a hyperedge contains a specific vertex.
+     *
+     *  @param[in] record   The record of the hyperedge.
+     *  @param[in] vertex   The specific vertex.
+     *
+     *  @return True if the hyperedge contains the specific vertex, false otherwise.
+     */
+    bool contains(const HyperedgeRecord & record, htd::vertex_t vertex) const
+    {
+        const VertexRange & range = elements(record);
+
+        return std::find(range.begin(), range.end(), vertex) != range.end();
+    }
+
+    /**
+     *  Create a htd::Hyperedge object for a hyperedge.
+     *
+     *  @param[in] record   The record of the hyperedge.
+     *
+     *  @return The htd::Hyperedge object representing the hyperedge.
+     */
+    htd::Hyperedge createHyperedge(const HyperedgeRecord & record) const
+    {
+        switch (record.size)
+        {
+            case 1:
+            {
+                return htd::Hyperedge(record.id, record.endpoints[0]);
+            }
+            case 2:
+            {
+                return htd::Hyperedge(record.id, record.endpoints[0], record.endpoints[1]);
+            }
+            default:
+            {
+                htd::vertex_t buffer[2];
+
+                const VertexRange & range = elements(record);
+
+                const VertexRange & sortedRange = sortedElements(record, buffer);
+
+                return htd::Hyperedge(record.id,
+                                      std::vector<htd::vertex_t>(range.begin(), range.end()),
+                                      std::vector<htd::vertex_t>(sortedRange.begin(), sortedRange.end()));
+            }
+        }
+    }
+
+    /**
+     *  Get the collection of hyperedges. If the collection does not exist yet, it is created from the records of the hyperedges.
+     *
+     *  @note This function may be called concurrently by multiple threads as long as the multi-hypergraph is not modified at the same time.
+     *
+     *  @return The collection of hyperedges sorted by ID in ascending order.
+     */
+    const std::shared_ptr<std::deque<htd::Hyperedge>> & hyperedges(void) const
+    {
+        if (!edgesAvailable_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(edgesMutex_);
+
+            if (!edgesAvailable_.load(std::memory_order_relaxed))
+            {
+                std::shared_ptr<std::deque<htd::Hyperedge>> collection = std::make_shared<std::deque<htd::Hyperedge>>();
+
+                for (const HyperedgeRecord & record : records_)
+                {
+                    collection->emplace_back(createHyperedge(record));
+                }
+
+                edges_ = std::move(collection);
+
+                edgesAvailable_.store(true, std::memory_order_release);
+            }
+        }
+
+        return edges_;
+    }
+
+    /**
+     *  Discard the collection of hyperedges. It is recreated from the records of the hyperedges when it is requested the next time.
+     *
+     *  Collections which were handed out before, e.g. as part of a htd::FilteredHyperedgeCollection, remain valid.
+     */
+    void invalidateHyperedges(void)
+    {
+        edgesAvailable_.store(false, std::memory_order_relaxed);
+
+        edges_.reset();
+    }
+
+    /**
+     *  Get the position of the hyperedge with the given ID within the records of the hyperedges.
+     *
+     *  @param[in] edgeId   The ID of the hyperedge.
+     *
+     *  @return The position of the hyperedge with the given ID or the number of hyperedges if there is no such hyperedge.
+     */
+    htd::index_t position(htd::id_t edgeId) const
+    {
+        auto ret = std::lower_bound(records_.begin(), records_.end(), edgeId, [](const HyperedgeRecord & record, htd::id_t id)
+        {
+            return record.id < id;
+        });
+
+        if (ret != records_.end() && ret->id != edgeId)
+        {
+            ret = records_.end();
+        }
+
+        return static_cast<htd::index_t>(ret - records_.begin());
+    }
+
+    /**
+     *  Get the record of the hyperedge with the given ID.
+     *
+     *  @param[in] edgeId   The ID of the hyperedge. The hyperedge must exist.
+     *
+     *  @return The record of the hyperedge with the given ID.
+     */
+    const HyperedgeRecord & record(htd::id_t edgeId) const
+    {
+        htd::index_t index = position(edgeId);
+
+        HTD_ASSERT(index < records_.size())
+
+        return records_[index];
+    }
+
+    /**
+     *  Compute the hash code of a sequence of endpoints.
+     *
+     *  @param[in] begin    An iterator pointing to the first endpoint.
+     *  @param[in] end      An iterator pointing to the position after the last endpoint.
+     *
+     *  @return The hash code of the sequence of endpoints.
+     */
+    template <typename Iterator>
+    static std::size_t computeHash(Iterator begin, Iterator end)
+    {
+        std::size_t ret = 31;
+
+        for (Iterator it = begin; it != end; ++it)
+        {
+            std::hash_combine(ret, static_cast<htd::vertex_t>(*it));
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Add a hyperedge to the given index.
+     *
+     *  @param[in] index    The index which shall be updated.
+     *  @param[in] record   The record of the hyperedge which shall be added to the index.
+     */
+    void indexHyperedge(EdgeIndex & index, const HyperedgeRecord & record) const
+    {
+        htd::vertex_t buffer[2];
+
+        const VertexRange & range = elements(record);
+
+        index.edgesByElements.emplace(computeHash(range.begin(), range.end()), record.id);
+
+        for (htd::vertex_t vertex : sortedElements(record, buffer))
+        {
+            index.incidentEdges[vertex - htd::Vertex::FIRST].push_back(record.id);
+        }
+    }
+
+    /**
+     *  Get the index of the hyperedges. If the index does not exist yet, it is built from scratch.
+     *
+     *  @note This function may be called concurrently by multiple threads as long as the multi-hypergraph is not modified at the same time.
+     *
+     *  @return The index of the hyperedges.
+     */
+    const EdgeIndex & edgeIndex(void) const
+    {
+        EdgeIndex * ret = edgeIndex_.load(std::memory_order_acquire);
+
+        if (ret == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(edgeIndexMutex_);
+
+            ret = edgeIndex_.load(std::memory_order_relaxed);
+
+            if (ret == nullptr)
+            {
+                ret = new EdgeIndex();
+
+                ret->edgesByElements.reserve(records_.size());
+
+                ret->incidentEdges.resize(neighborhood_.size());
+
+                for (const HyperedgeRecord & record : records_)
+                {
+                    indexHyperedge(*ret, record);
+                }
+
+                edgeIndex_.store(ret, std::memory_order_release);
+            }
+        }
+
+        return *ret;
+    }
+
+    /**
+     *  Update the index of the hyperedges, if it exists, before the given hyperedge is removed.
+     *
+     *  @param[in] record   The record of the hyperedge which is about to be removed.
+     */
+    void unindexHyperedge(const HyperedgeRecord & record)
+    {
+        EdgeIndex * index = edgeIndex_.load(std::memory_order_relaxed);
+
+        if (index != nullptr)
+        {
+            htd::vertex_t buffer[2];
+
+            const VertexRange & range = elements(record);
+
+            auto candidates = index->edgesByElements.equal_range(computeHash(range.begin(), range.end()));
+
+            for (auto it = candidates.first; it != candidates.second; ++it)
+            {
+                if (it->second == record.id)
+                {
+                    index->edgesByElements.erase(it);
+
+                    break;
+                }
+            }
+
+            for (htd::vertex_t vertex : sortedElements(record, buffer))
+            {
+                std::vector<htd::id_t> & incidentEdges = index->incidentEdges[vertex - htd::Vertex::FIRST];
+
+                incidentEdges.erase(std::lower_bound(incidentEdges.begin(), incidentEdges.end(), record.id));
+            }
+        }
+    }
+
+    /**
+     *  Update the index of the hyperedges, if it exists, after new vertices were added.
+     */
+    void indexVertices(void)
+    {
+        EdgeIndex * index = edgeIndex_.load(std::memory_order_relaxed);
+
+        if (index != nullptr)
+        {
+            index->incidentEdges.resize(neighborhood_.size());
+        }
+    }
+
+    /**
+     *  Discard the index of the hyperedges. It is rebuilt from scratch when it is requested the next time.
+     */
+    void invalidateEdgeIndex(void)
+    {
+        delete edgeIndex_.exchange(nullptr);
+    }
+
+    /**
+     *  Collect the IDs of all hyperedges with the given sequence of endpoints.
+     *
+     *  @param[in] begin    An iterator pointing to the first endpoint.
+     *  @param[in] end      An iterator pointing to the position after the last endpoint.
+     *  @param[in] size     The number of endpoints.
+     *  @param[out] result  The vector to which the IDs of the matching hyperedges are appended in ascending order.
+     *  @param[in] maximum  The maximum number of IDs which shall be collected.
+     */
+    template <typename Iterator>
+    void findHyperedges(Iterator begin, Iterator end, std::size_t size, std::vector<htd::id_t> & result, std::size_t maximum) const
+    {
+        const EdgeIndex & index = edgeIndex();
+
+        std::size_t previousSize = result.size();
+
+        auto range = index.edgesByElements.equal_range(computeHash(begin, end));
+
+        for (auto it = range.first; it != range.second && result.size() - previousSize < maximum; ++it)
+        {
+            const HyperedgeRecord & candidate = record(it->second);
+
+            const VertexRange & elementRange = elements(candidate);
+
+            if (candidate.size == size && htd::equal(elementRange.begin(), elementRange.end(), begin, end))
+            {
+                result.push_back(candidate.id);
+            }
+        }
+
+        std::sort(result.begin() + previousSize, result.end());
+    }
+
+    /**
+     *  Update the lazily created structures after a new hyperedge was appended to the records of the hyperedges.
+     */
+    void hyperedgeAppended(void)
+    {
+        if (edgesAvailable_.load(std::memory_order_relaxed))
+        {
+            edges_->emplace_back(createHyperedge(records_.back()));
+        }
+
+        EdgeIndex * index = edgeIndex_.load(std::memory_order_relaxed);
+
+        if (index != nullptr)
+        {
+            indexHyperedge(*index, records_.back());
+        }
+    }
+
+    /**
+     *  Store a new hyperedge with a single endpoint.
+     *
+     *  @param[in] id       The ID of the new hyperedge.
+     *  @param[in] vertex   The endpoint of the new hyperedge.
+     */
+    void storeHyperedge(htd::id_t id, htd::vertex_t vertex)
+    {
+        HyperedgeRecord record;
+
+        record.id = id;
+        record.size = 1;
+        record.endpoints[0] = vertex;
+        record.endpoints[1] = vertex;
+
+        records_.push_back(record);
+
+        hyperedgeAppended();
+    }
+
+    /**
+     *  Store a new hyperedge with two endpoints.
+     *
+     *  @param[in] id       The ID of the new hyperedge.
+     *  @param[in] vertex1  The first endpoint of the new hyperedge.
+     *  @param[in] vertex2  The second endpoint of the new hyperedge.
+     */
+    void storeHyperedge(htd::id_t id, htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        HyperedgeRecord record;
+
+        record.id = id;
+        record.size = 2;
+        record.endpoints[0] = vertex1;
+        record.endpoints[1] = vertex2;
+
+        records_.push_back(record);
+
+        hyperedgeAppended();
+    }
+
+    /**
+     *  Store a new hyperedge with more than two endpoints.
+     *
+     *  @param[in] id               The ID of the new hyperedge.
+     *  @param[in] elements         The endpoints of the new hyperedge.
+     *  @param[in] sortedElements   The endpoints of the new hyperedge in ascending order without duplicates.
+     */
+    void storeHyperedge(htd::id_t id, const std::vector<htd::vertex_t> & elements, const std::vector<htd::vertex_t> & sortedElements)
+    {
+        HTD_ASSERT(elements.size() > 2)
+
+        HyperedgeRecord record;
+
+        record.id = id;
+        record.size = static_cast<std::uint32_t>(elements.size());
+        record.offset = edgeElements_.size();
+
+        edgeElements_.insert(edgeElements_.end(), elements.begin(), elements.end());
+
+        if (sortedElements == elements)
+        {
+            edgeElements_.push_back(0);
+        }
+        else
+        {
+            edgeElements_.push_back(static_cast<htd::vertex_t>(sortedElements.size()));
+
+            edgeElements_.insert(edgeElements_.end(), sortedElements.begin(), sortedElements.end());
+        }
+
+        records_.push_back(record);
+
+        hyperedgeAppended();
+    }
+
+    /**
+     *  Remove a vertex from the hyperedge at the given position.
+     *
+     *  @param[in] index    The position of the hyperedge within the records of the hyperedges.
+     *  @param[in] vertex   The vertex which shall be removed from the hyperedge.
+     */
+    void eraseFromHyperedge(htd::index_t index, htd::vertex_t vertex)
+    {
+        HyperedgeRecord & record = records_[index];
+
+        if (record.size <= 2)
+        {
+            htd::vertex_t * last = std::remove(record.endpoints, record.endpoints + record.size, vertex);
+
+            record.size = static_cast<std::uint32_t>(last - record.endpoints);
+        }
+        else
+        {
+            htd::vertex_t buffer[2];
+
+            std::vector<htd::vertex_t> newElements;
+
+            std::vector<htd::vertex_t> newSortedElements;
+
+            for (htd::vertex_t element : elements(record))
+            {
+                if (element != vertex)
+                {
+                    newElements.push_back(element);
+                }
+            }
+
+            for (htd::vertex_t element : sortedElements(record, buffer))
+            {
+                if (element != vertex)
+                {
+                    newSortedElements.push_back(element);
+                }
+            }
+
+            std::size_t oldSize = record.size + 1 + edgeElements_[record.offset + record.size];
+
+            if (newElements.size() > 2)
+            {
+                /* The shrunk hyperedge always fits into the space of the original one. */
+                auto target = std::copy(newElements.begin(), newElements.end(), edgeElements_.begin() + record.offset);
+
+                if (newSortedElements == newElements)
+                {
+                    *target = 0;
+                }
+                else
+                {
+                    *(target++) = static_cast<htd::vertex_t>(newSortedElements.size());
+
+                    std::copy(newSortedElements.begin(), newSortedElements.end(), target);
+                }
+
+                record.size = static_cast<std::uint32_t>(newElements.size());
+
+                unusedEdgeElements_ += oldSize - (record.size + 1 + edgeElements_[record.offset + record.size]);
+            }
+            else
+            {
+                record.size = static_cast<std::uint32_t>(newElements.size());
+
+                std::copy(newElements.begin(), newElements.end(), record.endpoints);
+
+                unusedEdgeElements_ += oldSize;
+            }
+        }
+    }
+
+    /**
+     *  Remove the hyperedges at the given positions from the records of the hyperedges.
+     *
+     *  @param[in] positions    The positions of the hyperedges which shall be removed, sorted in ascending order.
+     */
+    void eraseHyperedges(const std::vector<htd::index_t> & positions)
+    {
+        if (!positions.empty())
+        {
+            auto target = records_.begin() + positions[0];
+
+            auto nextPosition = positions.begin();
+
+            for (auto it = target; it != records_.end(); ++it)
+            {
+                if (nextPosition != positions.end() && static_cast<htd::index_t>(it - records_.begin()) == *nextPosition)
+                {
+                    if (it->size > 2)
+                    {
+                        unusedEdgeElements_ += it->size + 1 + edgeElements_[it->offset + it->size];
+                    }
+
+                    ++nextPosition;
+                }
+                else
+                {
+                    *(target++) = *it;
+                }
+            }
+
+            records_.erase(target, records_.end());
+
+            if (edgesAvailable_.load(std::memory_order_relaxed))
+            {
+                for (auto it = positions.rbegin(); it != positions.rend(); ++it)
+                {
+                    edges_->erase(edges_->begin() + *it);
+                }
+            }
+
+            compactEdgeElements();
+        }
+    }
+
+    /**
+     *  Rewrite the element arena once the majority of its entries is no longer used.
+     */
+    void compactEdgeElements(void)
+    {
+        if (unusedEdgeElements_ > edgeElements_.size() / 2)
+        {
+            std::vector<htd::vertex_t> newEdgeElements;
+
+            newEdgeElements.reserve(edgeElements_.size() - unusedEdgeElements_);
+
+            for (HyperedgeRecord & record : records_)
+            {
+                if (record.size > 2)
+                {
+                    auto begin = edgeElements_.begin() + record.offset;
+
+                    auto end = begin + record.size + 1 + edgeElements_[record.offset + record.size];
+
+                    record.offset = newEdgeElements.size();
+
+                    newEdgeElements.insert(newEdgeElements.end(), begin, end);
+                }
+            }
+
+            edgeElements_.swap(newEdgeElements);
+
+            unusedEdgeElements_ = 0;
+        }
+    }
+
+    /**
+     *  The minimum number of neighborhood entries which are collected before they are merged into the neighborhoods during a bulk update.
+     */
+    static const std::size_t MINIMUM_NEIGHBORHOOD_BATCH_SIZE = 1 << 24;
+
+    /**
+     *  Append a new hyperedge to the multi-hypergraph without updating the neighborhoods of its endpoints.
+     *
+     *  The neighborhoods must be updated via updateNeighborhoods() before they are accessed.
+     *
+     *  @param[in] id       The ID of the new hyperedge.
+     *  @param[in] begin    An iterator pointing to the first endpoint of the new hyperedge.
+     *  @param[in] end      An iterator pointing to the position after the last endpoint of the new hyperedge.
+     *  @param[in] buffer   A buffer which is used to compute the distinct endpoints of the new hyperedge.
+     */
+    template <typename Iterator>
+    void appendHyperedge(htd::id_t id, Iterator begin, Iterator end, std::vector<htd::vertex_t> & buffer)
+    {
+        HTD_ASSERT(begin != end)
+
+        switch (std::distance(begin, end))
+        {
+            case 1:
+            {
+                storeHyperedge(id, *begin);
+
+                break;
+            }
+            case 2:
+            {
+                appendHyperedge(id, *begin, *(begin + 1));
+
+                break;
+            }
+            default:
+            {
+                buffer.assign(begin, end);
+
+                std::sort(buffer.begin(), buffer.end());
+
+                auto position = std::unique(buffer.begin(), buffer.end());
+
+                selfLoops_.insert(position, buffer.end());
+
+                buffer.erase(position, buffer.end());
 
-    }
+                HyperedgeRecord record;
 
-    virtual ~Implementation()
-    {
+                record.id = id;
+                record.size = static_cast<std::uint32_t>(std::distance(begin, end));
+                record.offset = edgeElements_.size();
+
+                edgeElements_.insert(edgeElements_.end(), begin, end);
+
+                if (buffer.size() == record.size && std::equal(buffer.begin(), buffer.end(), begin))
+                {
+                    edgeElements_.push_back(0);
+                }
+                else
+                {
+                    edgeElements_.push_back(static_cast<htd::vertex_t>(buffer.size()));
 
+                    edgeElements_.insert(edgeElements_.end(), buffer.begin(), buffer.end());
+                }
+
+                records_.push_back(record);
+
+                hyperedgeAppended();
+
+                break;
+            }
+        }
     }
 
     /**
-     *  Copy constructor of the implementation details structure.
+     *  Append a new edge to the multi-hypergraph without updating the neighborhoods of its endpoints.
      *
-     *  @param[in] original  The original implementation details structure.
+     *  The neighborhoods must be updated via updateNeighborhoods() before they are accessed.
+     *
+     *  @param[in] id       The ID of the new edge.
+     *  @param[in] vertex1  The first endpoint of the new edge.
+     *  @param[in] vertex2  The second endpoint of the new edge.
      */
-    Implementation(const Implementation & original)
-        : managementInstance_(original.managementInstance_),
-          size_(original.size_),
-          next_edge_(original.next_edge_),
-          next_vertex_(original.next_vertex_),
-          vertices_(original.vertices_),
-          selfLoops_(original.selfLoops_),
-          deletions_(original.deletions_),
-          edges_(std::make_shared<std::deque<htd::Hyperedge>>(*(original.edges_))),
-          neighborhood_(original.neighborhood_)
+    void appendHyperedge(htd::id_t id, htd::vertex_t vertex1, htd::vertex_t vertex2)
     {
+        storeHyperedge(id, vertex1, vertex2);
 
+        if (vertex1 == vertex2)
+        {
+            selfLoops_.insert(vertex1);
+        }
     }
 
     /**
-     *  Reset the multi-hypergraph to an empty one.
+     *  Update the neighborhoods of all endpoints of the hyperedges which were appended via appendHyperedge().
+     *
+     *  The new neighbors are gathered in a single buffer grouped by vertex (counting sort). Afterwards, the
+     *  new neighbors of each vertex are sorted, freed from duplicates and merged into its neighborhood. To
+     *  bound the memory consumption, the hyperedges are processed in batches whose number of gathered entries
+     *  does not (considerably) exceed the maximum of MINIMUM_NEIGHBORHOOD_BATCH_SIZE and the total size of the
+     *  neighborhoods at the beginning of the batch.
+     *
+     *  @param[in] firstPosition    The position of the first appended hyperedge within the records of the hyperedges.
      */
-    void reset(void)
+    void updateNeighborhoods(htd::index_t firstPosition)
     {
-        size_ = 0;
+        std::vector<std::size_t> offsets(neighborhood_.size() + 1, 0);
 
-        next_edge_ = htd::Id::FIRST;
+        std::vector<htd::vertex_t> buffer;
 
-        next_vertex_ = htd::Vertex::FIRST;
+        std::vector<htd::index_t> marks(neighborhood_.size(), 0);
 
-        vertices_.clear();
+        htd::index_t batchBegin = firstPosition;
 
-        selfLoops_.clear();
+        std::size_t neighborhoodSize = 0;
 
-        deletions_.clear();
+        for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
+        {
+            neighborhoodSize += currentNeighborhood.size();
+        }
 
-        edges_->clear();
+        htd::vertex_t sortingBuffer[2];
 
-        neighborhood_.clear();
-    }
+        while (batchBegin < records_.size())
+        {
+            std::fill(offsets.begin(), offsets.end(), 0);
 
-    /**
-     *  The management instance to which the current object instance belongs.
-     */
-    const htd::LibraryInstance * managementInstance_;
+            std::size_t batchSize = std::max(static_cast<std::size_t>(MINIMUM_NEIGHBORHOOD_BATCH_SIZE), neighborhoodSize);
 
-    /**
-     *  The number of vertices of the multi-hypergraph.
-     */
-    std::size_t size_;
+            std::size_t entryCount = 0;
 
-    /**
-     *  The ID the next edge added to the graph will get.
-     */
-    htd::id_t next_edge_;
+            htd::index_t batchEnd = batchBegin;
 
-    /**
-     *  The ID the next vertex added to the graph will get.
-     */
-    htd::vertex_t next_vertex_;
+            for (; batchEnd < records_.size() && (entryCount < batchSize || batchEnd == batchBegin); ++batchEnd)
+            {
+                const HyperedgeRecord & record = records_[batchEnd];
 
-    /**
-     *  The vector of all vertices in the graph sorted in ascending order.
-     */
-    std::vector<htd::vertex_t> vertices_;
+                if (record.size > 1)
+                {
+                    const VertexRange & sortedElements = this->sortedElements(record, sortingBuffer);
 
-    /**
-     *  The set of vertices which have self-loops.
-     */
-    std::unordered_set<htd::vertex_t> selfLoops_;
+                    for (htd::vertex_t vertex : sortedElements)
+                    {
+                        offsets[vertex - htd::Vertex::FIRST + 1] += sortedElements.size();
+                    }
 
-    /**
-     *  The set of vertices which were removed from the graph.
-     */
-    std::unordered_set<htd::vertex_t> deletions_;
+                    entryCount += sortedElements.size() * sortedElements.size();
+                }
+            }
 
-    /**
-     *  The collection of hyperedges sorted by ID in ascending order.
-     */
-    std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
+            for (htd::index_t index = 1; index < offsets.size(); ++index)
+            {
+                offsets[index] += offsets[index - 1];
+            }
 
-    /**
-     *  The vector of neighbors for each vertex in the hypergraph. The neighborhood of each vertex is sorted in ascending order.
-     */
-    std::vector<std::vector<htd::vertex_t>> neighborhood_;
+            buffer.resize(entryCount);
+
+            std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+
+            for (htd::index_t index = batchBegin; index < batchEnd; ++index)
+            {
+                const HyperedgeRecord & record = records_[index];
+
+                if (record.size > 1)
+                {
+                    const VertexRange & sortedElements = this->sortedElements(record, sortingBuffer);
+
+                    for (htd::vertex_t vertex : sortedElements)
+                    {
+                        std::size_t & position = positions[vertex - htd::Vertex::FIRST];
+
+                        std::copy(sortedElements.begin(), sortedElements.end(), buffer.begin() + position);
+
+                        position += sortedElements.size();
+                    }
+                }
+            }
+
+            for (htd::index_t index = 0; index < neighborhood_.size(); ++index)
+            {
+                if (offsets[index] != offsets[index + 1])
+                {
+                    htd::vertex_t vertex = static_cast<htd::vertex_t>(index + htd::Vertex::FIRST);
+
+                    auto begin = buffer.begin() + offsets[index];
+
+                    auto end = buffer.begin() + offsets[index + 1];
+
+                    /* Long runs of new neighbors typically stem from vertices of high degree and contain many duplicates which are cheaper to remove before sorting. */
+                    if (end - begin > 256)
+                    {
+                        auto last = begin;
+
+                        for (auto it = begin; it != end; ++it)
+                        {
+                            htd::index_t & mark = marks[*it - htd::Vertex::FIRST];
+
+                            if (mark != index + 1)
+                            {
+                                mark = index + 1;
+
+                                *(last++) = *it;
+                            }
+                        }
+
+                        end = last;
+                    }
+
+                    std::sort(begin, end);
+
+                    end = std::unique(begin, end);
+
+                    if (selfLoops_.count(vertex) == 0)
+                    {
+                        auto position = std::lower_bound(begin, end, vertex);
+
+                        if (position != end && *position == vertex)
+                        {
+                            end = std::copy(position + 1, end, position);
+                        }
+                    }
+
+                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[index];
+
+                    neighborhoodSize -= currentNeighborhood.size();
+
+                    if (currentNeighborhood.empty())
+                    {
+                        currentNeighborhood.assign(begin, end);
+                    }
+                    else
+                    {
+                        std::size_t oldSize = currentNeighborhood.size();
+
+                        currentNeighborhood.resize(oldSize + static_cast<std::size_t>(end - begin));
+
+                        /* Merge both sorted sequences from the back so that no additional buffer is needed. */
+                        auto target = currentNeighborhood.end();
+
+                        auto current = currentNeighborhood.begin() + oldSize;
+
+                        while (end != begin)
+                        {
+                            if (current != currentNeighborhood.begin() && *(current - 1) > *(end - 1))
+                            {
+                                *(--target) = *(--current);
+                            }
+                            else
+                            {
+                                *(--target) = *(--end);
+                            }
+                        }
+
+                        currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+                    }
+
+                    neighborhoodSize += currentNeighborhood.size();
+                }
+            }
+
+            batchBegin = batchEnd;
+        }
+    }
 };
 
 htd::MultiHypergraph::MultiHypergraph(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -189,24 +1226,14 @@ std::size_t htd::MultiHypergraph::vertexCount(void) const
 
 std::size_t htd::MultiHypergraph::edgeCount(void) const
 {
-    return implementation_->edges_->size();
+    return implementation_->records_.size();
 }
 
 std::size_t htd::MultiHypergraph::edgeCount(htd::vertex_t vertex) const
 {
-    std::size_t ret = 0;
-
     HTD_ASSERT(isVertex(vertex))
 
-    for (const htd::Hyperedge & edge : *(implementation_->edges_))
-    {
-        if (edge.contains(vertex))
-        {
-            ret++;
-        }
-    }
-
-    return ret;
+    return implementation_->edgeIndex().incidentEdges[vertex - htd::Vertex::FIRST].size();
 }
 
 bool htd::MultiHypergraph::isVertex(htd::vertex_t vertex) const
@@ -216,14 +1243,7 @@ bool htd::MultiHypergraph::isVertex(htd::vertex_t vertex) const
 
 bool htd::MultiHypergraph::isEdge(htd::id_t edgeId) const
 {
-    bool ret = false;
-
-    for (auto it = implementation_->edges_->begin(); !ret && it != implementation_->edges_->end(); ++it)
-    {
-        ret = (it->id() == edgeId);
-    }
-
-    return ret;
+    return implementation_->position(edgeId) < implementation_->records_.size();
 }
 
 bool htd::MultiHypergraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
@@ -238,14 +1258,11 @@ bool htd::MultiHypergraph::isEdge(const std::vector<htd::vertex_t> & elements) c
 
 bool htd::MultiHypergraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
 {
-    bool ret = false;
+    std::vector<htd::id_t> result;
 
-    for (auto it = implementation_->edges_->begin(); !ret && it != implementation_->edges_->end(); ++it)
-    {
-        ret = it->size() == elements.size() && htd::equal(it->begin(), it->end(), elements.begin(), elements.end());
-    }
+    implementation_->findHyperedges(elements.begin(), elements.end(), elements.size(), result, 1);
 
-    return ret;
+    return !result.empty();
 }
 
 htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
@@ -254,15 +1271,9 @@ htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(htd::ver
 
     if (isNeighbor(vertex1, vertex2))
     {
-        auto & result = ret.container();
+        const std::array<htd::vertex_t, 2> elements { { vertex1, vertex2 } };
 
-        for (const htd::Hyperedge & edge : hyperedges())
-        {
-            if (edge.size() == 2 && edge[0] == vertex1 && edge[1] == vertex2)
-            {
-                result.push_back(edge.id());
-            }
-        }
+        implementation_->findHyperedges(elements.begin(), elements.end(), elements.size(), ret.container(), static_cast<std::size_t>(-1));
     }
 
     return htd::ConstCollection<htd::id_t>::getInstance(ret);
@@ -272,15 +1283,7 @@ htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(const st
 {
     htd::VectorAdapter<htd::id_t> ret;
 
-    auto & result = ret.container();
-
-    for (const htd::Hyperedge & edge : hyperedges())
-    {
-        if (edge.size() == elements.size() && htd::equal(edge.begin(), edge.end(), elements.begin(), elements.end()))
-        {
-            result.push_back(edge.id());
-        }
-    }
+    implementation_->findHyperedges(elements.begin(), elements.end(), elements.size(), ret.container(), static_cast<std::size_t>(-1));
 
     return htd::ConstCollection<htd::id_t>::getInstance(ret);
 }
@@ -289,15 +1292,7 @@ htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(const ht
 {
     htd::VectorAdapter<htd::id_t> ret;
 
-    auto & result = ret.container();
-
-    for (const htd::Hyperedge & edge : hyperedges())
-    {
-        if (edge.size() == elements.size() && htd::equal(edge.begin(), edge.end(), elements.begin(), elements.end()))
-        {
-            result.push_back(edge.id());
-        }
-    }
+    implementation_->findHyperedges(elements.begin(), elements.end(), elements.size(), ret.container(), static_cast<std::size_t>(-1));
 
     return htd::ConstCollection<htd::id_t>::getInstance(ret);
 }
@@ -316,9 +1311,9 @@ bool htd::MultiHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighb
     }
     else
     {
-        for (auto it = implementation_->edges_->begin(); !ret && it != implementation_->edges_->end(); ++it)
+        for (auto it = implementation_->records_.begin(); !ret && it != implementation_->records_.end(); ++it)
         {
-            const htd::Hyperedge & edge = *it;
+            const Implementation::VertexRange & edge = implementation_->elements(*it);
 
             if (std::count_if(edge.begin(), edge.end(), [&](htd::vertex_t element) { return element == vertex; }) >= 2)
             {
@@ -457,6 +1452,13 @@ void htd::MultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd
     target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
 }
 
+const std::vector<htd::vertex_t> & htd::MultiHypergraph::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+}
+
 htd::vertex_t htd::MultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -515,14 +1517,7 @@ htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::isolatedVertices(void)
 
     for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        bool isolated = true;
-
-        for (auto it = implementation_->edges_->begin(); isolated && it != implementation_->edges_->end(); it++)
-        {
-            isolated = (*it).size() <= 1 || std::find((*it).begin(), (*it).end(), vertex) == (*it).end();
-        }
-
-        if (isolated)
+        if (isIsolatedVertex(vertex))
         {
             result.push_back(vertex);
         }
@@ -550,9 +1545,11 @@ bool htd::MultiHypergraph::isIsolatedVertex(htd::vertex_t vertex) const
 
     bool ret = true;
 
-    for (auto it = implementation_->edges_->begin(); ret && it != implementation_->edges_->end(); it++)
+    const std::vector<htd::id_t> & incidentEdges = implementation_->edgeIndex().incidentEdges[vertex - htd::Vertex::FIRST];
+
+    for (auto it = incidentEdges.begin(); ret && it != incidentEdges.end(); ++it)
     {
-        ret = (*it).size() <= 1 || std::find((*it).begin(), (*it).end(), vertex) == (*it).end();
+        ret = implementation_->record(*it).size <= 1;
     }
 
     return ret;
@@ -560,7 +1557,7 @@ bool htd::MultiHypergraph::isIsolatedVertex(htd::vertex_t vertex) const
 
 htd::ConstCollection<htd::Hyperedge> htd::MultiHypergraph::hyperedges(void) const
 {
-    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->edges_));
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->hyperedges()));
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::MultiHypergraph::hyperedges(htd::vertex_t vertex) const
@@ -571,12 +1568,13 @@ htd::ConstCollection<htd::Hyperedge> htd::MultiHypergraph::hyperedges(htd::verte
 
     auto & result = ret.container();
 
-    for (auto & edge : *(implementation_->edges_))
+    const std::vector<htd::id_t> & incidentEdges = implementation_->edgeIndex().incidentEdges[vertex - htd::Vertex::FIRST];
+
+    result.reserve(incidentEdges.size());
+
+    for (htd::id_t edgeId : incidentEdges)
     {
-        if (edge.contains(vertex))
-        {
-            result.push_back(edge);
-        }
+        result.push_back(implementation_->createHyperedge(implementation_->record(edgeId)));
     }
 
     return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
@@ -584,46 +1582,40 @@ htd::ConstCollection<htd::Hyperedge> htd::MultiHypergraph::hyperedges(htd::verte
 
 const htd::Hyperedge & htd::MultiHypergraph::hyperedge(htd::id_t edgeId) const
 {
-    bool found = false;
-
-    auto position = implementation_->edges_->begin();
+    htd::index_t position = implementation_->position(edgeId);
 
-    for (auto it = implementation_->edges_->begin(); !found && it != implementation_->edges_->end(); ++it)
-    {
-        if (it->id() == edgeId)
-        {
-            position = it;
+    HTD_ASSERT(position < implementation_->records_.size())
 
-            found = true;
-        }
-    }
+    return (*(implementation_->hyperedges()))[position];
+}
 
-    HTD_ASSERT(found)
+const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->records_.size())
 
-    return *position;
+    return implementation_->hyperedges()->at(index);
 }
 
-const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t index) const
+void htd::MultiHypergraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
 {
-    HTD_ASSERT(index < implementation_->edges_->size())
+    HTD_ASSERT(index < implementation_->records_.size())
 
-    return implementation_->edges_->at(index);
+    htd::vertex_t buffer[2];
+
+    const Implementation::VertexRange & elements = implementation_->sortedElements(implementation_->records_[index], buffer);
+
+    target.insert(target.end(), elements.begin(), elements.end());
 }
 
 const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
-    for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
+    if (vertex != htd::Vertex::UNKNOWN && vertex < implementation_->next_vertex_)
     {
-        const htd::Hyperedge & hyperedge = *it;
+        const std::vector<htd::id_t> & incidentEdges = implementation_->edgeIndex().incidentEdges[vertex - htd::Vertex::FIRST];
 
-        if (hyperedge.contains(vertex))
+        if (index < incidentEdges.size())
         {
-            if (index == 0)
-            {
-                return hyperedge;
-            }
-
-            --index;
+            return (*(implementation_->hyperedges()))[implementation_->position(incidentEdges[index])];
         }
     }
 
@@ -632,12 +1624,12 @@ const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t in
 
 htd::FilteredHyperedgeCollection htd::MultiHypergraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
 {
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), indices);
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->hyperedges()), indices);
 }
 
 htd::FilteredHyperedgeCollection htd::MultiHypergraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
 {
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), std::move(indices));
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->hyperedges()), std::move(indices));
 }
 
 htd::vertex_t htd::MultiHypergraph::nextVertex(void) const
@@ -660,6 +1652,8 @@ htd::vertex_t htd::MultiHypergraph::addVertex(void)
 
     implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
 
+    implementation_->indexVertices();
+
     implementation_->vertices_.push_back(ret);
 
     return ret;
@@ -684,6 +1678,8 @@ htd::vertex_t htd::MultiHypergraph::addVertices(std::size_t count)
 
         implementation_->neighborhood_.resize(implementation_->neighborhood_.size() + count, std::vector<htd::vertex_t>());
 
+        implementation_->indexVertices();
+
         implementation_->size_ += count;
     }
     else
@@ -698,27 +1694,34 @@ void htd::MultiHypergraph::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::index_t currentIndex = 0;
+    implementation_->invalidateEdgeIndex();
 
     std::vector<htd::index_t> emptyEdges;
 
-    for (auto & edge : *(implementation_->edges_))
-    {
-        edge.erase(vertex);
+    bool hyperedgesAvailable = implementation_->edgesAvailable_.load(std::memory_order_relaxed);
 
-        if (edge.empty())
+    for (htd::index_t index = 0; index < implementation_->records_.size(); ++index)
+    {
+        if (implementation_->contains(implementation_->records_[index], vertex))
         {
-            emptyEdges.push_back(currentIndex);
-        }
+            implementation_->eraseFromHyperedge(index, vertex);
 
-        ++currentIndex;
-    }
+            if (hyperedgesAvailable)
+            {
+                (*(implementation_->edges_))[index].erase(vertex);
+            }
 
-    for (auto it = emptyEdges.rbegin(); it != emptyEdges.rend(); ++it)
-    {
-        implementation_->edges_->erase(implementation_->edges_->begin() + *it);
+            if (implementation_->records_[index].size == 0)
+            {
+                emptyEdges.push_back(index);
+            }
+        }
     }
 
+    implementation_->eraseHyperedges(emptyEdges);
+
+    implementation_->compactEdgeElements();
+
     implementation_->selfLoops_.erase(vertex);
 
     implementation_->deletions_.insert(vertex);
@@ -746,7 +1749,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::vertex_t vertex1, htd::vertex_t ver
 {
     HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, vertex1, vertex2);
+    implementation_->storeHyperedge(implementation_->next_edge_, vertex1, vertex2);
 
     if (vertex1 != vertex2)
     {
@@ -795,7 +1798,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
         {
             HTD_ASSERT(isVertex(elements[0]))
 
-            implementation_->edges_->emplace_back(implementation_->next_edge_, elements[0]);
+            implementation_->storeHyperedge(implementation_->next_edge_, elements[0]);
 
             return implementation_->next_edge_++;
         }
@@ -857,7 +1860,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
         }
     }
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
+    implementation_->storeHyperedge(implementation_->next_edge_, elements, sortedElements);
 
     return implementation_->next_edge_++;
 }
@@ -877,7 +1880,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
         {
             HTD_ASSERT(isVertex(hyperedge[0]))
 
-            implementation_->edges_->emplace_back(implementation_->next_edge_, hyperedge.elements());
+            implementation_->storeHyperedge(implementation_->next_edge_, hyperedge[0]);
 
             return implementation_->next_edge_++;
         }
@@ -898,8 +1901,6 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
         HTD_ASSERT(isVertex(vertex));
     }
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, hyperedge.elements());
-
     std::vector<htd::vertex_t> sortedElements(hyperedge.begin(), hyperedge.end());
 
     std::sort(sortedElements.begin(), sortedElements.end());
@@ -913,6 +1914,8 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
 
     sortedElements.erase(position, sortedElements.end());
 
+    implementation_->storeHyperedge(implementation_->next_edge_, hyperedge.elements(), sortedElements);
+
     std::vector<htd::vertex_t> newNeighborhood;
 
     for (htd::vertex_t vertex : sortedElements)
@@ -946,9 +1949,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
         {
             HTD_ASSERT(isVertex(hyperedge[0]))
 
-            hyperedge.setId(implementation_->next_edge_);
-
-            implementation_->edges_->emplace_back(std::move(hyperedge));
+            implementation_->storeHyperedge(implementation_->next_edge_, hyperedge[0]);
 
             return implementation_->next_edge_++;
         }
@@ -969,13 +1970,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
         HTD_ASSERT(isVertex(vertex));
     }
 
-    htd::Hyperedge newHyperedge(std::move(hyperedge));
-
-    newHyperedge.setId(implementation_->next_edge_);
-
-    implementation_->edges_->emplace_back(newHyperedge);
-
-    std::vector<htd::vertex_t> sortedElements(newHyperedge.begin(), newHyperedge.end());
+    std::vector<htd::vertex_t> sortedElements(hyperedge.begin(), hyperedge.end());
 
     std::sort(sortedElements.begin(), sortedElements.end());
 
@@ -988,6 +1983,8 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
     sortedElements.erase(position, sortedElements.end());
 
+    implementation_->storeHyperedge(implementation_->next_edge_, hyperedge.elements(), sortedElements);
+
     std::vector<htd::vertex_t> newNeighborhood;
 
     for (htd::vertex_t vertex : sortedElements)
@@ -1011,25 +2008,66 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
     return implementation_->next_edge_++;
 }
 
-void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets)
 {
-    bool found = false;
+    htd::id_t ret = implementation_->next_edge_;
 
-    auto position = implementation_->edges_->begin();
+    htd::index_t firstPosition = implementation_->records_.size();
 
-    for (auto it = implementation_->edges_->begin(); !found && it != implementation_->edges_->end(); ++it)
+    std::vector<htd::vertex_t> buffer;
+
+    for (htd::index_t index = 0; index + 1 < offsets.size(); ++index)
     {
-        if (it->id() == edgeId)
-        {
-            position = it;
+        HTD_ASSERT(offsets[index] < offsets[index + 1] && offsets[index + 1] <= elements.size())
 
-            found = true;
+        #ifndef NDEBUG
+        for (htd::index_t position = offsets[index]; position < offsets[index + 1]; ++position)
+        {
+            HTD_ASSERT(isVertex(elements[position]))
         }
+        #endif
+
+        implementation_->appendHyperedge(implementation_->next_edge_, elements.begin() + offsets[index], elements.begin() + offsets[index + 1], buffer);
+
+        ++(implementation_->next_edge_);
+    }
+
+    implementation_->updateNeighborhoods(firstPosition);
+
+    return ret;
+}
+
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    htd::id_t ret = implementation_->next_edge_;
+
+    htd::index_t firstPosition = implementation_->records_.size();
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        HTD_ASSERT(isVertex(edge.first) && isVertex(edge.second))
+
+        implementation_->appendHyperedge(implementation_->next_edge_, edge.first, edge.second);
+
+        ++(implementation_->next_edge_);
     }
 
-    if (found)
+    implementation_->updateNeighborhoods(firstPosition);
+
+    return ret;
+}
+
+void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
+{
+    htd::index_t position = implementation_->position(edgeId);
+
+    if (position < implementation_->records_.size())
     {
-        const htd::Hyperedge & hyperedge = *position;
+        const Implementation::HyperedgeRecord record = implementation_->records_[position];
+
+        const Implementation::VertexRange & hyperedge = implementation_->elements(record);
+
+        const Implementation::EdgeIndex & index = implementation_->edgeIndex();
 
         for (htd::vertex_t vertex : hyperedge)
         {
@@ -1037,12 +2075,14 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 
             bool selfLoopExists = false;
 
-            for (auto it = implementation_->edges_->begin(); !missing.empty() && it != implementation_->edges_->end(); it++)
-            {
-                htd::Hyperedge & currentEdge = *it;
+            const std::vector<htd::id_t> & incidentEdges = index.incidentEdges[vertex - htd::Vertex::FIRST];
 
-                if (it != position && currentEdge.contains(vertex))
+            for (auto it = incidentEdges.begin(); !missing.empty() && it != incidentEdges.end(); it++)
+            {
+                if (*it != edgeId)
                 {
+                    const Implementation::VertexRange & currentEdge = implementation_->elements(implementation_->record(*it));
+
                     std::size_t occurrences = 0;
 
                     for (htd::vertex_t vertex2 : currentEdge)
@@ -1093,7 +2133,9 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
             }
         }
 
-        implementation_->edges_->erase(position);
+        implementation_->unindexHyperedge(record);
+
+        implementation_->eraseHyperedges(std::vector<htd::index_t> { position });
     }
 }
 
@@ -1147,7 +2189,7 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
     {
         implementation_->reset();
 
-        for (htd::vertex_t vertex : original.vertices())
+        for (htd::vertex_t vertex : original.vertexVector())
         {
             while (vertex > implementation_->next_vertex_)
             {
@@ -1167,12 +2209,16 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
             implementation_->vertices_.push_back(vertex);
         }
 
+        std::vector<htd::vertex_t> buffer;
+
         for (const htd::Hyperedge & hyperedge : original.hyperedges())
         {
-            implementation_->next_edge_ = hyperedge.id();
+            implementation_->appendHyperedge(hyperedge.id(), hyperedge.begin(), hyperedge.end(), buffer);
 
-            addEdge(hyperedge);
+            implementation_->next_edge_ = hyperedge.id() + 1;
         }
+
+        implementation_->updateNeighborhoods(0);
     }
 
     return *this;
@@ -36,9 +36,11 @@
 #include <htd/Algorithm.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 
@@ -72,13 +74,23 @@ struct htd::Path::Implementation
          */
         std::vector<htd::id_t> edges;
 
+        /**
+         *  The sorted neighbors of the path node. It is only materialized on demand.
+         */
+        mutable std::vector<htd::vertex_t> neighborhood;
+
+        /**
+         *  The child of the path node as a vector of size zero or one. It is only materialized on demand.
+         */
+        mutable std::vector<htd::vertex_t> children;
+
         /**
          *  Constructor for a path node.
          *
          *  @param[in] id       The ID of the constructed path node.
          *  @param[in] parent   The parent of the constructed path node.
          */
-        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), child(htd::Vertex::UNKNOWN), edges()
+        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), child(htd::Vertex::UNKNOWN), edges(), neighborhood(), children()
         {
 
         }
@@ -89,7 +101,7 @@ struct htd::Path::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>()), neighborhoodValid_(false), neighborhoodMutex_()
     {
 
     }
@@ -122,7 +134,9 @@ struct htd::Path::Implementation
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
           nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          edges_(std::make_shared<std::deque<htd::Hyperedge *>>()),
+          neighborhoodValid_(false),
+          neighborhoodMutex_()
     {
         nodes_.reserve(original.nodes_.size());
 
@@ -163,6 +177,8 @@ struct htd::Path::Implementation
         next_vertex_ = htd::Vertex::FIRST;
 
         vertices_.clear();
+
+        invalidateNeighborhood();
     }
 
     /**
@@ -205,6 +221,68 @@ struct htd::Path::Implementation
      */
     std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
 
+    /**
+     *  A boolean flag indicating whether the members neighborhood and children of all path nodes reflect the current structure of the path.
+     */
+    mutable std::atomic<bool> neighborhoodValid_;
+
+    /**
+     *  Mutex used to synchronize the lazy materialization of the neighborhoods.
+     */
+    mutable std::mutex neighborhoodMutex_;
+
+    /**
+     *  Access the node information of a vertex, materializing the neighborhoods and children of all path nodes if necessary.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The node information of the vertex.
+     */
+    const Node & materializedNode(htd::vertex_t vertex) const
+    {
+        if (!neighborhoodValid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(neighborhoodMutex_);
+
+            if (!neighborhoodValid_.load(std::memory_order_relaxed))
+            {
+                for (const auto & node : nodes_)
+                {
+                    Node & currentNode = *(node.second);
+
+                    currentNode.neighborhood.clear();
+                    currentNode.children.clear();
+
+                    if (currentNode.parent != htd::Vertex::UNKNOWN)
+                    {
+                        currentNode.neighborhood.push_back(currentNode.parent);
+                    }
+
+                    if (currentNode.child != htd::Vertex::UNKNOWN)
+                    {
+                        currentNode.neighborhood.push_back(currentNode.child);
+
+                        currentNode.children.push_back(currentNode.child);
+                    }
+
+                    std::sort(currentNode.neighborhood.begin(), currentNode.neighborhood.end());
+                }
+
+                neighborhoodValid_.store(true, std::memory_order_release);
+            }
+        }
+
+        return *(nodes_.at(vertex));
+    }
+
+    /**
+     *  Mark the materialized neighborhoods and children as outdated. This function must be called whenever the structure of the path changes.
+     */
+    void invalidateNeighborhood(void)
+    {
+        neighborhoodValid_.store(false, std::memory_order_release);
+    }
+
     /**
      *  Delete a node of the path and perform an update of the internal state.
      *
@@ -458,6 +536,13 @@ void htd::Path::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
     std::sort(target.begin() + size, target.end());
 }
 
+const std::vector<htd::vertex_t> & htd::Path::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->materializedNode(vertex).neighborhood;
+}
+
 htd::vertex_t htd::Path::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -591,6 +676,15 @@ const htd::Hyperedge & htd::Path::hyperedgeAtPosition(htd::index_t index) const
     return *(implementation_->edges_->at(index));
 }
 
+void htd::Path::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(index < implementation_->edges_->size())
+
+    const std::vector<htd::vertex_t> & elements = implementation_->edges_->at(index)->sortedElements();
+
+    target.insert(target.end(), elements.begin(), elements.end());
+}
+
 const htd::Hyperedge & htd::Path::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
@@ -706,6 +800,13 @@ void htd::Path::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
     }
 }
 
+const std::vector<htd::vertex_t> & htd::Path::childVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->materializedNode(vertex).children;
+}
+
 htd::vertex_t htd::Path::child(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -793,6 +894,8 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     auto & node = *(implementation_->nodes_.at(vertex));
 
     auto end = implementation_->edges_->end();
@@ -882,6 +985,8 @@ void htd::Path::removeSubpath(htd::vertex_t subpathRoot)
 {
     HTD_ASSERT(isVertex(subpathRoot))
 
+    implementation_->invalidateNeighborhood();
+
     htd::PostOrderTreeTraversal treeTraversal;
 
     treeTraversal.traverse(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubPathRoot)
@@ -895,6 +1000,8 @@ void htd::Path::removeSubpath(htd::vertex_t subpathRoot)
 
 htd::vertex_t htd::Path::insertRoot(void)
 {
+    implementation_->invalidateNeighborhood();
+
     if (implementation_->root_ == htd::Vertex::UNKNOWN)
     {
         implementation_->root_ = htd::Vertex::FIRST;
@@ -915,6 +1022,8 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
     Implementation::Node & node = *(implementation_->nodes_.at(vertex));
@@ -993,6 +1102,8 @@ void htd::Path::removeChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
 
     HTD_ASSERT(child != htd::Vertex::UNKNOWN)
@@ -1005,6 +1116,8 @@ void htd::Path::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
+    implementation_->invalidateNeighborhood();
+
     const auto & node = implementation_->nodes_.at(vertex);
 
     if (node->child == child)
@@ -1017,6 +1130,8 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
     if (isRoot(vertex))
@@ -1179,6 +1294,8 @@ void htd::Path::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     Implementation::Node & node = *(implementation_->nodes_.at(vertex));
 
     htd::vertex_t parent = node.parent;
@@ -57,7 +57,7 @@ htd::PathDecomposition::PathDecomposition(const htd::ILabeledPath & original) :
 
 htd::PathDecomposition::PathDecomposition(const htd::IPathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagContent_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
         bagContent_[vertex] = original.bagContent(vertex);
         inducedEdges_[vertex] = original.inducedHyperedges(vertex);
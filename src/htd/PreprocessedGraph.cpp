@@ -32,6 +32,8 @@
 #include <htd/VectorAdapter.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <stack>
 #include <unordered_set>
 #include <vector>
@@ -57,8 +59,10 @@ struct htd::PreprocessedGraph::Implementation
                    std::vector<htd::vertex_t> && remainingVertices,
                    std::size_t inputGraphEdgeCount,
                    std::size_t minTreeWidth)
-        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
+        : names_(std::move(vertexNames)), neighborhood_(), compressedNeighborhood_(neighborhood), neighborhoodValid_(false), compressedNeighborhoodValid_(true), mutex_(), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), eliminationSequenceWidth_(0), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
     {
+        std::vector<std::vector<htd::vertex_t>>().swap(neighborhood);
+
         updateEdgeCount();
     }
 
@@ -68,7 +72,7 @@ struct htd::PreprocessedGraph::Implementation
      *  @param[in] original  The original implementation details structure.
      */
     Implementation(const Implementation & original)
-        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
+        : names_(original.names_), neighborhood_(), compressedNeighborhood_(original.compressed()), neighborhoodValid_(false), compressedNeighborhoodValid_(true), mutex_(), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), eliminationSequenceWidth_(original.eliminationSequenceWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
     {
 
     }
@@ -84,9 +88,29 @@ struct htd::PreprocessedGraph::Implementation
     std::vector<htd::vertex_t> names_;
 
     /**
-     *  A vector containing the neighborhood of each of the vertices.
+     *  A vector containing the neighborhood of each of the vertices. It is only materialized on demand.
+     */
+    mutable std::vector<std::vector<htd::vertex_t>> neighborhood_;
+
+    /**
+     *  The neighborhood of each of the vertices in compressed sparse row format.
+     */
+    mutable htd::CompressedNeighborhood compressedNeighborhood_;
+
+    /**
+     *  A boolean flag indicating whether the member neighborhood_ reflects the current neighborhoods.
+     */
+    mutable std::atomic<bool> neighborhoodValid_;
+
+    /**
+     *  A boolean flag indicating whether the member compressedNeighborhood_ reflects the current neighborhoods.
      */
-    std::vector<std::vector<htd::vertex_t>> neighborhood_;
+    mutable std::atomic<bool> compressedNeighborhoodValid_;
+
+    /**
+     *  Mutex used to synchronize the lazy conversion between both neighborhood representations.
+     */
+    mutable std::mutex mutex_;
 
     /**
      *  A partial vertex elimination ordering computed during the preprocessing phase.
@@ -103,6 +127,11 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::size_t minTreeWidth_;
 
+    /**
+     *  The width induced by eliminating the vertices of the partial elimination ordering as far as it exceeds minTreeWidth_.
+     */
+    std::size_t eliminationSequenceWidth_;
+
     /**
      *  The number of edges in the preprocessed graph.
      */
@@ -118,15 +147,77 @@ struct htd::PreprocessedGraph::Implementation
      */
     void updateEdgeCount(void)
     {
+        const htd::CompressedNeighborhood & currentNeighborhood = compressed();
+
         edgeCount_ = 0;
 
         for (htd::vertex_t vertex : remainingVertices_)
         {
-            edgeCount_ += neighborhood_[vertex].size();
+            edgeCount_ += currentNeighborhood.neighborCount(vertex);
         }
 
         edgeCount_ = edgeCount_ >> 1;
     }
+
+    /**
+     *  Access the neighborhoods in compressed sparse row format, (re-)building them if necessary.
+     *
+     *  @return The neighborhoods in compressed sparse row format.
+     */
+    const htd::CompressedNeighborhood & compressed(void) const
+    {
+        if (!compressedNeighborhoodValid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!compressedNeighborhoodValid_.load(std::memory_order_relaxed))
+            {
+                compressedNeighborhood_.assign(neighborhood_);
+
+                compressedNeighborhoodValid_.store(true, std::memory_order_release);
+            }
+        }
+
+        return compressedNeighborhood_;
+    }
+
+    /**
+     *  Access the neighborhoods as one vector per vertex, materializing them if necessary.
+     *
+     *  @return The neighborhoods as one vector per vertex.
+     */
+    const std::vector<std::vector<htd::vertex_t>> & expanded(void) const
+    {
+        if (!neighborhoodValid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!neighborhoodValid_.load(std::memory_order_relaxed))
+            {
+                compressedNeighborhood_.copyTo(neighborhood_);
+
+                neighborhoodValid_.store(true, std::memory_order_release);
+            }
+        }
+
+        return neighborhood_;
+    }
+
+    /**
+     *  Access the neighborhoods as one vector per vertex for modification.
+     *
+     *  @note The compressed representation is invalidated and is re-built from the modified neighborhoods on the next read access.
+     *
+     *  @return The modifiable neighborhoods as one vector per vertex.
+     */
+    std::vector<std::vector<htd::vertex_t>> & mutableNeighborhood(void)
+    {
+        expanded();
+
+        compressedNeighborhoodValid_.store(false, std::memory_order_release);
+
+        return neighborhood_;
+    }
 };
 
 htd::PreprocessedGraph::PreprocessedGraph(std::vector<htd::vertex_t> && vertexNames,
@@ -185,6 +276,11 @@ htd::ConstCollection<htd::vertex_t> htd::PreprocessedGraph::vertices(void) const
     return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->remainingVertices_);
 }
 
+const std::vector<htd::vertex_t> & htd::PreprocessedGraph::vertexVector(void) const
+{
+    return implementation_->remainingVertices_;
+}
+
 void htd::PreprocessedGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     target.insert(target.end(),
@@ -208,11 +304,13 @@ bool htd::PreprocessedGraph::isVertex(htd::vertex_t vertex) const
 
 std::size_t htd::PreprocessedGraph::isolatedVertexCount(void) const
 {
+    const htd::CompressedNeighborhood & currentNeighborhood = implementation_->compressed();
+
     std::size_t ret = 0;
 
     for (htd::vertex_t vertex : implementation_->remainingVertices_)
     {
-        if (implementation_->neighborhood_[vertex].empty())
+        if (currentNeighborhood.neighborCount(vertex) == 0)
         {
             ret++;
         }
@@ -227,9 +325,11 @@ htd::ConstCollection<htd::vertex_t> htd::PreprocessedGraph::isolatedVertices(voi
 
     auto & result = ret.container();
 
+    const htd::CompressedNeighborhood & currentNeighborhood = implementation_->compressed();
+
     for (htd::vertex_t vertex : implementation_->remainingVertices_)
     {
-        if (implementation_->neighborhood_[vertex].empty())
+        if (currentNeighborhood.neighborCount(vertex) == 0)
         {
             result.push_back(vertex);
         }
@@ -255,50 +355,52 @@ bool htd::PreprocessedGraph::isIsolatedVertex(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->neighborhood_[vertex].empty();
+    return implementation_->compressed().neighborCount(vertex) == 0;
 }
 
 std::size_t htd::PreprocessedGraph::neighborCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->neighborhood_[vertex].size();
+    return implementation_->compressed().neighborCount(vertex);
 }
 
 htd::ConstCollection<htd::vertex_t> htd::PreprocessedGraph::neighbors(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood_[vertex]);
+    const htd::CompressedNeighborhood & currentNeighborhood = implementation_->compressed();
+
+    return htd::ConstCollection<htd::vertex_t>(htd::ConstIterator<htd::vertex_t>(currentNeighborhood.begin(vertex)),
+                                               htd::ConstIterator<htd::vertex_t>(currentNeighborhood.end(vertex)));
 }
 
 void htd::PreprocessedGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex];
-
-    target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+    implementation_->compressed().copyNeighborsTo(vertex, target);
 }
 
-htd::vertex_t htd::PreprocessedGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+const std::vector<htd::vertex_t> & htd::PreprocessedGraph::neighborVector(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex];
+    return implementation_->expanded()[vertex];
+}
 
-    HTD_ASSERT(index < currentNeighborhood.size())
+htd::vertex_t htd::PreprocessedGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(isVertex(vertex))
 
-    return currentNeighborhood[index];
+    return implementation_->compressed().neighborAtPosition(vertex, index);
 }
 
 bool htd::PreprocessedGraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
 {
     HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
 
-    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex];
-
-    return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
+    return implementation_->compressed().isNeighbor(vertex, neighbor);
 }
 
 bool htd::PreprocessedGraph::isConnected(void) const
@@ -307,6 +409,8 @@ bool htd::PreprocessedGraph::isConnected(void) const
 
     if (!(implementation_->remainingVertices_.empty()))
     {
+        const htd::CompressedNeighborhood & currentNeighborhood = implementation_->compressed();
+
         std::stack<htd::vertex_t> originStack;
 
         std::unordered_set<htd::vertex_t> visitedVertices;
@@ -325,8 +429,10 @@ bool htd::PreprocessedGraph::isConnected(void) const
 
                 originStack.pop();
 
-                for (htd::vertex_t neighbor : implementation_->neighborhood_[currentVertex])
+                for (auto it = currentNeighborhood.begin(currentVertex); it != currentNeighborhood.end(currentVertex); ++it)
                 {
+                    htd::vertex_t neighbor = *it;
+
                     if (visitedVertices.count(neighbor) == 0)
                     {
                         originStack.push(neighbor);
@@ -366,6 +472,8 @@ bool htd::PreprocessedGraph::isConnected(htd::vertex_t vertex1, htd::vertex_t ve
 
         std::vector<bool> reachableVertices(implementation_->remainingVertices_.size());
 
+        const htd::CompressedNeighborhood & neighborhood = implementation_->compressed();
+
         reachableVertices[vertex1] = true;
 
         newVertices.push_back(vertex1);
@@ -378,9 +486,7 @@ bool htd::PreprocessedGraph::isConnected(htd::vertex_t vertex1, htd::vertex_t ve
 
             for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
             {
-                const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[*it];
-
-                for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
+                for (auto it2 = neighborhood.begin(*it); !ret && it2 != neighborhood.end(*it); ++it2)
                 {
                     htd::vertex_t neighbor = *it2;
 
@@ -407,13 +513,15 @@ void htd::PreprocessedGraph::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex));
 
-    std::vector<htd::vertex_t> & selectedNeighborhood = implementation_->neighborhood_[vertex];
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = implementation_->mutableNeighborhood();
+
+    std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[vertex];
 
     implementation_->edgeCount_ -= selectedNeighborhood.size();
 
     for (htd::vertex_t neighbor : selectedNeighborhood)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[neighbor];
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
 
         /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'currentNeighborhood'. */
         // coverity[use_iterator]
@@ -441,26 +549,31 @@ htd::vertex_t htd::PreprocessedGraph::vertexName(htd::vertex_t vertex) const
 
 std::vector<std::vector<htd::vertex_t>> & htd::PreprocessedGraph::neighborhood(void) HTD_NOEXCEPT
 {
-    return implementation_->neighborhood_;
+    return implementation_->mutableNeighborhood();
 }
 
 const std::vector<std::vector<htd::vertex_t>> & htd::PreprocessedGraph::neighborhood(void) const HTD_NOEXCEPT
 {
-    return implementation_->neighborhood_;
+    return implementation_->expanded();
 }
 
 std::vector<htd::vertex_t> & htd::PreprocessedGraph::neighborhood(htd::vertex_t vertex)
 {
     HTD_ASSERT(vertex < implementation_->names_.size());
 
-    return implementation_->neighborhood_[vertex];
+    return implementation_->mutableNeighborhood()[vertex];
 }
 
 const std::vector<htd::vertex_t> & htd::PreprocessedGraph::neighborhood(htd::vertex_t vertex) const
 {
     HTD_ASSERT(vertex < implementation_->names_.size());
 
-    return implementation_->neighborhood_[vertex];
+    return implementation_->expanded()[vertex];
+}
+
+const htd::CompressedNeighborhood & htd::PreprocessedGraph::compressedNeighborhood(void) const
+{
+    return implementation_->compressed();
 }
 
 void htd::PreprocessedGraph::updateEdgeCount(void)
@@ -507,6 +620,16 @@ std::size_t htd::PreprocessedGraph::minTreeWidth(void) const HTD_NOEXCEPT
     return implementation_->minTreeWidth_;
 }
 
+std::size_t & htd::PreprocessedGraph::eliminationSequenceWidth(void) HTD_NOEXCEPT
+{
+    return implementation_->eliminationSequenceWidth_;
+}
+
+std::size_t htd::PreprocessedGraph::eliminationSequenceWidth(void) const HTD_NOEXCEPT
+{
+    return std::max(implementation_->minTreeWidth_, implementation_->eliminationSequenceWidth_);
+}
+
 htd::PreprocessedGraph * htd::PreprocessedGraph::clone(void) const
 {
     return new htd::PreprocessedGraph(*this);
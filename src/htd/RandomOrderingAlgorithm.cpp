@@ -26,6 +26,7 @@
 #define HTD_HTD_RANDOMORDERINGALGORITHM_CPP
 
 #include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
@@ -106,9 +107,7 @@ htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::
         vertex = preprocessedGraph.vertexName(vertex);
     });
 
-    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-    // coverity[dont_call]
-    std::mt19937 g(static_cast<std::mt19937::result_type>(std::rand()));
+    std::mt19937 g(static_cast<std::mt19937::result_type>(htd::randomNumber()));
 
     std::shuffle(middle, ordering.end(), g);
 
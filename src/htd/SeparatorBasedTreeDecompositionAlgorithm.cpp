@@ -223,7 +223,7 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
 
         for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
         {
-            for (htd::vertex_t vertex : ret->vertices())
+            for (htd::vertex_t vertex : ret->vertexVector())
             {
                 htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
@@ -237,7 +237,7 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
 
         for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
         {
-            for (htd::vertex_t vertex : ret->vertices())
+            for (htd::vertex_t vertex : ret->vertexVector())
             {
                 htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
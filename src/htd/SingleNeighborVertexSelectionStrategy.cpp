@@ -51,7 +51,7 @@ void htd::SingleNeighborVertexSelectionStrategy::selectVertices(const htd::IMult
 {
     std::vector<htd::vertex_t> vertices;
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::vertex_t vertex : graph.vertexVector())
     {
         if (graph.neighborCount(vertex) == 1)
         {
@@ -37,11 +37,12 @@
 #include <htd/Algorithm.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 
 /**
@@ -74,6 +75,14 @@ struct htd::Tree::Implementation
          */
         std::vector<htd::vertex_t> children;
 
+        /**
+         *  Constructor for an unused tree node.
+         */
+        Node(void) : id(htd::Vertex::UNKNOWN), parent(htd::Vertex::UNKNOWN), edges(), children()
+        {
+
+        }
+
         /**
          *  Constructor for a tree node.
          *
@@ -100,10 +109,28 @@ struct htd::Tree::Implementation
          *
          *  @param[in] original  The original tree node.
          */
-        Node(Node && original) : id(original.id), parent(original.parent), edges(std::move(original.edges)), children(std::move(original.children))
+        Node(Node && original) HTD_NOEXCEPT : id(original.id), parent(original.parent), edges(std::move(original.edges)), children(std::move(original.children))
         {
 
         }
+
+        /**
+         *  Copy assignment operator for a tree node.
+         *
+         *  @param[in] original  The original tree node.
+         *
+         *  @return A reference to the modified tree node.
+         */
+        Node & operator=(const Node & original) = default;
+
+        /**
+         *  Move assignment operator for a tree node.
+         *
+         *  @param[in] original  The original tree node.
+         *
+         *  @return A reference to the modified tree node.
+         */
+        Node & operator=(Node && original) HTD_NOEXCEPT = default;
     };
 
     /**
@@ -111,18 +138,13 @@ struct htd::Tree::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>()), neighborhood_(), neighborhoodValid_(false), neighborhoodMutex_()
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         for (htd::Hyperedge * edge : *edges_)
         {
             delete edge;
@@ -141,16 +163,12 @@ struct htd::Tree::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          nodes_(original.nodes_),
+          edges_(std::make_shared<std::deque<htd::Hyperedge *>>()),
+          neighborhood_(),
+          neighborhoodValid_(false),
+          neighborhoodMutex_()
     {
-        nodes_.reserve(original.nodes_.size());
-
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
-
         for (const htd::Hyperedge * edge : *(original.edges_))
         {
             edges_->emplace_back(new htd::Hyperedge(*edge));
@@ -162,11 +180,6 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         nodes_.clear();
 
         for (htd::Hyperedge * edge : *edges_)
@@ -185,6 +198,8 @@ struct htd::Tree::Implementation
         next_vertex_ = htd::Vertex::FIRST;
 
         vertices_.clear();
+
+        invalidateNeighborhood();
     }
 
     /**
@@ -218,21 +233,146 @@ struct htd::Tree::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  The information of all tree nodes, indexed by vertex ID. The entries of vertices which do not (or no longer) exist have the ID htd::Vertex::UNKNOWN.
+     *
+     *  The nodes are kept in a deque so that adding vertices does not relocate existing nodes and references to their children stay valid.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::deque<Node> nodes_;
 
     /**
      *  The collection of all hyperedges which exist in the tree.
      */
     std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
 
+    /**
+     *  The sorted neighborhood of each vertex, indexed by vertex ID. It is only materialized on demand.
+     */
+    mutable std::vector<std::vector<htd::vertex_t>> neighborhood_;
+
+    /**
+     *  A boolean flag indicating whether the member neighborhood_ reflects the current structure of the tree.
+     */
+    mutable std::atomic<bool> neighborhoodValid_;
+
+    /**
+     *  Mutex used to synchronize the lazy materialization of the neighborhoods.
+     */
+    mutable std::mutex neighborhoodMutex_;
+
+    /**
+     *  Access the sorted neighborhood of a vertex, materializing the neighborhoods of all vertices if necessary.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The sorted neighborhood of the vertex.
+     */
+    const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const
+    {
+        if (!neighborhoodValid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(neighborhoodMutex_);
+
+            if (!neighborhoodValid_.load(std::memory_order_relaxed))
+            {
+                neighborhood_.resize(nodes_.size());
+
+                for (std::size_t index = 0; index < nodes_.size(); ++index)
+                {
+                    const Node & currentNode = nodes_[index];
+
+                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[index];
+
+                    currentNeighborhood.clear();
+
+                    if (currentNode.id != htd::Vertex::UNKNOWN)
+                    {
+                        if (currentNode.parent != htd::Vertex::UNKNOWN)
+                        {
+                            currentNeighborhood.push_back(currentNode.parent);
+                        }
+
+                        currentNeighborhood.insert(currentNeighborhood.end(), currentNode.children.begin(), currentNode.children.end());
+
+                        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+                    }
+                }
+
+                neighborhoodValid_.store(true, std::memory_order_release);
+            }
+        }
+
+        return neighborhood_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Mark the materialized neighborhoods as outdated. This function must be called whenever the structure of the tree changes.
+     */
+    void invalidateNeighborhood(void)
+    {
+        neighborhoodValid_.store(false, std::memory_order_release);
+    }
+
+    /**
+     *  Access the node information of a vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The node information of the vertex.
+     */
+    Node & node(htd::vertex_t vertex)
+    {
+        HTD_ASSERT(vertex != htd::Vertex::UNKNOWN && vertex - htd::Vertex::FIRST < nodes_.size() && nodes_[vertex - htd::Vertex::FIRST].id == vertex)
+
+        return nodes_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the node information of a vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The node information of the vertex.
+     */
+    const Node & node(htd::vertex_t vertex) const
+    {
+        HTD_ASSERT(vertex != htd::Vertex::UNKNOWN && vertex - htd::Vertex::FIRST < nodes_.size() && nodes_[vertex - htd::Vertex::FIRST].id == vertex)
+
+        return nodes_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Create the node information of a new vertex.
+     *
+     *  @note References to the node information of other vertices are invalidated by this function.
+     *
+     *  @param[in] vertex   The new vertex.
+     *  @param[in] parent   The parent of the new vertex.
+     *
+     *  @return The node information of the new vertex.
+     */
+    Node & createNode(htd::vertex_t vertex, htd::vertex_t parent)
+    {
+        HTD_ASSERT(vertex != htd::Vertex::UNKNOWN)
+
+        if (vertex - htd::Vertex::FIRST >= nodes_.size())
+        {
+            nodes_.resize(vertex - htd::Vertex::FIRST + 1);
+        }
+
+        Node & ret = nodes_[vertex - htd::Vertex::FIRST];
+
+        ret.id = vertex;
+        ret.parent = parent;
+
+        return ret;
+    }
+
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
-     *  @param[in] node The node of the tree which shall be removed.
+     *  @param[in] vertex   The vertex which shall be removed.
      */
-    void deleteNode(Node * node);
+    void deleteNode(htd::vertex_t vertex);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
@@ -303,7 +443,7 @@ std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Tree::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && vertex - htd::Vertex::FIRST < implementation_->nodes_.size() && implementation_->nodes_[vertex - htd::Vertex::FIRST].id == vertex;
 }
 
 bool htd::Tree::isEdge(htd::id_t edgeId) const
@@ -397,7 +537,7 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->node(vertex);
 
     const auto & children = node.children;
 
@@ -445,7 +585,7 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->node(vertex);
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
@@ -472,7 +612,7 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->node(vertex);
 
     const auto & children = node.children;
 
@@ -486,6 +626,13 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
     std::sort(target.begin() + size, target.end());
 }
 
+const std::vector<htd::vertex_t> & htd::Tree::neighborVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborhood(vertex);
+}
+
 htd::vertex_t htd::Tree::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -605,6 +752,15 @@ const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index) const
     return *(implementation_->edges_->at(index));
 }
 
+void htd::Tree::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(index < implementation_->edges_->size())
+
+    const std::vector<htd::vertex_t> & elements = implementation_->edges_->at(index)->sortedElements();
+
+    target.insert(target.end(), elements.begin(), elements.end());
+}
+
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
@@ -665,7 +821,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->node(vertex).parent;
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,37 +833,44 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->node(vertex).parent == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->node(vertex).children.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->node(vertex).children);
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->node(vertex).children;
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
 
+const std::vector<htd::vertex_t> & htd::Tree::childVector(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->node(vertex).children;
+}
+
 htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->node(vertex).children;
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +882,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->node(vertex).children;
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +920,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->node(vertex).parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->node(currentVertex).parent;
     }
 
     return ret;
@@ -783,7 +946,9 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    implementation_->invalidateNeighborhood();
+
+    Implementation::Node & node = implementation_->node(vertex);
 
     auto end = implementation_->edges_->end();
 
@@ -795,7 +960,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->node(currentVertex).edges;
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -814,7 +979,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        Implementation::Node & parentNode = implementation_->node(node.parent);
 
         auto & siblings = parentNode.children;
 
@@ -828,7 +993,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 htd::vertex_t child = children[0];
 
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                Implementation::Node & childNode = implementation_->node(child);
 
                 childNode.parent = node.parent;
 
@@ -860,7 +1025,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 for (htd::vertex_t child : children)
                 {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->node(child);
 
                     childNode.parent = node.parent;
 
@@ -891,7 +1056,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(vertex);
     }
     else
     {
@@ -914,9 +1079,9 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+                implementation_->node(implementation_->root_).parent = htd::Vertex::UNKNOWN;
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -924,7 +1089,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                Implementation::Node & rootNode = implementation_->node(implementation_->root_);
 
                 rootNode.parent = htd::Vertex::UNKNOWN;
 
@@ -934,7 +1099,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                 {
                     htd::vertex_t child = *it;
 
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->node(child);
 
                     childNode.parent = implementation_->root_;
 
@@ -961,7 +1126,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                     implementation_->next_edge_++;
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -973,6 +1138,8 @@ void htd::Tree::removeSubtree(htd::vertex_t subtreeRoot)
 {
     HTD_ASSERT(isVertex(subtreeRoot))
 
+    implementation_->invalidateNeighborhood();
+
     htd::PostOrderTreeTraversal treeTraversal;
 
     treeTraversal.traverse(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
@@ -986,6 +1153,8 @@ void htd::Tree::removeSubtree(htd::vertex_t subtreeRoot)
 
 htd::vertex_t htd::Tree::insertRoot(void)
 {
+    implementation_->invalidateNeighborhood();
+
     if (implementation_->root_ == htd::Vertex::UNKNOWN)
     {
         implementation_->root_ = htd::Vertex::FIRST;
@@ -995,7 +1164,7 @@ htd::vertex_t htd::Tree::insertRoot(void)
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
         implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->createNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1009,6 +1178,8 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     if (vertex != implementation_->root_)
     {
         implementation_->root_ = vertex;
@@ -1018,7 +1189,7 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 
         while (vertex != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & node = *(implementation_->nodes_[vertex]);
+            Implementation::Node & node = implementation_->node(vertex);
 
             nextVertex = node.parent;
 
@@ -1047,17 +1218,17 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = htd::Vertex::UNKNOWN;
+    implementation_->invalidateNeighborhood();
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
     ret = implementation_->next_vertex_;
 
-    node.children.emplace_back(ret);
+    Implementation::Node & newNode = implementation_->createNode(ret, vertex);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    Implementation::Node & node = implementation_->node(vertex);
 
-    implementation_->nodes_.emplace(ret, newNode);
+    node.children.emplace_back(ret);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -1069,7 +1240,7 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     node.edges.push_back(implementation_->next_edge_);
 
-    newNode->edges.push_back(implementation_->next_edge_);
+    newNode.edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1081,7 +1252,9 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    implementation_->invalidateNeighborhood();
+
+    auto & node = implementation_->node(vertex);
 
     auto & children = node.children;
 
@@ -1110,19 +1283,17 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     HTD_ASSERT(isVertex(vertex))
 
+    implementation_->invalidateNeighborhood();
+
     if (isRoot(vertex))
     {
-        auto & node = implementation_->nodes_.at(vertex);
-
         ret = implementation_->next_vertex_;
 
-        node->parent = ret;
-
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        implementation_->node(vertex).parent = ret;
 
-        newRootNode->children.emplace_back(vertex);
+        Implementation::Node & newRootNode = implementation_->createNode(ret, htd::Vertex::UNKNOWN);
 
-        implementation_->nodes_.emplace(ret, newRootNode);
+        newRootNode.children.emplace_back(vertex);
 
         implementation_->vertices_.emplace_back(ret);
 
@@ -1136,8 +1307,8 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
+        Implementation::Node & parentNode = implementation_->node(parentVertex);
+        Implementation::Node & selectedNode = implementation_->node(vertex);
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
@@ -1170,26 +1341,29 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
+        auto & intermediateNode = implementation_->node(ret);
 
         intermediateNode.parent = parentVertex;
 
         intermediateNode.children.emplace_back(vertex);
 
-        auto position = std::find(parentNode.children.begin(), parentNode.children.end(), vertex);
+        /* The node storage may have been reallocated by addChild, so the node information is re-fetched. */
+        auto & updatedParentNode = implementation_->node(parentVertex);
 
-        if (position != parentNode.children.end())
+        auto position = std::find(updatedParentNode.children.begin(), updatedParentNode.children.end(), vertex);
+
+        if (position != updatedParentNode.children.end())
         {
-            parentNode.children.erase(position);
+            updatedParentNode.children.erase(position);
         }
 
-        selectedNode.parent = ret;
+        implementation_->node(vertex).parent = ret;
     }
 
     implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
+    implementation_->node(vertex).edges.push_back(implementation_->next_edge_);
+    implementation_->node(ret).edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1202,17 +1376,19 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    implementation_->invalidateNeighborhood();
+
+    auto & node = implementation_->node(vertex);
 
     htd::vertex_t oldParent = node.parent;
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
+        auto & newParentNode = implementation_->node(newParent);
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            auto & oldParentNode = implementation_->node(oldParent);
 
             oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
 
@@ -1249,16 +1425,16 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->node(relevantVertex).parent != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->node(relevantVertex).parent;
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            auto & relevantNode = implementation_->node(relevantVertex);
 
             relevantNode.parent = htd::Vertex::UNKNOWN;
 
@@ -1321,9 +1497,9 @@ std::size_t htd::Tree::leafCount(void) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->children.empty())
+        if (implementation_->node(vertex).children.empty())
         {
             ret++;
         }
@@ -1343,11 +1519,11 @@ htd::ConstCollection<htd::vertex_t> htd::Tree::leaves(void) const
 
 void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->children.empty())
+        if (implementation_->node(vertex).children.empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(vertex);
         }
     }
 
@@ -1371,20 +1547,22 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->node(vertex).children.empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    implementation_->invalidateNeighborhood();
+
+    Implementation::Node & node = implementation_->node(vertex);
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = implementation_->node(parent);
 
     node.parent = parentNode.parent;
 
@@ -1402,7 +1580,7 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = implementation_->node(grandParent);
 
         implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
 
@@ -1412,26 +1590,26 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     }
 }
 
-void htd::Tree::Implementation::deleteNode(Node * node)
+void htd::Tree::Implementation::deleteNode(htd::vertex_t vertex)
 {
-    HTD_ASSERT(node != nullptr)
-
-    auto & parent = node->parent;
+    Node & selectedNode = node(vertex);
 
-    htd::vertex_t vertex = node->id;
+    htd::vertex_t parent = selectedNode.parent;
 
     if (parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        auto & children = node(parent).children;
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
 
     vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
 
-    nodes_.erase(vertex);
+    selectedNode.id = htd::Vertex::UNKNOWN;
+    selectedNode.parent = htd::Vertex::UNKNOWN;
 
-    delete node;
+    std::vector<htd::id_t>().swap(selectedNode.edges);
+    std::vector<htd::vertex_t>().swap(selectedNode.children);
 
     size_--;
 }
@@ -1496,12 +1674,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->nodes_ = original.implementation_->nodes_;
 
         implementation_->root_ = original.implementation_->root_;
 
@@ -1551,22 +1724,11 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
-                if (original.isRoot(vertex))
-                {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
-                }
-                else
-                {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
-                }
+                Implementation::Node & newNode = implementation_->createNode(vertex, original.isRoot(vertex) ? htd::Vertex::UNKNOWN : original.parent(vertex));
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
-                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
-
-                implementation_->nodes_.emplace(vertex, newNode);
+                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode.children));
 
                 if (vertex > maximumVertex)
                 {
@@ -36,43 +36,37 @@
 #include <stdexcept>
 #include <unordered_set>
 
-htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledTree::LabeledTree(manager), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledTree::LabeledTree(manager), bagContent_(), exclusiveBags_(), inducedEdges_()
 {
 
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), exclusiveBags_(), inducedEdges_(original.inducedEdges_)
 {
-
+    copyBags(original);
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), exclusiveBags_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
+        createBag(vertex, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
     }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), exclusiveBags_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
+        createBag(vertex, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
     }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), exclusiveBags_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
+    for (htd::vertex_t vertex : original.vertexVector())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
-
-        inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+        createBag(vertex, sharedBag(original.bagContent(vertex), original.isRoot(vertex) ? htd::Vertex::UNKNOWN : original.parent(vertex), htd::Vertex::UNKNOWN), htd::FilteredHyperedgeCollection(original.inducedHyperedges(vertex)));
     }
 }
 
@@ -85,9 +79,7 @@ void htd::TreeDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::Tree::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
-
-    inducedEdges_.erase(vertex);
+    releaseBag(vertex);
 }
 
 void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
@@ -101,9 +93,7 @@ void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        bagContent_.erase(vertex);
-
-        inducedEdges_.erase(vertex);
+        releaseBag(vertex);
     }, subtreeRoot);
 
     htd::Tree::removeSubtree(subtreeRoot);
@@ -117,9 +107,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(void)
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+        createBag(ret, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
     }
 
     return ret;
@@ -133,9 +121,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(const std::vector<htd::vertex_t
 
     if (inserted)
     {
-        bagContent_[ret] = bagContent;
-
-        inducedEdges_[ret] = inducedEdges;
+        createBag(ret, sharedBag(bagContent, htd::Vertex::UNKNOWN, htd::Vertex::UNKNOWN), htd::FilteredHyperedgeCollection(inducedEdges));
     }
 
     return ret;
@@ -149,9 +135,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::move(bagContent));
-
-        inducedEdges_.emplace(ret, std::move(inducedEdges));
+        createBag(ret, sharedBag(std::move(bagContent), htd::Vertex::UNKNOWN, htd::Vertex::UNKNOWN), std::move(inducedEdges));
     }
 
     return ret;
@@ -161,9 +145,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    createBag(ret, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
 
     return ret;
 }
@@ -172,9 +154,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, const std::
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    createBag(ret, sharedBag(bagContent, vertex, htd::Vertex::UNKNOWN), htd::FilteredHyperedgeCollection(inducedEdges));
 
     return ret;
 }
@@ -183,9 +163,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
-
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    createBag(ret, sharedBag(std::move(bagContent), vertex, htd::Vertex::UNKNOWN), std::move(inducedEdges));
 
     return ret;
 }
@@ -194,9 +172,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    createBag(ret, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
 
     return ret;
 }
@@ -205,9 +181,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, const std:
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    createBag(ret, sharedBag(bagContent, vertex, isRoot(ret) ? htd::Vertex::UNKNOWN : parent(ret)), htd::FilteredHyperedgeCollection(inducedEdges));
 
     return ret;
 }
@@ -216,9 +190,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
-
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    createBag(ret, sharedBag(std::move(bagContent), vertex, isRoot(ret) ? htd::Vertex::UNKNOWN : parent(ret)), std::move(inducedEdges));
 
     return ret;
 }
@@ -227,9 +199,7 @@ void htd::TreeDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
 {
     htd::Tree::removeChild(vertex, child);
 
-    bagContent_.erase(child);
-
-    inducedEdges_.erase(child);
+    releaseBag(child);
 }
 
 std::size_t htd::TreeDecomposition::joinNodeCount(void) const
@@ -516,35 +486,49 @@ std::size_t htd::TreeDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagContent_[vertex - htd::Vertex::FIRST]->size();
 }
 
 std::vector<htd::vertex_t> & htd::TreeDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    std::size_t index = vertex - htd::Vertex::FIRST;
+
+    std::shared_ptr<std::vector<htd::vertex_t>> & bag = bagContent_[index];
+
+    if (!exclusiveBags_[index])
+    {
+        if (bag.use_count() > 1)
+        {
+            bag = std::make_shared<std::vector<htd::vertex_t>>(*bag);
+        }
+
+        exclusiveBags_[index] = true;
+    }
+
+    return *bag;
 }
 
 const std::vector<htd::vertex_t> & htd::TreeDecomposition::bagContent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return *(bagContent_[vertex - htd::Vertex::FIRST]);
 }
 
 htd::FilteredHyperedgeCollection & htd::TreeDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return inducedEdges_[vertex - htd::Vertex::FIRST];
 }
 
 const htd::FilteredHyperedgeCollection & htd::TreeDecomposition::inducedHyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return inducedEdges_[vertex - htd::Vertex::FIRST];
 }
 
 std::size_t htd::TreeDecomposition::minimumBagSize(void) const
@@ -999,6 +983,118 @@ void htd::TreeDecomposition::getChildBagSetUnion(htd::vertex_t vertex, std::vect
     }
 }
 
+void htd::TreeDecomposition::createBag(htd::vertex_t vertex, std::shared_ptr<std::vector<htd::vertex_t>> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges)
+{
+    HTD_ASSERT(vertex != htd::Vertex::UNKNOWN)
+
+    std::size_t index = vertex - htd::Vertex::FIRST;
+
+    if (index >= bagContent_.size())
+    {
+        bagContent_.resize(index + 1);
+
+        exclusiveBags_.resize(index + 1, false);
+
+        inducedEdges_.resize(index + 1);
+    }
+
+    bagContent_[index] = std::move(bagContent);
+
+    exclusiveBags_[index] = false;
+
+    inducedEdges_[index] = std::move(inducedEdges);
+}
+
+void htd::TreeDecomposition::releaseBag(htd::vertex_t vertex)
+{
+    std::size_t index = vertex - htd::Vertex::FIRST;
+
+    if (index < bagContent_.size())
+    {
+        bagContent_[index].reset();
+
+        exclusiveBags_[index] = false;
+
+        inducedEdges_[index] = htd::FilteredHyperedgeCollection();
+    }
+}
+
+std::shared_ptr<std::vector<htd::vertex_t>> htd::TreeDecomposition::sharedBag(const std::vector<htd::vertex_t> & content, htd::vertex_t neighbor1, htd::vertex_t neighbor2) const
+{
+    if (content.empty())
+    {
+        return emptyBag();
+    }
+
+    if (isShareable(content, neighbor1))
+    {
+        return bagContent_[neighbor1 - htd::Vertex::FIRST];
+    }
+
+    if (isShareable(content, neighbor2))
+    {
+        return bagContent_[neighbor2 - htd::Vertex::FIRST];
+    }
+
+    return std::make_shared<std::vector<htd::vertex_t>>(content);
+}
+
+std::shared_ptr<std::vector<htd::vertex_t>> htd::TreeDecomposition::sharedBag(std::vector<htd::vertex_t> && content, htd::vertex_t neighbor1, htd::vertex_t neighbor2) const
+{
+    if (content.empty())
+    {
+        return emptyBag();
+    }
+
+    if (isShareable(content, neighbor1))
+    {
+        return bagContent_[neighbor1 - htd::Vertex::FIRST];
+    }
+
+    if (isShareable(content, neighbor2))
+    {
+        return bagContent_[neighbor2 - htd::Vertex::FIRST];
+    }
+
+    return std::make_shared<std::vector<htd::vertex_t>>(std::move(content));
+}
+
+bool htd::TreeDecomposition::isShareable(const std::vector<htd::vertex_t> & content, htd::vertex_t neighbor) const
+{
+    if (neighbor == htd::Vertex::UNKNOWN || neighbor - htd::Vertex::FIRST >= bagContent_.size())
+    {
+        return false;
+    }
+
+    std::size_t index = neighbor - htd::Vertex::FIRST;
+
+    const std::shared_ptr<std::vector<htd::vertex_t>> & bag = bagContent_[index];
+
+    return bag != nullptr && !exclusiveBags_[index] && (bag.get() == &content || *bag == content);
+}
+
+void htd::TreeDecomposition::copyBags(const htd::TreeDecomposition & original)
+{
+    bagContent_ = original.bagContent_;
+
+    exclusiveBags_.assign(bagContent_.size(), false);
+
+    for (std::size_t index = 0; index < bagContent_.size(); ++index)
+    {
+        if (original.exclusiveBags_[index])
+        {
+            bagContent_[index] = std::make_shared<std::vector<htd::vertex_t>>(*(bagContent_[index]));
+        }
+    }
+}
+
+const std::shared_ptr<std::vector<htd::vertex_t>> & htd::TreeDecomposition::emptyBag(void)
+{
+    static const std::shared_ptr<std::vector<htd::vertex_t>> ret = std::make_shared<std::vector<htd::vertex_t>>();
+
+    return ret;
+}
+
 htd::TreeDecomposition * htd::TreeDecomposition::clone(void) const
 {
     return new htd::TreeDecomposition(*this);
@@ -1087,12 +1183,9 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
     {
         htd::LabeledTree::operator=(original);
 
-        for (htd::vertex_t vertex : original.vertexVector())
-        {
-            bagContent_[vertex] = original.bagContent(vertex);
+        copyBags(original);
 
-            inducedEdges_[vertex] = original.inducedHyperedges(vertex);
-        }
+        inducedEdges_ = original.inducedEdges_;
     }
 
     return *this;
@@ -1104,11 +1197,15 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITree & or
     {
         htd::LabeledTree::operator=(original);
 
-        for (htd::vertex_t vertex : original.vertices())
-        {
-            bagContent_[vertex] = std::vector<htd::vertex_t>();
+        bagContent_.clear();
+
+        exclusiveBags_.clear();
 
-            inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
+        inducedEdges_.clear();
+
+        for (htd::vertex_t vertex : original.vertexVector())
+        {
+            createBag(vertex, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
         }
     }
 
@@ -1121,11 +1218,15 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ILabeledTr
     {
         htd::LabeledTree::operator=(original);
 
-        for (htd::vertex_t vertex : original.vertices())
-        {
-            bagContent_[vertex] = std::vector<htd::vertex_t>();
+        bagContent_.clear();
 
-            inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
+        exclusiveBags_.clear();
+
+        inducedEdges_.clear();
+
+        for (htd::vertex_t vertex : original.vertexVector())
+        {
+            createBag(vertex, std::shared_ptr<std::vector<htd::vertex_t>>(emptyBag()), htd::FilteredHyperedgeCollection());
         }
     }
 
@@ -1138,11 +1239,15 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITreeDecom
     {
         htd::LabeledTree::operator=(original);
 
-        for (htd::vertex_t vertex : original.vertices())
-        {
-            bagContent_[vertex] = original.bagContent(vertex);
+        bagContent_.clear();
+
+        exclusiveBags_.clear();
 
-            inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+        inducedEdges_.clear();
+
+        for (htd::vertex_t vertex : original.vertexVector())
+        {
+            createBag(vertex, sharedBag(original.bagContent(vertex), original.isRoot(vertex) ? htd::Vertex::UNKNOWN : original.parent(vertex), htd::Vertex::UNKNOWN), htd::FilteredHyperedgeCollection(original.inducedHyperedges(vertex)));
         }
     }
 
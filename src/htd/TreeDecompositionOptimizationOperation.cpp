@@ -200,7 +200,7 @@ void htd::TreeDecompositionOptimizationOperation::apply(const htd::IMultiHypergr
 
             clone->setManagementInstance(managementInstance());
 
-            for (htd::vertex_t vertex : decomposition.vertices())
+            for (htd::vertex_t vertex : decomposition.vertexVector())
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
 
@@ -77,9 +77,13 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsVe
 
     bool ok = false;
 
-    std::unordered_set<htd::vertex_t> missingVertices(graph.vertices().begin(), graph.vertices().end());
-    
-    for (auto it1 = decomposition.vertices().begin(); !ok && it1 != decomposition.vertices().end(); it1++)
+    const std::vector<htd::vertex_t> & vertices = graph.vertexVector();
+
+    std::unordered_set<htd::vertex_t> missingVertices(vertices.begin(), vertices.end());
+
+    const std::vector<htd::vertex_t> & nodes = decomposition.vertexVector();
+
+    for (auto it1 = nodes.begin(); !ok && it1 != nodes.end(); it1++)
     {
         const std::vector<htd::vertex_t> & bag = decomposition.bagContent(*it1);
 
@@ -157,6 +157,11 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                 return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
             }
 
+            const std::vector<htd::vertex_t> & vertexVector(void) const HTD_OVERRIDE
+            {
+                return vertices_;
+            }
+
             void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
             {
                 target.insert(target.end(), vertices_.begin(), vertices_.end());
@@ -249,6 +254,13 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                 target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
             }
 
+            const std::vector<htd::vertex_t> & neighborVector(htd::vertex_t vertex) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return neighborhood_[vertex];
+            }
+
             htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(isVertex(vertex))
@@ -672,7 +684,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
 
                             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
 
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
+                            const std::vector<htd::vertex_t> & neighborCollection = graph.neighborVector(vertex);
 
                             auto position2 = neighborCollection.begin();
 
@@ -809,7 +821,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
 
         std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
+        for (htd::vertex_t vertex : triangulatedGraph.vertexVector())
         {
             for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
             {
@@ -946,7 +958,7 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
         htd::IMutableMultiHypergraph * optimizedGraph = implementation_->managementInstance_->multiHypergraphFactory().createInstance(graph);
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
+        for (htd::vertex_t vertex : triangulatedGraph.vertexVector())
         {
             for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
             {
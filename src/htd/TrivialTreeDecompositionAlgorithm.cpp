@@ -217,7 +217,7 @@ htd::ITreeDecomposition * htd::TrivialTreeDecompositionAlgorithm::computeDecompo
 
     for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
     {
-        for (htd::vertex_t vertex : ret->vertices())
+        for (htd::vertex_t vertex : ret->vertexVector())
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
@@ -231,7 +231,7 @@ htd::ITreeDecomposition * htd::TrivialTreeDecompositionAlgorithm::computeDecompo
 
     for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
     {
-        for (htd::vertex_t vertex : ret->vertices())
+        for (htd::vertex_t vertex : ret->vertexVector())
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
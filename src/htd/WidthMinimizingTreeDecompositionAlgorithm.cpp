@@ -27,6 +27,7 @@
 
 #include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/MinorMinWidthLowerBoundAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
@@ -45,7 +46,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), lowerBoundAlgorithm_(new htd::MinorMinWidthLowerBoundAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
     {
 
     }
@@ -57,7 +58,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
      */
     Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), lowerBoundAlgorithm_(new htd::MinorMinWidthLowerBoundAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
     {
 
     }
@@ -67,7 +68,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), lowerBoundAlgorithm_(original.lowerBoundAlgorithm_ != nullptr ? original.lowerBoundAlgorithm_->clone() : nullptr), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
     {
 
     }
@@ -75,6 +76,8 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
     virtual ~Implementation()
     {
         delete algorithm_;
+
+        delete lowerBoundAlgorithm_;
     }
 
     /**
@@ -87,6 +90,11 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     htd::BucketEliminationTreeDecompositionAlgorithm * algorithm_;
 
+    /**
+     *  The algorithm which is used to compute a lower bound for the treewidth of the input graph (or nullptr).
+     */
+    htd::ITreeWidthLowerBoundAlgorithm * lowerBoundAlgorithm_;
+
     /**
      *  The number of iterations which shall be performed.
      */
@@ -273,13 +281,21 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
+    std::size_t minimumMaxBagSize = 0;
+
+    if (implementation_->lowerBoundAlgorithm_ != nullptr)
+    {
+        minimumMaxBagSize = implementation_->lowerBoundAlgorithm_->computeLowerBound(graph, preprocessedGraph) + 1;
+    }
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     htd::ITreeDecomposition * ret = nullptr;
 
     htd::index_t iteration = 0;
 
-    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated())
+    /* A value of zero for bestMaxBagSize indicates that the maximum bag size is not bounded. */
+    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && (bestMaxBagSize == 0 || bestMaxBagSize > minimumMaxBagSize) && !managementInstance.isTerminated())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -454,6 +470,18 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setComputeInducedEdgesEnabl
     implementation_->algorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
 }
 
+const htd::ITreeWidthLowerBoundAlgorithm * htd::WidthMinimizingTreeDecompositionAlgorithm::lowerBoundAlgorithm(void) const
+{
+    return implementation_->lowerBoundAlgorithm_;
+}
+
+void htd::WidthMinimizingTreeDecompositionAlgorithm::setLowerBoundAlgorithm(htd::ITreeWidthLowerBoundAlgorithm * algorithm)
+{
+    delete implementation_->lowerBoundAlgorithm_;
+
+    implementation_->lowerBoundAlgorithm_ = algorithm;
+}
+
 const htd::LibraryInstance * htd::WidthMinimizingTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -125,7 +125,7 @@ struct htd::WidthReductionOperation::Implementation
 
                     htd::vertex_t mappedVertex = baseGraphToInducedGraphMapping_.at(vertex) + 1;
 
-                    const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(vertex);
+                    const std::vector<htd::vertex_t> & currentNeighborhood = graph.neighborVector(vertex);
 
                     std::vector<htd::vertex_t> relevantNeighbors;
 
@@ -496,8 +496,6 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
 
     bool ret = false;
 
-    const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
-
     htd::WidthReductionOperation::Implementation::InducedGraph * inducedGraph = createCorrespondingGraph(graph, decomposition, vertex);
 
     if (!isComplete(inducedGraph->internalGraph()))
@@ -569,6 +567,8 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
 
         decomposition.mutableBagContent(vertex) = std::move(*separator);
 
+        const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
+
         for (htd::vertex_t neighbor : neighbors)
         {
             const std::vector<htd::vertex_t> & neighborBagContent = decomposition.bagContent(neighbor);
@@ -663,12 +663,11 @@ bool htd::WidthReductionOperation::Implementation::isComplete(const htd::IGraphS
 {
     bool ret = true;
 
-    std::vector<htd::vertex_t> vertices;
-    graph.copyVerticesTo(vertices);
+    const std::vector<htd::vertex_t> & vertices = graph.vertexVector();
 
     for (auto it = vertices.begin(); ret && it != vertices.end(); ++it)
     {
-        const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(*it);
+        const std::vector<htd::vertex_t> & currentNeighborhood = graph.neighborVector(*it);
 
         ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
     }
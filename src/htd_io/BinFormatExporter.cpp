@@ -0,0 +1,176 @@
+/*
+ * File:   BinFormatExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINFORMATEXPORTER_CPP
+#define HTD_IO_BINFORMATEXPORTER_CPP
+
+#include <htd_io/BinFormatExporter.hpp>
+#include <htd_io/BinFormat.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Write the raw bytes of a vector to the given output stream.
+     *
+     *  @param[in] values       The values which shall be written.
+     *  @param[in] outputStream The output stream to which the values shall be written.
+     */
+    template <typename T>
+    void writeValues(const std::vector<T> & values, std::ostream & outputStream)
+    {
+        if (!values.empty())
+        {
+            outputStream.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+        }
+    }
+
+    /**
+     *  Write the header, the hyperedge offsets and the hyperedge elements of the given graph to the given output stream.
+     *
+     *  @param[in] graph        The graph which shall be written.
+     *  @param[in] flags        The flags which shall be stored in the header.
+     *  @param[in] outputStream The output stream to which the graph shall be written.
+     *
+     *  @return The number of bytes written or zero if the graph cannot be represented in the binary graph format.
+     */
+    std::size_t writeStructure(const htd::IMultiHypergraph & graph, std::uint32_t flags, std::ostream & outputStream)
+    {
+        std::size_t vertexCount = graph.vertexCount();
+
+        if (vertexCount > std::numeric_limits<std::uint32_t>::max())
+        {
+            outputStream.setstate(std::ios_base::failbit);
+
+            return 0;
+        }
+
+        const std::vector<htd::vertex_t> & vertices = graph.vertexVector();
+
+        /* If the vertices are exactly the identifiers 1, ..., n, no renumbering is required. */
+        bool identity = vertices.empty() || vertices.back() == htd::Vertex::FIRST + vertexCount - 1;
+
+        std::vector<std::uint64_t> offsets;
+        std::vector<std::uint32_t> elements;
+
+        offsets.reserve(graph.edgeCount() + 1);
+
+        offsets.push_back(0);
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            for (htd::vertex_t vertex : hyperedge)
+            {
+                if (identity)
+                {
+                    elements.push_back(static_cast<std::uint32_t>(vertex));
+                }
+                else
+                {
+                    elements.push_back(static_cast<std::uint32_t>(std::lower_bound(vertices.begin(), vertices.end(), vertex) - vertices.begin()) + 1);
+                }
+            }
+
+            offsets.push_back(elements.size());
+        }
+
+        std::uint32_t version = htd_io::BinFormat::VERSION;
+        std::uint32_t byteOrderMark = htd_io::BinFormat::BYTE_ORDER_MARK;
+
+        std::uint64_t counts[3] = { vertexCount, offsets.size() - 1, elements.size() };
+
+        char header[htd_io::BinFormat::HEADER_SIZE];
+
+        std::memcpy(header, "HTDG", 4);
+        std::memcpy(header + 4, &version, sizeof(version));
+        std::memcpy(header + 8, &byteOrderMark, sizeof(byteOrderMark));
+        std::memcpy(header + 12, &flags, sizeof(flags));
+        std::memcpy(header + 16, counts, sizeof(counts));
+
+        outputStream.write(header, sizeof(header));
+
+        writeValues(offsets, outputStream);
+        writeValues(elements, outputStream);
+
+        return sizeof(header) + offsets.size() * sizeof(std::uint64_t) + elements.size() * sizeof(std::uint32_t);
+    }
+}
+
+htd_io::BinFormatExporter::BinFormatExporter(void)
+{
+
+}
+
+htd_io::BinFormatExporter::~BinFormatExporter()
+{
+
+}
+
+void htd_io::BinFormatExporter::write(const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeStructure(graph, 0, outputStream);
+
+    outputStream.flush();
+}
+
+void htd_io::BinFormatExporter::write(const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    std::size_t bytesWritten = writeStructure(graph.internalGraph(), htd_io::BinFormat::VERTEX_NAMES, outputStream);
+
+    if (bytesWritten > 0)
+    {
+        const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+        outputStream.write(padding, static_cast<std::streamsize>((8 - bytesWritten % 8) % 8));
+
+        std::vector<std::uint64_t> nameOffsets;
+
+        nameOffsets.reserve(graph.vertexCount() + 1);
+
+        nameOffsets.push_back(0);
+
+        std::string names;
+
+        for (htd::vertex_t vertex : graph.internalGraph().vertexVector())
+        {
+            names += graph.vertexName(vertex);
+
+            nameOffsets.push_back(names.size());
+        }
+
+        writeValues(nameOffsets, outputStream);
+
+        outputStream.write(names.data(), static_cast<std::streamsize>(names.size()));
+    }
+
+    outputStream.flush();
+}
+
+#endif /* HTD_IO_BINFORMATEXPORTER_CPP */
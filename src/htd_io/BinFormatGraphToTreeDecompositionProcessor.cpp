@@ -0,0 +1,339 @@
+/*
+ * File:   BinFormatGraphToTreeDecompositionProcessor.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP
+#define HTD_IO_BINFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP
+
+#include <htd_io/BinFormatGraphToTreeDecompositionProcessor.hpp>
+
+#include <htd_io/BinFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
+
+#include <htd/main.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+/**
+ *  Private implementation details of class htd_io::BinFormatGraphToTreeDecompositionProcessor.
+ */
+struct htd_io::BinFormatGraphToTreeDecompositionProcessor::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), exporter_(nullptr), preprocessor_(nullptr)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        if (exporter_ != nullptr)
+        {
+            delete exporter_;
+        }
+
+        if (preprocessor_ != nullptr)
+        {
+            delete preprocessor_;
+        }
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The exporter which shall be used to export the resulting decomposition.
+     */
+    htd_io::ITreeDecompositionExporter * exporter_;
+
+    /**
+     *  The preprocessor which shall be used to preprocess the input graphs.
+     */
+    htd::IGraphPreprocessor * preprocessor_;
+
+    /**
+     *  A vector of callback functions which are invoked after parsing the input graph is finished.
+     */
+    std::vector<std::function<void(htd_io::parsing_result_t, std::size_t, std::size_t)>> parsingCallbacks_;
+
+    /**
+     *  A vector of callback functions which are invoked after preprocessing the input graph.
+     */
+    std::vector<std::function<void(std::size_t, std::size_t)>> preprocessingCallbacks_;
+
+    /**
+     *  A vector of callback functions which are invoked after decomposing the input graph is finished.
+     */
+    std::vector<std::function<void(const htd::FitnessEvaluation &)>> decompositionCallbacks_;
+
+    /**
+     *  Invoke all callback functions after parsing the input graph.
+     *
+     *  @param[in] result       This value indicates whether the parsing process was finished successfully.
+     *  @param[in] vertexCount  The vertex count of the input graph.
+     *  @param[in] edgeCount    The edge count of the input graph.
+     */
+    void invokeParsingCallbacks(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount) const
+    {
+        for (const std::function<void(htd_io::parsing_result_t, std::size_t, std::size_t)> & callback : parsingCallbacks_)
+        {
+            callback(result, vertexCount, edgeCount);
+        }
+    }
+
+    /**
+     *  Invoke all callback functions after preprocessing the input graph.
+     *
+     *  @param[in] vertexCount  The vertex count of the preprocessed input graph.
+     *  @param[in] edgeCount    The edge count of the preprocessed input graph.
+     */
+    void invokePreprocessingCallbacks(std::size_t vertexCount, std::size_t edgeCount) const
+    {
+        for (const std::function<void(std::size_t, std::size_t)> & callback : preprocessingCallbacks_)
+        {
+            callback(vertexCount, edgeCount);
+        }
+    }
+
+    /**
+     *  Invoke all callback functions after after decomposing the input graph.
+     *
+     *  @param[in] fitness  The fitness evaluation of the computed decomposition.
+     */
+    void invokeDecompositionCallbacks(const htd::FitnessEvaluation & fitness) const
+    {
+        for (const std::function<void(const htd::FitnessEvaluation &)> & callback : decompositionCallbacks_)
+        {
+            callback(fitness);
+        }
+    }
+
+    /**
+     *  Import and decompose the given input and write the resulting decomposition to the given output stream.
+     *
+     *  If the input contains vertex names, the decomposition is exported based on the vertex names.
+     *
+     *  @param[in] input        The input in the graph format 'bin'.
+     *  @param[in] outputStream The output stream to which the decomposition shall be written.
+     */
+    void process(const htd_io::InputBuffer & input, std::ostream & outputStream) const
+    {
+        htd_io::BinFormatImporter importer(managementInstance_);
+
+        if (input.valid() && importer.containsVertexNames(input.data(), input.size()))
+        {
+            htd::NamedMultiHypergraph<std::string, std::string> * graph = importer.importNamed(input.data(), input.size());
+
+            if (graph != nullptr)
+            {
+                decompose(*graph, graph->internalGraph(), outputStream);
+
+                delete graph;
+            }
+            else
+            {
+                invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+            }
+        }
+        else
+        {
+            htd::IMultiHypergraph * graph = nullptr;
+
+            if (input.valid())
+            {
+                graph = importer.import(input.data(), input.size());
+            }
+
+            if (graph != nullptr)
+            {
+                decompose(*graph, *graph, outputStream);
+
+                delete graph;
+            }
+            else
+            {
+                invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+            }
+        }
+    }
+
+    /**
+     *  Decompose the given input graph and write the resulting decomposition to the given output stream.
+     *
+     *  @param[in] graph        The input graph which is passed to the exporter.
+     *  @param[in] structure    The structure of the input graph which shall be decomposed.
+     *  @param[in] outputStream The output stream to which the decomposition shall be written.
+     */
+    template <typename GraphType>
+    void decompose(const GraphType & graph, const htd::IMultiHypergraph & structure, std::ostream & outputStream) const
+    {
+        invokeParsingCallbacks(htd_io::ParsingResult::OK, structure.vertexCount(), structure.edgeCount());
+
+        htd::ITreeDecompositionAlgorithm * algorithm = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+
+        htd::ITreeDecomposition * decomposition = nullptr;
+
+        htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+
+        std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> fitnessCallback =
+            [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness)
+        {
+            HTD_UNUSED(currentGraph)
+            HTD_UNUSED(currentDecomposition)
+
+            invokeDecompositionCallbacks(fitness);
+        };
+
+        if (preprocessor_ != nullptr)
+        {
+            htd::IPreprocessedGraph * preprocessedGraph = preprocessor_->prepare(structure);
+
+            HTD_ASSERT(preprocessedGraph != nullptr)
+
+            invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+
+            if (customizedAlgorithm != nullptr)
+            {
+                decomposition = customizedAlgorithm->computeDecomposition(structure, *preprocessedGraph, fitnessCallback);
+            }
+            else
+            {
+                decomposition = algorithm->computeDecomposition(structure, *preprocessedGraph);
+            }
+
+            delete preprocessedGraph;
+        }
+        else
+        {
+            if (customizedAlgorithm != nullptr)
+            {
+                decomposition = customizedAlgorithm->computeDecomposition(structure, fitnessCallback);
+            }
+            else
+            {
+                decomposition = algorithm->computeDecomposition(structure);
+            }
+        }
+
+        if (customizedAlgorithm == nullptr && decomposition != nullptr)
+        {
+            invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+        }
+
+        delete algorithm;
+
+        if (decomposition != nullptr)
+        {
+            if (exporter_ != nullptr)
+            {
+                exporter_->write(*decomposition, graph, outputStream);
+            }
+
+            delete decomposition;
+        }
+    }
+};
+
+htd_io::BinFormatGraphToTreeDecompositionProcessor::BinFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::BinFormatGraphToTreeDecompositionProcessor::~BinFormatGraphToTreeDecompositionProcessor(void)
+{
+
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
+{
+    htd_io::InputBuffer input(inputFile);
+
+    std::ofstream outputStream(outputFile);
+
+    implementation_->process(input, outputStream);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
+{
+    htd_io::InputBuffer input(inputFile);
+
+    implementation_->process(input, outputStream);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
+{
+    std::ofstream outputStream(outputFile);
+
+    process(inputStream, outputStream);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
+{
+    htd_io::InputBuffer input(inputStream);
+
+    implementation_->process(input, outputStream);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGraphPreprocessor * preprocessor)
+{
+    if (implementation_->preprocessor_ != nullptr)
+    {
+        delete implementation_->preprocessor_;
+    }
+
+    implementation_->preprocessor_ = preprocessor;
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::setExporter(htd_io::ITreeDecompositionExporter * exporter)
+{
+    if (implementation_->exporter_ != nullptr)
+    {
+        delete implementation_->exporter_;
+    }
+
+    implementation_->exporter_ = exporter;
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback)
+{
+    implementation_->parsingCallbacks_.push_back(callback);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::registerPreprocessingCallback(const std::function<void(std::size_t vertexCount, std::size_t edgeCount)> & callback)
+{
+    implementation_->preprocessingCallbacks_.push_back(callback);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::registerDecompositionCallback(const std::function<void(const htd::FitnessEvaluation &)> & callback)
+{
+    implementation_->decompositionCallbacks_.push_back(callback);
+}
+
+#endif /* HTD_IO_BINFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP */
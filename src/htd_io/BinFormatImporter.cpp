@@ -0,0 +1,449 @@
+/*
+ * File:   BinFormatImporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINFORMATIMPORTER_CPP
+#define HTD_IO_BINFORMATIMPORTER_CPP
+
+#include <htd_io/BinFormatImporter.hpp>
+#include <htd_io/BinFormat.hpp>
+#include <htd_io/InputBuffer.hpp>
+
+#include <htd/MultiHypergraphFactory.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd_io::BinFormatImporter.
+ */
+struct htd_io::BinFormatImporter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The location of the sections of a file in the binary graph format.
+     */
+    struct Layout
+    {
+        /**
+         *  The number of vertices.
+         */
+        std::size_t vertexCount;
+
+        /**
+         *  The number of hyperedges.
+         */
+        std::size_t edgeCount;
+
+        /**
+         *  The total number of hyperedge elements.
+         */
+        std::size_t elementCount;
+
+        /**
+         *  The first byte of the hyperedge offsets.
+         */
+        const char * offsets;
+
+        /**
+         *  The first byte of the hyperedge elements.
+         */
+        const char * elements;
+
+        /**
+         *  The first byte of the vertex name offsets or nullptr if the input does not contain vertex names.
+         */
+        const char * nameOffsets;
+
+        /**
+         *  The first character of the concatenated vertex names or nullptr if the input does not contain vertex names.
+         */
+        const char * names;
+    };
+
+    /**
+     *  Read a value of the given type stored at the given position.
+     *
+     *  @param[in] base     The first byte of the array in which the value is stored.
+     *  @param[in] index    The index of the value within the array.
+     *
+     *  @return The value stored at the given position.
+     */
+    template <typename T>
+    static T load(const char * base, std::size_t index)
+    {
+        T ret;
+
+        std::memcpy(&ret, base + index * sizeof(T), sizeof(T));
+
+        return ret;
+    }
+
+    /**
+     *  Check that the given offsets are non-decreasing and cover exactly the given number of values.
+     *
+     *  @param[in] offsets  The first byte of the offsets.
+     *  @param[in] count    The number of entries described by the offsets.
+     *  @param[in] total    The number of values covered by the offsets.
+     *
+     *  @return True if the offsets are valid, false otherwise.
+     */
+    static bool validOffsets(const char * offsets, std::size_t count, std::uint64_t total)
+    {
+        std::uint64_t last = load<std::uint64_t>(offsets, 0);
+
+        bool ret = last == 0;
+
+        for (std::size_t index = 1; ret && index <= count; ++index)
+        {
+            std::uint64_t current = load<std::uint64_t>(offsets, index);
+
+            ret = current >= last;
+
+            last = current;
+        }
+
+        return ret && last == total;
+    }
+
+    /**
+     *  Validate the header of the given input and locate its sections.
+     *
+     *  @param[in] data     The first byte of the input.
+     *  @param[in] size     The size of the input in bytes.
+     *  @param[out] layout  The location of the sections of the input.
+     *
+     *  @return True if the header is valid and the size of the input matches the sizes announced in the header, false otherwise.
+     */
+    static bool readLayout(const char * data, std::size_t size, Layout & layout)
+    {
+        if (data == nullptr || size < htd_io::BinFormat::HEADER_SIZE || std::memcmp(data, "HTDG", 4) != 0)
+        {
+            return false;
+        }
+
+        std::uint32_t version = load<std::uint32_t>(data + 4, 0);
+        std::uint32_t byteOrderMark = load<std::uint32_t>(data + 8, 0);
+        std::uint32_t flags = load<std::uint32_t>(data + 12, 0);
+
+        if (version != htd_io::BinFormat::VERSION || byteOrderMark != htd_io::BinFormat::BYTE_ORDER_MARK || (flags & ~htd_io::BinFormat::VERTEX_NAMES) != 0)
+        {
+            return false;
+        }
+
+        std::uint64_t vertexCount = load<std::uint64_t>(data + 16, 0);
+        std::uint64_t edgeCount = load<std::uint64_t>(data + 16, 1);
+        std::uint64_t elementCount = load<std::uint64_t>(data + 16, 2);
+
+        std::size_t remainder = size - htd_io::BinFormat::HEADER_SIZE;
+
+        if (vertexCount > std::numeric_limits<std::uint32_t>::max() || edgeCount >= remainder / sizeof(std::uint64_t))
+        {
+            return false;
+        }
+
+        layout.vertexCount = static_cast<std::size_t>(vertexCount);
+        layout.edgeCount = static_cast<std::size_t>(edgeCount);
+        layout.offsets = data + htd_io::BinFormat::HEADER_SIZE;
+
+        remainder -= (layout.edgeCount + 1) * sizeof(std::uint64_t);
+
+        if (elementCount > remainder / sizeof(std::uint32_t))
+        {
+            return false;
+        }
+
+        layout.elementCount = static_cast<std::size_t>(elementCount);
+        layout.elements = layout.offsets + (layout.edgeCount + 1) * sizeof(std::uint64_t);
+
+        remainder -= layout.elementCount * sizeof(std::uint32_t);
+
+        layout.nameOffsets = nullptr;
+        layout.names = nullptr;
+
+        if ((flags & htd_io::BinFormat::VERTEX_NAMES) != 0)
+        {
+            std::size_t padding = (sizeof(std::uint64_t) - (size - remainder) % sizeof(std::uint64_t)) % sizeof(std::uint64_t);
+
+            if (padding > remainder || layout.vertexCount >= (remainder - padding) / sizeof(std::uint64_t))
+            {
+                return false;
+            }
+
+            remainder -= padding + (layout.vertexCount + 1) * sizeof(std::uint64_t);
+
+            layout.nameOffsets = layout.elements + layout.elementCount * sizeof(std::uint32_t) + padding;
+            layout.names = layout.nameOffsets + (layout.vertexCount + 1) * sizeof(std::uint64_t);
+
+            if (!validOffsets(layout.nameOffsets, layout.vertexCount, remainder))
+            {
+                return false;
+            }
+        }
+        else if (remainder != 0)
+        {
+            return false;
+        }
+
+        return load<std::uint64_t>(layout.offsets, 0) == 0 && load<std::uint64_t>(layout.offsets, layout.edgeCount) == elementCount;
+    }
+
+    /**
+     *  Read the hyperedges stored in the given input.
+     *
+     *  @param[in] layout       The location of the sections of the input.
+     *  @param[out] elements    The concatenated vertex positions (in the range [1, vertexCount]) of all hyperedges.
+     *  @param[out] offsets     The position of the first element of each hyperedge within the vector of elements, followed by the total number of elements.
+     *
+     *  @return True if all hyperedges are valid and non-empty (or if the import was terminated), false otherwise.
+     */
+    bool readEdges(const Layout & layout, std::vector<htd::vertex_t> & elements, std::vector<htd::index_t> & offsets) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        elements.clear();
+        elements.reserve(static_cast<std::size_t>(layout.elementCount));
+
+        offsets.assign(1, 0);
+        offsets.reserve(static_cast<std::size_t>(layout.edgeCount) + 1);
+
+        std::uint64_t begin = 0;
+
+        for (std::size_t index = 0; index < layout.edgeCount && !managementInstance.isTerminated(); ++index)
+        {
+            std::uint64_t end = load<std::uint64_t>(layout.offsets, index + 1);
+
+            if (end <= begin || end > layout.elementCount)
+            {
+                return false;
+            }
+
+            for (std::uint64_t position = begin; position < end; ++position)
+            {
+                std::uint32_t vertex = load<std::uint32_t>(layout.elements, static_cast<std::size_t>(position));
+
+                if (vertex == 0 || vertex > layout.vertexCount)
+                {
+                    return false;
+                }
+
+                elements.push_back(vertex);
+            }
+
+            offsets.push_back(elements.size());
+
+            begin = end;
+        }
+
+        return true;
+    }
+};
+
+htd_io::BinFormatImporter::BinFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::BinFormatImporter::~BinFormatImporter(void)
+{
+
+}
+
+htd::IMultiHypergraph * htd_io::BinFormatImporter::import(const std::string & path) const
+{
+    htd_io::InputBuffer input(path);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::IMultiHypergraph * htd_io::BinFormatImporter::import(std::istream & stream) const
+{
+    htd_io::InputBuffer input(stream);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::IMultiHypergraph * htd_io::BinFormatImporter::import(const char * data, std::size_t size) const
+{
+    Implementation::Layout layout;
+
+    if (!Implementation::readLayout(data, size, layout))
+    {
+        return nullptr;
+    }
+
+    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+
+    if (layout.vertexCount > 0)
+    {
+        ret->addVertices(layout.vertexCount);
+    }
+
+    std::vector<htd::vertex_t> elements;
+
+    std::vector<htd::index_t> offsets;
+
+    bool success = implementation_->readEdges(layout, elements, offsets);
+
+    if (success)
+    {
+        ret->addEdges(elements, offsets);
+    }
+    else
+    {
+        delete ret;
+
+        ret = nullptr;
+    }
+
+    return ret;
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::BinFormatImporter::importNamed(const std::string & path) const
+{
+    htd_io::InputBuffer input(path);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return importNamed(input.data(), input.size());
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::BinFormatImporter::importNamed(std::istream & stream) const
+{
+    htd_io::InputBuffer input(stream);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return importNamed(input.data(), input.size());
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::BinFormatImporter::importNamed(const char * data, std::size_t size) const
+{
+    Implementation::Layout layout;
+
+    if (!Implementation::readLayout(data, size, layout) || layout.names == nullptr)
+    {
+        return nullptr;
+    }
+
+    htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> vertices(layout.vertexCount);
+
+    std::string vertexName;
+
+    bool success = true;
+
+    std::uint64_t begin = 0;
+
+    for (std::size_t index = 0; success && index < layout.vertexCount; ++index)
+    {
+        /* The name offsets were validated by readLayout, hence they are non-decreasing and within the names section. */
+        std::uint64_t end = Implementation::load<std::uint64_t>(layout.nameOffsets, index + 1);
+
+        vertexName.assign(layout.names + begin, static_cast<std::size_t>(end - begin));
+
+        vertices[index] = ret->addVertex(vertexName);
+
+        /* Duplicate vertex names would merge vertices and are therefore rejected. */
+        success = ret->vertexCount() == index + 1;
+
+        begin = end;
+    }
+
+    if (success)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        std::vector<htd::index_t> offsets;
+
+        success = implementation_->readEdges(layout, elements, offsets);
+
+        if (success)
+        {
+            for (htd::vertex_t & vertex : elements)
+            {
+                vertex = vertices[vertex - 1];
+            }
+
+            ret->addEdgesByVertexIds(elements, offsets);
+        }
+    }
+
+    if (!success)
+    {
+        delete ret;
+
+        ret = nullptr;
+    }
+
+    return ret;
+}
+
+bool htd_io::BinFormatImporter::containsVertexNames(const char * data, std::size_t size) const
+{
+    Implementation::Layout layout;
+
+    return Implementation::readLayout(data, size, layout) && layout.names != nullptr;
+}
+
+#endif /* HTD_IO_BINFORMATIMPORTER_CPP */
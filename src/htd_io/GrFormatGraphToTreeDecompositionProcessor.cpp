@@ -28,6 +28,7 @@
 #include <htd_io/GrFormatGraphToTreeDecompositionProcessor.hpp>
 
 #include <htd_io/GrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/main.hpp>
 
@@ -133,6 +134,26 @@ struct htd_io::GrFormatGraphToTreeDecompositionProcessor::Implementation
             callback(fitness);
         }
     }
+
+    /**
+     *  Parse, preprocess and decompose the given input and write the resulting decomposition to the given output stream.
+     *
+     *  If a preprocessor is set, the parsed edges are passed directly to the preprocessor and the input graph
+     *  itself is only created afterwards so that both representations never need to be held at the same time.
+     *
+     *  @param[in] input        The input in the graph format 'gr'.
+     *  @param[in] outputStream The output stream to which the decomposition shall be written.
+     */
+    void process(const htd_io::InputBuffer & input, std::ostream & outputStream) const;
+
+    /**
+     *  Decompose the given input graph and write the resulting decomposition to the given output stream.
+     *
+     *  @param[in] graph                The input graph.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format or nullptr if no preprocessor is set.
+     *  @param[in] outputStream         The output stream to which the decomposition shall be written.
+     */
+    void decompose(const htd::IMultiGraph & graph, const htd::IPreprocessedGraph * preprocessedGraph, std::ostream & outputStream) const;
 };
 
 htd_io::GrFormatGraphToTreeDecompositionProcessor::GrFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -147,17 +168,18 @@ htd_io::GrFormatGraphToTreeDecompositionProcessor::~GrFormatGraphToTreeDecomposi
 
 void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
 {
-    std::ifstream inputStream(inputFile);
+    htd_io::InputBuffer input(inputFile);
+
     std::ofstream outputStream(outputFile);
 
-    process(inputStream, outputStream);
+    implementation_->process(input, outputStream);
 }
 
 void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
 {
-    std::ifstream inputStream(inputFile);
+    htd_io::InputBuffer input(inputFile);
 
-    process(inputStream, outputStream);
+    implementation_->process(input, outputStream);
 }
 
 void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
@@ -169,132 +191,176 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 
 void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
 {
-    htd_io::GrFormatImporter importer(implementation_->managementInstance_);
+    htd_io::InputBuffer input(inputStream);
 
-    htd::IMultiGraph * graph = importer.import(inputStream);
+    implementation_->process(input, outputStream);
+}
 
-    if (graph != nullptr)
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::setExporter(htd_io::ITreeDecompositionExporter * exporter)
+{
+    if (implementation_->exporter_ != nullptr)
     {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
+        delete implementation_->exporter_;
+    }
 
-        htd::ITreeDecompositionAlgorithm * algorithm = implementation_->managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+    implementation_->exporter_ = exporter;
+}
 
-        htd::ITreeDecomposition * decomposition = nullptr;
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGraphPreprocessor * preprocessor)
+{
+    if (implementation_->preprocessor_ != nullptr)
+    {
+        delete implementation_->preprocessor_;
+    }
 
-        if (implementation_->preprocessor_ != nullptr)
-        {
-            htd::IPreprocessedGraph * preprocessedGraph = implementation_->preprocessor_->prepare(*graph);
+    implementation_->preprocessor_ = preprocessor;
+}
+
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback)
+{
+    implementation_->parsingCallbacks_.push_back(callback);
+}
 
-            HTD_ASSERT(preprocessedGraph != nullptr)
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerPreprocessingCallback(const std::function<void(std::size_t vertexCount, std::size_t edgeCount)> & callback)
+{
+    implementation_->preprocessingCallbacks_.push_back(callback);
+}
 
-            implementation_->invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerDecompositionCallback(const std::function<void(const htd::FitnessEvaluation &)> & callback)
+{
+    implementation_->decompositionCallbacks_.push_back(callback);
+}
 
-            htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::Implementation::process(const htd_io::InputBuffer & input, std::ostream & outputStream) const
+{
+    htd_io::GrFormatImporter importer(managementInstance_);
 
-            if (customizedAlgorithm != nullptr)
-            {
-                decomposition = customizedAlgorithm->computeDecomposition(*graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
-                                                                                                          const htd::ITreeDecomposition & decomposition,
-                                                                                                          const htd::FitnessEvaluation & fitness)
-                {
-                    HTD_UNUSED(graph)
-                    HTD_UNUSED(decomposition)
-
-                    implementation_->invokeDecompositionCallbacks(fitness);
-                });
-            }
-            else
-            {
-                decomposition = algorithm->computeDecomposition(*graph, *preprocessedGraph);
+    htd::IMultiGraph * graph = nullptr;
 
-                if (decomposition != nullptr)
-                {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
-                }
-            }
+    htd::IPreprocessedGraph * preprocessedGraph = nullptr;
 
-            delete preprocessedGraph;
-        }
-        else
+    bool success = false;
+
+    if (input.valid())
+    {
+        if (preprocessor_ != nullptr)
         {
-            htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+            std::vector<std::vector<htd::vertex_t>> neighborhood;
 
-            if (customizedAlgorithm != nullptr)
-            {
-                decomposition = customizedAlgorithm->computeDecomposition(*graph, [&](const htd::IMultiHypergraph & graph,
-                                                                                      const htd::ITreeDecomposition & decomposition,
-                                                                                      const htd::FitnessEvaluation & fitness)
-                {
-                    HTD_UNUSED(graph)
-                    HTD_UNUSED(decomposition)
-
-                    implementation_->invokeDecompositionCallbacks(fitness);
-                });
-            }
-            else
+            std::size_t edgeCount = 0;
+
+            success = importer.importNeighborhood(input.data(), input.size(), neighborhood, edgeCount);
+
+            if (success)
             {
-                decomposition = algorithm->computeDecomposition(*graph);
+                invokeParsingCallbacks(htd_io::ParsingResult::OK, neighborhood.size(), edgeCount);
+
+                preprocessedGraph = preprocessor_->prepare(std::move(neighborhood), edgeCount);
+
+                HTD_ASSERT(preprocessedGraph != nullptr)
 
-                if (decomposition != nullptr)
-                {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
-                }
+                invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+
+                /* The input graph is parsed a second time only after the intermediate neighborhood relation was released by the preprocessor. */
+                graph = importer.import(input.data(), input.size());
             }
         }
+        else
+        {
+            graph = importer.import(input.data(), input.size());
 
-        delete algorithm;
+            success = graph != nullptr;
 
-        if (decomposition != nullptr)
-        {
-            if (implementation_->exporter_ != nullptr)
+            if (success)
             {
-                implementation_->exporter_->write(*decomposition, *graph, outputStream);
+                invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
             }
-
-            delete decomposition;
         }
-
-        delete graph;
     }
-    else
+
+    if (!success)
     {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+        invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
     }
-}
 
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::setExporter(htd_io::ITreeDecompositionExporter * exporter)
-{
-    if (implementation_->exporter_ != nullptr)
+    if (graph != nullptr)
     {
-        delete implementation_->exporter_;
+        decompose(*graph, preprocessedGraph, outputStream);
+
+        delete graph;
     }
 
-    implementation_->exporter_ = exporter;
+    delete preprocessedGraph;
 }
 
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGraphPreprocessor * preprocessor)
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::Implementation::decompose(const htd::IMultiGraph & graph, const htd::IPreprocessedGraph * preprocessedGraph, std::ostream & outputStream) const
 {
-    if (implementation_->preprocessor_ != nullptr)
+    htd::ITreeDecompositionAlgorithm * algorithm = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+
+    htd::ITreeDecomposition * decomposition = nullptr;
+
+    htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+
+    if (preprocessedGraph != nullptr)
     {
-        delete implementation_->preprocessor_;
+        if (customizedAlgorithm != nullptr)
+        {
+            decomposition = customizedAlgorithm->computeDecomposition(graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
+                                                                                                     const htd::ITreeDecomposition & decomposition,
+                                                                                                     const htd::FitnessEvaluation & fitness)
+            {
+                HTD_UNUSED(graph)
+                HTD_UNUSED(decomposition)
+
+                invokeDecompositionCallbacks(fitness);
+            });
+        }
+        else
+        {
+            decomposition = algorithm->computeDecomposition(graph, *preprocessedGraph);
+
+            if (decomposition != nullptr)
+            {
+                invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+            }
+        }
     }
+    else
+    {
+        if (customizedAlgorithm != nullptr)
+        {
+            decomposition = customizedAlgorithm->computeDecomposition(graph, [&](const htd::IMultiHypergraph & graph,
+                                                                                 const htd::ITreeDecomposition & decomposition,
+                                                                                 const htd::FitnessEvaluation & fitness)
+            {
+                HTD_UNUSED(graph)
+                HTD_UNUSED(decomposition)
 
-    implementation_->preprocessor_ = preprocessor;
-}
+                invokeDecompositionCallbacks(fitness);
+            });
+        }
+        else
+        {
+            decomposition = algorithm->computeDecomposition(graph);
 
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback)
-{
-    implementation_->parsingCallbacks_.push_back(callback);
-}
+            if (decomposition != nullptr)
+            {
+                invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+            }
+        }
+    }
 
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerPreprocessingCallback(const std::function<void(std::size_t vertexCount, std::size_t edgeCount)> & callback)
-{
-    implementation_->preprocessingCallbacks_.push_back(callback);
-}
+    delete algorithm;
 
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerDecompositionCallback(const std::function<void(const htd::FitnessEvaluation &)> & callback)
-{
-    implementation_->decompositionCallbacks_.push_back(callback);
+    if (decomposition != nullptr)
+    {
+        if (exporter_ != nullptr)
+        {
+            exporter_->write(*decomposition, graph, outputStream);
+        }
+
+        delete decomposition;
+    }
 }
 
 #endif /* HTD_IO_GRFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP */
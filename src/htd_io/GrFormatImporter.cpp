@@ -26,12 +26,17 @@
 #define HTD_IO_GRFORMATIMPORTER_CPP
 
 #include <htd_io/GrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/MultiGraphFactory.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <new>
 #include <string>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::GrFormatImporter.
@@ -57,134 +62,287 @@ struct htd_io::GrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
-};
 
-htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
+    /**
+     *  Parse an unsigned decimal number.
+     *
+     *  @param[in,out] position The position at which the number starts. After the call, the position points to the first character after the number.
+     *  @param[in] end          The position after the last character which may be read.
+     *  @param[out] value       The parsed value.
+     *
+     *  @return True if a number consisting of at least one and at most 18 digits was found at the given position, false otherwise.
+     */
+    static bool parseNumber(const char * & position, const char * end, std::size_t & value)
+    {
+        const char * start = position;
 
-}
+        std::size_t ret = 0;
 
-htd_io::GrFormatImporter::~GrFormatImporter(void)
-{
+        while (position != end && static_cast<unsigned char>(*position - '0') < 10)
+        {
+            ret = ret * 10 + static_cast<std::size_t>(*position - '0');
 
-}
+            ++position;
+        }
 
-htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
-{
-    std::ifstream stream(path);
+        value = ret;
 
-    return import(stream);
-}
+        return position != start && position - start <= 18;
+    }
 
-htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
-{
-    std::size_t vertexCount = 0;
-    std::size_t edgeCount = 0;
+    /**
+     *  Allocate the storage for the vertices announced in the header of the input.
+     *
+     *  Isolated vertices do not occur in the input, hence the announced vertex count cannot be bounded by the size of
+     *  the input. Instead, a vertex count for which no storage can be allocated is treated like malformed input.
+     *
+     *  @param[in] allocation   The function which allocates the storage.
+     *
+     *  @return True if the storage was allocated, false otherwise.
+     */
+    template <typename Allocation>
+    static bool allocate(Allocation && allocation)
+    {
+        try
+        {
+            allocation();
+        }
+        catch (const std::bad_alloc &)
+        {
+            return false;
+        }
+        catch (const std::length_error &)
+        {
+            return false;
+        }
 
-    bool firstLine = true;
+        return true;
+    }
 
-    bool error = false;
+    /**
+     *  Parse the information stored in a given memory region.
+     *
+     *  @param[in] begin            The first character of the input.
+     *  @param[in] end              The position after the last character of the input.
+     *  @param[in] headerCallback   The function which is called with the vertex count and the edge count announced in the header of the input. It returns false if the announced vertices cannot be stored.
+     *  @param[in] edgeCallback     The function which is called for each edge of the input.
+     *
+     *  @return True if the input is well-formed (or if parsing was terminated after the header was read), false otherwise.
+     */
+    template <typename HeaderCallback, typename EdgeCallback>
+    bool parse(const char * begin, const char * end, HeaderCallback && headerCallback, EdgeCallback && edgeCallback) const
+    {
+        std::size_t vertexCount = 0;
+        std::size_t edgeCount = 0;
 
-    htd::IMutableMultiGraph * ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+        bool firstLine = true;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+        bool error = false;
 
-    if (stream.good())
-    {
-        std::string line;
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-        std::size_t pos = 0;
+        const char * position = begin;
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        while (!error && position != end && !managementInstance.isTerminated())
         {
-            if (line.empty())
+            const char * lineEnd = static_cast<const char *>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+
+            const char * nextLine = end;
+
+            if (lineEnd != nullptr)
             {
-                error = true;
+                nextLine = lineEnd + 1;
             }
             else
             {
-                if (line[line.size() - 1] == '\r')
-                {
-                    line.pop_back();
-                }
+                lineEnd = end;
+            }
+
+            if (lineEnd != position && *(lineEnd - 1) == '\r')
+            {
+                --lineEnd;
+            }
 
-                if (line[0] != 'c')
+            if (lineEnd == position)
+            {
+                error = true;
+            }
+            else if (*position != 'c')
+            {
+                if (firstLine)
                 {
-                    if (firstLine)
+                    if (lineEnd - position < 5 || std::memcmp(position, "p tw ", 5) != 0)
                     {
-                        if (line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-
-                        line = line.substr(5);
-
-                        vertexCount = std::stol(line, &pos);
-
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
-
-                        line = line.substr(pos + 1);
-
-                        edgeCount = std::stol(line, &pos);
-
-                        if (pos != line.length())
-                        {
-                            error = true;
-                        }
-
-                        ret->addVertices(vertexCount);
-
-                        firstLine = false;
+                        error = true;
                     }
                     else
                     {
-                        htd::vertex_t vertex1 = std::stoul(line, &pos);
-
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(pos + 1);
+                        position += 5;
 
-                            htd::vertex_t vertex2 = std::stoul(line, &pos);
+                        error = !parseNumber(position, lineEnd, vertexCount) ||
+                                position == lineEnd || *(position++) != ' ' ||
+                                !parseNumber(position, lineEnd, edgeCount) ||
+                                position != lineEnd;
+                    }
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+                    if (!error)
+                    {
+                        error = !headerCallback(vertexCount, edgeCount);
+                    }
 
-                            ret->addEdge(vertex1, vertex2);
+                    firstLine = false;
+                }
+                else
+                {
+                    std::size_t vertex1 = 0;
+                    std::size_t vertex2 = 0;
+
+                    error = !parseNumber(position, lineEnd, vertex1) ||
+                            position == lineEnd || *(position++) != ' ' ||
+                            !parseNumber(position, lineEnd, vertex2) ||
+                            position != lineEnd ||
+                            vertex1 == 0 || vertex1 > vertexCount ||
+                            vertex2 == 0 || vertex2 > vertexCount ||
+                            edgeCount == 0;
+
+                    if (!error)
+                    {
+                        edgeCallback(static_cast<htd::vertex_t>(vertex1), static_cast<htd::vertex_t>(vertex2));
 
-                            edgeCount--;
-                        }
+                        edgeCount--;
                     }
                 }
             }
+
+            position = nextLine;
         }
 
         if (edgeCount != 0 && !managementInstance.isTerminated())
         {
             error = true;
         }
+
+        return !firstLine && !error;
     }
-    else
+};
+
+htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::GrFormatImporter::~GrFormatImporter(void)
+{
+
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
+{
+    htd_io::InputBuffer input(path);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
+{
+    htd_io::InputBuffer input(stream);
+
+    if (!input.valid())
     {
-        error = true;
+        return nullptr;
     }
 
-    if (firstLine || error)
+    return import(input.data(), input.size());
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(const char * data, std::size_t size) const
+{
+    HTD_ASSERT(data != nullptr || size == 0)
+
+    htd::IMutableMultiGraph * ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    bool success = implementation_->parse(data, data + size, [&](std::size_t vertexCount, std::size_t edgeCount)
+    {
+        if (!Implementation::allocate([&](void) { ret->addVertices(vertexCount); }))
+        {
+            return false;
+        }
+
+        /* The announced edge count is not trusted, each edge occupies at least four bytes of the input. */
+        edges.reserve(std::min(edgeCount, size / 4 + 1));
+
+        return true;
+    },
+    [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        edges.emplace_back(vertex1, vertex2);
+    });
+
+    if (success)
+    {
+        ret->addEdges(edges);
+    }
+    else
     {
         delete ret;
 
         ret = nullptr;
     }
-    
+
     return ret;
 }
 
+bool htd_io::GrFormatImporter::importNeighborhood(const char * data, std::size_t size, std::vector<std::vector<htd::vertex_t>> & neighborhood, std::size_t & edgeCount) const
+{
+    HTD_ASSERT(data != nullptr || size == 0)
+
+    neighborhood.clear();
+
+    edgeCount = 0;
+
+    bool success = implementation_->parse(data, data + size, [&](std::size_t vertexCount, std::size_t announcedEdgeCount)
+    {
+        HTD_UNUSED(announcedEdgeCount)
+
+        return Implementation::allocate([&](void) { neighborhood.resize(vertexCount); });
+    },
+    [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        if (vertex1 != vertex2)
+        {
+            neighborhood[vertex1 - htd::Vertex::FIRST].push_back(vertex2 - htd::Vertex::FIRST);
+            neighborhood[vertex2 - htd::Vertex::FIRST].push_back(vertex1 - htd::Vertex::FIRST);
+        }
+
+        ++edgeCount;
+    });
+
+    if (success)
+    {
+        for (std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+        {
+            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+            currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+
+            currentNeighborhood.shrink_to_fit();
+        }
+    }
+    else
+    {
+        std::vector<std::vector<htd::vertex_t>>().swap(neighborhood);
+
+        edgeCount = 0;
+    }
+
+    return success;
+}
+
 #endif /* HTD_IO_GRFORMATIMPORTER_CPP */
@@ -26,12 +26,17 @@
 #define HTD_IO_HGRFORMATIMPORTER_CPP
 
 #include <htd_io/HgrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/MultiHypergraphFactory.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <new>
 #include <string>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::HgrFormatImporter.
@@ -43,7 +48,7 @@ struct htd_io::HgrFormatImporter::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1)
     {
 
     }
@@ -57,6 +62,308 @@ struct htd_io::HgrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of worker threads which shall parse the hyperedges of the input concurrently.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The minimum number of bytes of a chunk which is parsed by its own worker thread.
+     */
+    static const std::size_t MINIMUM_CHUNK_SIZE = 1 << 20;
+
+    /**
+     *  The hyperedges found in a chunk of the input.
+     */
+    struct EdgeBuffer
+    {
+        /**
+         *  Constructor for an empty edge buffer.
+         */
+        EdgeBuffer(void) : elements(), offsets(1, 0), error(false), terminated(false)
+        {
+
+        }
+
+        /**
+         *  The concatenated elements of all hyperedges in the chunk.
+         */
+        std::vector<htd::vertex_t> elements;
+
+        /**
+         *  The position of the first element of each hyperedge within the vector of elements, followed by the total number of elements.
+         */
+        std::vector<htd::index_t> offsets;
+
+        /**
+         *  A boolean flag indicating whether the chunk is malformed.
+         */
+        bool error;
+
+        /**
+         *  A boolean flag indicating whether parsing of the chunk was terminated before its end was reached.
+         */
+        bool terminated;
+    };
+
+    /**
+     *  Parse an unsigned decimal number.
+     *
+     *  @param[in,out] position The position at which the number starts. After the call, the position points to the first character after the number.
+     *  @param[in] end          The position after the last character which may be read.
+     *  @param[out] value       The parsed value.
+     *
+     *  @return True if a number consisting of at least one and at most 18 digits was found at the given position, false otherwise.
+     */
+    static bool parseNumber(const char * & position, const char * end, std::size_t & value)
+    {
+        const char * start = position;
+
+        std::size_t ret = 0;
+
+        while (position != end && static_cast<unsigned char>(*position - '0') < 10)
+        {
+            ret = ret * 10 + static_cast<std::size_t>(*position - '0');
+
+            ++position;
+        }
+
+        value = ret;
+
+        return position != start && position - start <= 18;
+    }
+
+    /**
+     *  Determine the end of the line starting at a given position.
+     *
+     *  @param[in] position     The first character of the line.
+     *  @param[in] end          The position after the last character of the input.
+     *  @param[out] nextLine    The first character of the next line or the end of the input if there is no further line.
+     *
+     *  @return The position after the last character of the line, excluding the line break.
+     */
+    static const char * lineEnd(const char * position, const char * end, const char * & nextLine)
+    {
+        const char * ret = static_cast<const char *>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+
+        nextLine = end;
+
+        if (ret != nullptr)
+        {
+            nextLine = ret + 1;
+        }
+        else
+        {
+            ret = end;
+        }
+
+        if (ret != position && *(ret - 1) == '\r')
+        {
+            --ret;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Skip all blanks (spaces and tabulators) starting at a given position.
+     *
+     *  @param[in,out] position The position at which the blanks start. After the call, the position points to the first character which is not a blank.
+     *  @param[in] end          The position after the last character which may be read.
+     */
+    static void skipBlanks(const char * & position, const char * end)
+    {
+        while (position != end && (*position == ' ' || *position == '\t'))
+        {
+            ++position;
+        }
+    }
+
+    /**
+     *  Parse the comments preceding the header and the header itself.
+     *
+     *  @param[in,out] position The first character of the input. After the call, the position points to the first line after the header.
+     *  @param[in] end          The position after the last character of the input.
+     *  @param[out] vertexCount The number of vertices announced in the header.
+     *  @param[out] edgeCount   The number of hyperedges announced in the header.
+     *
+     *  @return True if a well-formed header was found, false otherwise.
+     */
+    bool parseHeader(const char * & position, const char * end, std::size_t & vertexCount, std::size_t & edgeCount) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        while (position != end && !managementInstance.isTerminated())
+        {
+            const char * nextLine = end;
+
+            const char * currentLineEnd = lineEnd(position, end, nextLine);
+
+            if (currentLineEnd == position)
+            {
+                return false;
+            }
+
+            if (*position != 'c')
+            {
+                bool ret = currentLineEnd - position >= 5 && std::memcmp(position, "p tw ", 5) == 0;
+
+                if (ret)
+                {
+                    position += 5;
+
+                    skipBlanks(position, currentLineEnd);
+
+                    ret = parseNumber(position, currentLineEnd, vertexCount) &&
+                          position != currentLineEnd && *(position++) == ' ';
+
+                    skipBlanks(position, currentLineEnd);
+
+                    ret = ret && parseNumber(position, currentLineEnd, edgeCount) && position == currentLineEnd;
+                }
+
+                position = nextLine;
+
+                return ret;
+            }
+
+            position = nextLine;
+        }
+
+        return false;
+    }
+
+    /**
+     *  Parse the hyperedges stored in a given part of the input.
+     *
+     *  Each line which is not a comment holds the vertices of a hyperedge, separated by a space and optionally further blanks.
+     *
+     *  @param[in] begin        The first character of a line following the header.
+     *  @param[in] end          The position after the last character which shall be parsed.
+     *  @param[in] vertexCount  The number of vertices announced in the header.
+     *  @param[out] buffer      The buffer to which the hyperedges are appended.
+     */
+    void parseEdges(const char * begin, const char * end, std::size_t vertexCount, EdgeBuffer & buffer) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        const char * position = begin;
+
+        while (!buffer.error && position != end)
+        {
+            if (managementInstance.isTerminated())
+            {
+                buffer.terminated = true;
+
+                return;
+            }
+
+            const char * nextLine = end;
+
+            const char * currentLineEnd = lineEnd(position, end, nextLine);
+
+            if (currentLineEnd == position)
+            {
+                buffer.error = true;
+            }
+            else if (*position != 'c')
+            {
+                std::size_t elementCount = buffer.elements.size();
+
+                bool error = false;
+
+                skipBlanks(position, currentLineEnd);
+
+                while (!error && position != currentLineEnd)
+                {
+                    std::size_t vertex = 0;
+
+                    error = !parseNumber(position, currentLineEnd, vertex) || vertex == 0 || vertex > vertexCount ||
+                            (position != currentLineEnd && *(position++) != ' ');
+
+                    buffer.elements.push_back(static_cast<htd::vertex_t>(vertex));
+
+                    skipBlanks(position, currentLineEnd);
+                }
+
+                if (error || buffer.elements.size() == elementCount)
+                {
+                    buffer.error = true;
+                }
+                else
+                {
+                    buffer.offsets.push_back(buffer.elements.size());
+                }
+            }
+
+            position = nextLine;
+        }
+    }
+
+    /**
+     *  Parse the hyperedges stored in a given part of the input, splitting it into chunks which are parsed concurrently.
+     *
+     *  @param[in] begin        The first character of a line following the header.
+     *  @param[in] end          The position after the last character of the input.
+     *  @param[in] vertexCount  The number of vertices announced in the header.
+     *
+     *  @return The hyperedges found in each chunk, in the order of the chunks.
+     */
+    std::vector<EdgeBuffer> parseEdges(const char * begin, const char * end, std::size_t vertexCount) const
+    {
+        std::size_t threadCount = threadCount_;
+
+        if (threadCount == 0)
+        {
+            threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), (std::size_t)1);
+        }
+
+        std::size_t size = static_cast<std::size_t>(end - begin);
+
+        std::size_t chunkCount = std::max(std::min(threadCount, size / MINIMUM_CHUNK_SIZE), (std::size_t)1);
+
+        std::vector<EdgeBuffer> ret(chunkCount);
+
+        if (chunkCount == 1)
+        {
+            parseEdges(begin, end, vertexCount, ret[0]);
+        }
+        else
+        {
+            std::vector<const char *> boundaries(chunkCount + 1, end);
+
+            boundaries[0] = begin;
+
+            for (htd::index_t index = 1; index < chunkCount; ++index)
+            {
+                const char * boundary = std::max(begin + size / chunkCount * index, boundaries[index - 1]);
+
+                lineEnd(boundary, end, boundaries[index]);
+            }
+
+            std::vector<std::thread> workers;
+
+            workers.reserve(chunkCount - 1);
+
+            for (htd::index_t index = 1; index < chunkCount; ++index)
+            {
+                workers.emplace_back([&, index]()
+                {
+                    parseEdges(boundaries[index], boundaries[index + 1], vertexCount, ret[index]);
+                });
+            }
+
+            parseEdges(boundaries[0], boundaries[1], vertexCount, ret[0]);
+
+            for (std::thread & currentWorker : workers)
+            {
+                currentWorker.join();
+            }
+        }
+
+        return ret;
+    }
 };
 
 htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -71,127 +378,102 @@ htd_io::HgrFormatImporter::~HgrFormatImporter(void)
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
+    htd_io::InputBuffer input(path);
 
-    return import(stream);
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
 }
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
 {
+    htd_io::InputBuffer input(stream);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const char * data, std::size_t size) const
+{
+    HTD_ASSERT(data != nullptr || size == 0)
+
     std::size_t vertexCount = 0;
     std::size_t edgeCount = 0;
 
-    bool firstLine = true;
+    const char * position = data;
+
+    if (!implementation_->parseHeader(position, data + size, vertexCount, edgeCount))
+    {
+        return nullptr;
+    }
+
+    std::vector<Implementation::EdgeBuffer> buffers = implementation_->parseEdges(position, data + size, vertexCount);
 
     bool error = false;
 
-    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+    bool terminated = false;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    std::size_t parsedEdgeCount = 0;
 
-    if (stream.good())
+    for (const Implementation::EdgeBuffer & buffer : buffers)
     {
-        std::string line;
+        error = error || buffer.error;
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
-        {
-            if (line.empty())
-            {
-                error = true;
-            }
-            else
-            {
-                if (line[line.size() - 1] == '\r')
-                {
-                    line.pop_back();
-                }
+        terminated = terminated || buffer.terminated;
 
-                if (line[0] != 'c')
-                {
-                    if (firstLine)
-                    {
-                        if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(5);
-
-                            std::size_t pos = 0;
-
-                            vertexCount = std::stol(line, &pos);
-
-                            if (line[pos] != ' ')
-                            {
-                                error = true;
-                            }
-
-                            line = line.substr(pos + 1);
-
-                            edgeCount = std::stol(line, &pos);
-
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
-
-                            ret->addVertices(vertexCount);
-
-                            firstLine = false;
-                        }
-                    }
-                    else
-                    {
-                        std::size_t pos = 0;
-
-                        std::vector<htd::vertex_t> vertices;
-
-                        while (!error && pos != line.length())
-                        {
-                            vertices.push_back(std::stoul(line, &pos));
-
-                            if (pos != line.length())
-                            {
-                                if (line[pos] != ' ')
-                                {
-                                    error = true;
-                                }
-                                else
-                                {
-                                    line = line.substr(pos + 1);
-
-                                    pos = 0;
-                                }
-                            }
-                        }
-
-                        ret->addEdge(std::move(vertices));
-
-                        edgeCount--;
-                    }
-                }
-            }
-        }
+        parsedEdgeCount += buffer.offsets.size() - 1;
+    }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
-        {
-            error = true;
-        }
+    if (error || (!terminated && parsedEdgeCount != edgeCount))
+    {
+        return nullptr;
     }
-    else
+
+    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+
+    /* Isolated vertices do not occur in the input, hence the announced vertex count cannot be bounded by the size of the input. */
+    try
     {
-        error = true;
+        ret->addVertices(vertexCount);
     }
+    catch (const std::bad_alloc &)
+    {
+        delete ret;
 
-    if (firstLine || error)
+        return nullptr;
+    }
+    catch (const std::length_error &)
     {
         delete ret;
 
-        ret = nullptr;
+        return nullptr;
+    }
+
+    for (auto it = buffers.begin(); it != buffers.end() && !implementation_->managementInstance_->isTerminated(); ++it)
+    {
+        ret->addEdges(it->elements, it->offsets);
+
+        std::vector<htd::vertex_t>().swap(it->elements);
     }
 
     return ret;
 }
 
+std::size_t htd_io::HgrFormatImporter::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd_io::HgrFormatImporter::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 #endif /* HTD_IO_HGRFORMATIMPORTER_CPP */
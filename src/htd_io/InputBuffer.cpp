@@ -0,0 +1,223 @@
+/*
+ * File:   InputBuffer.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_INPUTBUFFER_CPP
+#define HTD_IO_INPUTBUFFER_CPP
+
+#include <htd_io/InputBuffer.hpp>
+
+#include <fstream>
+#include <vector>
+
+#ifdef HTD_IO_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ *  Private implementation details of class htd_io::InputBuffer.
+ */
+struct htd_io::InputBuffer::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : data_(nullptr), size_(0), valid_(false), mapped_(false), buffer_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+    #ifdef HTD_IO_HAVE_MMAP
+        if (mapped_)
+        {
+            munmap(const_cast<char *>(data_), size_);
+        }
+    #endif
+    }
+
+    /**
+     *  A pointer to the first character of the input.
+     */
+    const char * data_;
+
+    /**
+     *  The size of the input in bytes.
+     */
+    std::size_t size_;
+
+    /**
+     *  A boolean flag indicating whether the input could be read.
+     */
+    bool valid_;
+
+    /**
+     *  A boolean flag indicating whether the input is mapped into memory.
+     */
+    bool mapped_;
+
+    /**
+     *  The buffer holding the input in case that it is not mapped into memory.
+     */
+    std::vector<char> buffer_;
+
+    /**
+     *  Try to map the given file into memory.
+     *
+     *  @param[in] path The path to the file which shall be mapped.
+     *
+     *  @return True if the file is a regular file which could be mapped (or is empty), false otherwise.
+     */
+    bool map(const std::string & path);
+
+    /**
+     *  Read the remaining content of the given stream into the buffer.
+     *
+     *  @param[in] stream   The input stream from which the information can be read.
+     */
+    void read(std::istream & stream);
+};
+
+htd_io::InputBuffer::InputBuffer(const std::string & path) : implementation_(new Implementation())
+{
+    if (!implementation_->map(path))
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+        implementation_->read(stream);
+    }
+}
+
+htd_io::InputBuffer::InputBuffer(std::istream & stream) : implementation_(new Implementation())
+{
+    implementation_->read(stream);
+}
+
+htd_io::InputBuffer::~InputBuffer()
+{
+
+}
+
+bool htd_io::InputBuffer::valid(void) const
+{
+    return implementation_->valid_;
+}
+
+const char * htd_io::InputBuffer::data(void) const
+{
+    return implementation_->data_;
+}
+
+std::size_t htd_io::InputBuffer::size(void) const
+{
+    return implementation_->size_;
+}
+
+bool htd_io::InputBuffer::isMemoryMapped(void) const
+{
+    return implementation_->mapped_;
+}
+
+bool htd_io::InputBuffer::Implementation::map(const std::string & path)
+{
+#ifdef HTD_IO_HAVE_MMAP
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+
+    if (fstat(fileDescriptor, &status) == 0 && S_ISREG(status.st_mode))
+    {
+        std::size_t size = static_cast<std::size_t>(status.st_size);
+
+        if (size == 0)
+        {
+            valid_ = true;
+        }
+        else
+        {
+            void * address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+            if (address != MAP_FAILED)
+            {
+                madvise(address, size, MADV_SEQUENTIAL);
+
+                data_ = static_cast<const char *>(address);
+
+                size_ = size;
+
+                valid_ = true;
+
+                mapped_ = true;
+            }
+        }
+    }
+
+    close(fileDescriptor);
+
+    return valid_;
+#else
+    HTD_UNUSED(path)
+
+    return false;
+#endif
+}
+
+void htd_io::InputBuffer::Implementation::read(std::istream & stream)
+{
+    if (stream.good())
+    {
+        std::size_t size = 0;
+
+        buffer_.resize(1 << 16);
+
+        while (stream.read(buffer_.data() + size, static_cast<std::streamsize>(buffer_.size() - size)))
+        {
+            size = buffer_.size();
+
+            buffer_.resize(2 * size);
+        }
+
+        size += static_cast<std::size_t>(stream.gcount());
+
+        buffer_.resize(size);
+
+        buffer_.shrink_to_fit();
+
+        data_ = buffer_.data();
+
+        size_ = size;
+
+        valid_ = !stream.bad();
+    }
+}
+
+#endif /* HTD_IO_INPUTBUFFER_CPP */
@@ -27,9 +27,178 @@
 
 #include <htd_io/LpFormatImporter.hpp>
 
-#include <fstream>
-#include <iostream>
+#include <htd_io/InputBuffer.hpp>
+
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Table which stores each distinct vertex name exactly once in a contiguous character arena and
+     *  which maps names to their position via an open-addressing hash table.
+     */
+    class NameTable
+    {
+        public:
+            /**
+             *  Constructor for an empty name table.
+             */
+            NameTable(void) : characters_(), offsets_(1, 0), slots_(1024, 0)
+            {
+
+            }
+
+            /**
+             *  Getter for the number of distinct names.
+             *
+             *  @return The number of distinct names stored in the table.
+             */
+            std::size_t size(void) const
+            {
+                return offsets_.size() - 1;
+            }
+
+            /**
+             *  Insert a name into the table if it does not already exist.
+             *
+             *  @param[in] name     The first character of the name.
+             *  @param[in] length   The length of the name.
+             *
+             *  @return The position of the name in the order of first insertion.
+             */
+            std::uint32_t insert(const char * name, std::size_t length)
+            {
+                std::uint64_t hash = computeHash(name, length);
+
+                std::size_t mask = slots_.size() - 1;
+
+                std::size_t slot = static_cast<std::size_t>(hash) & mask;
+
+                /* The upper half of each slot stores the upper half of the hash value so that most mismatches are detected without accessing the arena. */
+                std::uint64_t tag = hash & 0xFFFFFFFF00000000ULL;
+
+                while (slots_[slot] != 0)
+                {
+                    std::uint32_t index = static_cast<std::uint32_t>(slots_[slot]) - 1;
+
+                    if ((slots_[slot] & 0xFFFFFFFF00000000ULL) == tag && this->length(index) == length && std::memcmp(this->name(index), name, length) == 0)
+                    {
+                        return index;
+                    }
+
+                    slot = (slot + 1) & mask;
+                }
+
+                std::uint32_t ret = static_cast<std::uint32_t>(offsets_.size() - 1);
+
+                characters_.insert(characters_.end(), name, name + length);
+
+                offsets_.push_back(characters_.size());
+
+                slots_[slot] = tag | (static_cast<std::uint64_t>(ret) + 1);
+
+                if (2 * size() > slots_.size())
+                {
+                    grow();
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Access the name at the given position.
+             *
+             *  @param[in] index    The position of the name.
+             *
+             *  @return The first character of the name at the given position.
+             */
+            const char * name(std::uint32_t index) const
+            {
+                return characters_.data() + offsets_[index];
+            }
+
+            /**
+             *  Getter for the length of the name at the given position.
+             *
+             *  @param[in] index    The position of the name.
+             *
+             *  @return The length of the name at the given position.
+             */
+            std::size_t length(std::uint32_t index) const
+            {
+                return offsets_[index + 1] - offsets_[index];
+            }
+
+        private:
+            /**
+             *  The concatenated names.
+             */
+            std::vector<char> characters_;
+
+            /**
+             *  The offsets of the names within the character arena.
+             */
+            std::vector<std::size_t> offsets_;
+
+            /**
+             *  The slots of the hash table, each of them containing the upper half of the hash value of a name and the position of the name plus one or zero if the slot is empty.
+             */
+            std::vector<std::uint64_t> slots_;
+
+            /**
+             *  Compute the FNV-1a hash value of a name.
+             *
+             *  @param[in] name     The first character of the name.
+             *  @param[in] length   The length of the name.
+             *
+             *  @return The hash value of the name.
+             */
+            static std::uint64_t computeHash(const char * name, std::size_t length)
+            {
+                std::uint64_t ret = 14695981039346656037ULL;
+
+                for (std::size_t index = 0; index < length; ++index)
+                {
+                    ret = (ret ^ static_cast<unsigned char>(name[index])) * 1099511628211ULL;
+                }
+
+                return ret ^ (ret >> 29);
+            }
+
+            /**
+             *  Double the number of slots of the hash table.
+             */
+            void grow(void)
+            {
+                std::vector<std::uint64_t> slots(slots_.size() * 2, 0);
+
+                std::size_t mask = slots.size() - 1;
+
+                for (std::uint64_t entry : slots_)
+                {
+                    if (entry != 0)
+                    {
+                        std::uint32_t index = static_cast<std::uint32_t>(entry) - 1;
+
+                        std::size_t slot = static_cast<std::size_t>(computeHash(name(index), length(index))) & mask;
+
+                        while (slots[slot] != 0)
+                        {
+                            slot = (slot + 1) & mask;
+                        }
+
+                        slots[slot] = entry;
+                    }
+                }
+
+                slots_.swap(slots);
+            }
+    };
+}
 
 /**
  *  Private implementation details of class htd_io::LpFormatImporter.
@@ -57,11 +226,246 @@ struct htd_io::LpFormatImporter::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Remove all leading and trailing whitespaces from a given string.
+     *  Check whether a character is a whitespace.
+     *
+     *  @param[in] character    The character which shall be checked.
+     *
+     *  @return True if the character is a whitespace, false otherwise.
+     */
+    static bool isWhitespace(char character)
+    {
+        return character == ' ' || character == '\n' || character == '\t' || character == '\r' || character == '\f' || character == '\v';
+    }
+
+    /**
+     *  Check whether a character may be part of the name of a predicate.
+     *
+     *  @param[in] character    The character which shall be checked.
+     *
+     *  @return True if the character may be part of the name of a predicate, false otherwise.
+     */
+    static bool isIdentifierCharacter(char character)
+    {
+        return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9') || character == '_' || character == '\'';
+    }
+
+    /**
+     *  Skip a comment starting at the given position. Both line comments ('%') and block comments ('%*' ... '*%') are supported.
+     *
+     *  @param[in] position The position of the character '%' which starts the comment.
+     *  @param[in] end      The position after the last character of the input.
+     *
+     *  @return The position after the comment.
+     */
+    static const char * skipComment(const char * position, const char * end)
+    {
+        if (position + 1 < end && position[1] == '*')
+        {
+            for (position += 2; position + 1 < end; ++position)
+            {
+                if (position[0] == '*' && position[1] == '%')
+                {
+                    return position + 2;
+                }
+            }
+
+            return end;
+        }
+
+        const char * lineEnd = static_cast<const char *>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+
+        return lineEnd != nullptr ? lineEnd + 1 : end;
+    }
+
+    /**
+     *  Skip a quoted string starting at the given position.
+     *
+     *  @param[in] position The position of the opening quotation mark.
+     *  @param[in] end      The position after the last character of the input.
+     *
+     *  @return The position after the closing quotation mark.
+     */
+    static const char * skipString(const char * position, const char * end)
+    {
+        for (++position; position < end; ++position)
+        {
+            if (*position == '\\')
+            {
+                ++position;
+            }
+            else if (*position == '"')
+            {
+                return position + 1;
+            }
+        }
+
+        return end;
+    }
+
+    /**
+     *  Skip all whitespaces and comments starting at the given position.
+     *
+     *  @param[in] position The position from which on whitespaces and comments shall be skipped.
+     *  @param[in] end      The position after the last character of the input.
+     *
+     *  @return The position of the first character which is neither a whitespace nor part of a comment.
+     */
+    static const char * skipWhitespaces(const char * position, const char * end)
+    {
+        while (position < end)
+        {
+            if (isWhitespace(*position))
+            {
+                ++position;
+            }
+            else if (*position == '%')
+            {
+                position = skipComment(position, end);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        return position;
+    }
+
+    /**
+     *  Check whether the character at the given position is a period which terminates a statement (and not part of an interval '..').
      *
-     *  @param[in] value    The string which shall be trimmed.
+     *  @param[in] position The position of the character which shall be checked.
+     *  @param[in] end      The position after the last character of the input.
+     *
+     *  @return True if the character at the given position terminates a statement, false otherwise.
+     */
+    static bool isTerminator(const char * position, const char * end)
+    {
+        return *position == '.' && (position + 1 == end || position[1] != '.');
+    }
+
+    /**
+     *  Skip the remainder of a statement.
+     *
+     *  @param[in] position The position from which on the statement shall be skipped.
+     *  @param[in] end      The position after the last character of the input.
+     *
+     *  @return The position after the period which terminates the statement.
      */
-    void trim(std::string & value);
+    static const char * skipStatement(const char * position, const char * end)
+    {
+        while (position < end)
+        {
+            if (*position == '"')
+            {
+                position = skipString(position, end);
+            }
+            else if (*position == '%')
+            {
+                position = skipComment(position, end);
+            }
+            else if (*position == '.')
+            {
+                if (isTerminator(position, end))
+                {
+                    return position + 1;
+                }
+
+                position += 2;
+            }
+            else
+            {
+                ++position;
+            }
+        }
+
+        return end;
+    }
+
+    /**
+     *  Collect the arguments of an atom.
+     *
+     *  @param[in,out] position The position after the opening parenthesis of the atom. After the call, the position points to the first character after the closing parenthesis.
+     *  @param[in] end          The position after the last character of the input.
+     *  @param[in] split        True if the arguments shall be split at top-level commas, false if the complete content shall be treated as a single argument.
+     *  @param[out] arguments   The non-empty arguments of the atom without surrounding whitespaces.
+     *
+     *  @return True if the closing parenthesis of the atom was found, false otherwise.
+     */
+    static bool readArguments(const char * & position, const char * end, bool split, std::vector<std::pair<const char *, std::size_t>> & arguments)
+    {
+        std::size_t depth = 0;
+
+        const char * argumentStart = position;
+
+        auto addArgument = [&](const char * argumentEnd)
+        {
+            while (argumentStart < argumentEnd && isWhitespace(*argumentStart))
+            {
+                ++argumentStart;
+            }
+
+            while (argumentEnd > argumentStart && isWhitespace(*(argumentEnd - 1)))
+            {
+                --argumentEnd;
+            }
+
+            if (argumentEnd != argumentStart)
+            {
+                arguments.emplace_back(argumentStart, static_cast<std::size_t>(argumentEnd - argumentStart));
+            }
+        };
+
+        while (position < end)
+        {
+            char character = *position;
+
+            if (character == '"')
+            {
+                position = skipString(position, end);
+
+                continue;
+            }
+
+            if (character == '(')
+            {
+                ++depth;
+            }
+            else if (character == ')')
+            {
+                if (depth == 0)
+                {
+                    addArgument(position);
+
+                    ++position;
+
+                    return true;
+                }
+
+                --depth;
+            }
+            else if (character == ',' && depth == 0 && split)
+            {
+                addArgument(position);
+
+                argumentStart = position + 1;
+            }
+            else if (character == '.')
+            {
+                /* A terminating period within an atom indicates a malformed statement. */
+                if (isTerminator(position, end))
+                {
+                    return false;
+                }
+
+                ++position;
+            }
+
+            ++position;
+        }
+
+        return false;
+    }
 };
 
 htd_io::LpFormatImporter::LpFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -76,118 +480,133 @@ htd_io::LpFormatImporter::~LpFormatImporter(void)
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
+    htd_io::InputBuffer input(path);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
 
-    return import(stream);
+    return import(input.data(), input.size());
 }
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(std::istream & stream) const
 {
-    bool error = false;
+    htd_io::InputBuffer input(stream);
 
-    htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(const char * data, std::size_t size) const
+{
+    HTD_ASSERT(data != nullptr || size == 0)
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-    if (stream.good())
+    NameTable names;
+
+    std::vector<std::uint32_t> edgeElements;
+
+    std::vector<std::size_t> edgeOffsets(1, 0);
+
+    std::vector<std::pair<const char *, std::size_t>> arguments;
+
+    const char * end = data + size;
+
+    const char * position = data;
+
+    while (position < end && !managementInstance.isTerminated())
     {
-        std::string line;
+        position = Implementation::skipWhitespaces(position, end);
 
-        std::size_t nextPosition = 0;
-        
-        std::size_t startPosition = 0;
-        
-        std::size_t finishPosition = 0;
-        
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        if (position == end)
         {
-            finishPosition = 0;
-            
-            startPosition = line.find("edge(");
-            
-            if (startPosition == 0)
-            {
-                startPosition = startPosition + std::string("edge(").length();
-                
-                finishPosition = line.find(").", startPosition);
-                
-                if (finishPosition == line.length() - 2)
-                {
-                    line.erase(finishPosition, std::string(").").length());
-                    line.erase(0, startPosition);
-                    
-                    std::vector<std::string> hyperedge;
-                    
-                    nextPosition = line.find(",");
-                    
-                    while (nextPosition != std::string::npos)
-                    {
-                        std::string element = line.substr(0, nextPosition);
+            break;
+        }
 
-                        this->implementation_->trim(element);
+        const char * predicateEnd = position;
 
-                        hyperedge.push_back(element);
-                        
-                        line.erase(0, nextPosition + 1);
-                        
-                        nextPosition = line.find(",");
-                    }
+        while (predicateEnd < end && Implementation::isIdentifierCharacter(*predicateEnd))
+        {
+            ++predicateEnd;
+        }
 
-                    this->implementation_->trim(line);
+        std::size_t predicateLength = static_cast<std::size_t>(predicateEnd - position);
 
-                    if (line.length() > 0)
-                    {
-                        hyperedge.push_back(line);
-                    }
+        bool edge = predicateLength == 4 && std::memcmp(position, "edge", 4) == 0;
+        bool vertex = predicateLength == 6 && std::memcmp(position, "vertex", 6) == 0;
 
-                    if (hyperedge.size() > 0)
-                    {
-                        ret->addEdge(hyperedge);
-                    }
-                }
-            }
-            else
+        position = predicateEnd;
+
+        if ((edge || vertex) && position < end && *position == '(')
+        {
+            ++position;
+
+            arguments.clear();
+
+            if (Implementation::readArguments(position, end, edge, arguments))
             {
-                startPosition = line.find("vertex(");
+                position = Implementation::skipWhitespaces(position, end);
 
-                if (startPosition == 0)
+                /* Only facts contribute to the graph, atoms within rules are skipped together with the rule. */
+                if (position < end && Implementation::isTerminator(position, end))
                 {
-                    startPosition = startPosition + std::string("vertex(").length();
+                    ++position;
 
-                    finishPosition = line.find(").", startPosition);
-
-                    if (finishPosition == line.length() - 2)
+                    for (const std::pair<const char *, std::size_t> & argument : arguments)
                     {
-                        line.erase(finishPosition, std::string(").").length());
-                        line.erase(0, startPosition);
+                        std::uint32_t index = names.insert(argument.first, argument.second);
 
-                        this->implementation_->trim(line);
+                        if (edge)
+                        {
+                            edgeElements.push_back(index);
+                        }
+                    }
 
-                        ret->addVertex(line);
+                    if (edge && !arguments.empty())
+                    {
+                        edgeOffsets.push_back(edgeElements.size());
                     }
+
+                    continue;
                 }
             }
         }
+
+        position = Implementation::skipStatement(position, end);
     }
-    else
+
+    htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> vertices(names.size());
+
+    for (std::uint32_t index = 0; index < names.size(); ++index)
     {
-        error = true;
+        vertices[index] = ret->addVertex(std::string(names.name(index), names.length(index)));
     }
 
-    if (error)
+    if (!managementInstance.isTerminated())
     {
-        delete ret;
+        std::vector<htd::vertex_t> elements;
 
-        ret = nullptr;
+        elements.reserve(edgeElements.size());
+
+        for (std::uint32_t index : edgeElements)
+        {
+            elements.push_back(vertices[index]);
+        }
+
+        std::vector<std::uint32_t>().swap(edgeElements);
+
+        ret->addEdgesByVertexIds(elements, edgeOffsets);
     }
-    
-    return ret;
-}
 
-void htd_io::LpFormatImporter::Implementation::trim(std::string & value)
-{
-    value.erase(0, value.find_first_not_of(" \t\n\r\f\v"));
-    value.erase(value.find_last_not_of(" \t\n\r\f\v") + 1);
+    return ret;
 }
 
 #endif /* HTD_IO_LPFORMATIMPORTER_CPP */
@@ -0,0 +1,323 @@
+/*
+ * File:   PlanFormatExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_PLANFORMATEXPORTER_CPP
+#define HTD_IO_PLANFORMATEXPORTER_CPP
+
+#include <htd_io/PlanFormatExporter.hpp>
+#include <htd_io/PlanFormat.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Write the raw bytes of a vector to the given output stream and pad them with zero bytes to the next multiple of eight bytes.
+     *
+     *  @param[in] values       The values which shall be written.
+     *  @param[in] outputStream The output stream to which the values shall be written.
+     */
+    template <typename T>
+    void writeSection(const std::vector<T> & values, std::ostream & outputStream)
+    {
+        const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+        std::size_t size = values.size() * sizeof(T);
+
+        if (size > 0)
+        {
+            outputStream.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(size));
+        }
+
+        outputStream.write(padding, static_cast<std::streamsize>((8 - size % 8) % 8));
+    }
+
+    /**
+     *  Append the given vertices to the given section.
+     *
+     *  @param[in] vertices     The vertices which shall be appended.
+     *  @param[in,out] target   The section to which the vertices shall be appended.
+     *
+     *  @return True if all vertex identifiers can be represented in the format, false otherwise.
+     */
+    bool appendVertices(const std::vector<htd::vertex_t> & vertices, std::vector<std::uint32_t> & target)
+    {
+        for (htd::vertex_t vertex : vertices)
+        {
+            if (vertex > std::numeric_limits<std::uint32_t>::max())
+            {
+                return false;
+            }
+
+            target.push_back(static_cast<std::uint32_t>(vertex));
+        }
+
+        return true;
+    }
+
+    /**
+     *  Write the given decomposition in the binary tree decomposition format 'plan' to the given output stream.
+     *
+     *  @param[in] decomposition    The decomposition which shall be written.
+     *  @param[in] graph            The decomposed graph.
+     *  @param[in] outputStream     The output stream to which the decomposition shall be written.
+     */
+    void writePlan(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream)
+    {
+        const std::uint32_t noParent = htd_io::PlanFormat::NO_PARENT;
+
+        std::size_t nodeCount = decomposition.vertexCount();
+
+        if (nodeCount >= noParent)
+        {
+            outputStream.setstate(std::ios_base::failbit);
+
+            return;
+        }
+
+        std::vector<htd::vertex_t> nodes;
+
+        nodes.reserve(nodeCount);
+
+        decomposition.copyVerticesTo(nodes);
+
+        std::vector<std::uint32_t> positions(nodes.empty() ? 0 : *std::max_element(nodes.begin(), nodes.end()) + 1, noParent);
+
+        nodes.clear();
+
+        if (nodeCount > 0)
+        {
+            std::vector<std::pair<htd::vertex_t, htd::index_t>> stack;
+
+            stack.emplace_back(decomposition.root(), 0);
+
+            while (!stack.empty())
+            {
+                htd::vertex_t node = stack.back().first;
+
+                htd::index_t childIndex = stack.back().second;
+
+                const std::vector<htd::vertex_t> & childVector = decomposition.childVector(node);
+
+                if (childIndex < childVector.size())
+                {
+                    ++(stack.back().second);
+
+                    stack.emplace_back(childVector[childIndex], 0);
+                }
+                else
+                {
+                    positions[node] = static_cast<std::uint32_t>(nodes.size());
+
+                    nodes.push_back(node);
+
+                    stack.pop_back();
+                }
+            }
+        }
+
+        std::vector<std::uint32_t> types;
+        std::vector<std::uint32_t> parents;
+        std::vector<std::uint64_t> childOffsets(1, 0);
+        std::vector<std::uint32_t> children;
+        std::vector<std::uint64_t> bagOffsets(1, 0);
+        std::vector<std::uint32_t> bagElements;
+
+        types.reserve(nodeCount);
+        parents.reserve(nodeCount);
+        childOffsets.reserve(nodeCount + 1);
+        children.reserve(nodeCount);
+        bagOffsets.reserve(nodeCount + 1);
+
+        bool inducedEdges = false;
+
+        for (htd::vertex_t node : nodes)
+        {
+            std::uint32_t type = 0;
+
+            if (decomposition.isLeaf(node))
+            {
+                type |= htd_io::PlanFormat::LEAF;
+            }
+
+            if (decomposition.isIntroduceNode(node))
+            {
+                type |= htd_io::PlanFormat::INTRODUCE;
+            }
+
+            if (decomposition.isForgetNode(node))
+            {
+                type |= htd_io::PlanFormat::FORGET;
+            }
+
+            if (decomposition.isJoinNode(node))
+            {
+                type |= htd_io::PlanFormat::JOIN;
+            }
+
+            types.push_back(type);
+
+            parents.push_back(decomposition.isRoot(node) ? noParent : positions[decomposition.parent(node)]);
+
+            for (htd::vertex_t child : decomposition.childVector(node))
+            {
+                children.push_back(positions[child]);
+            }
+
+            childOffsets.push_back(children.size());
+
+            if (!appendVertices(decomposition.bagContent(node), bagElements))
+            {
+                outputStream.setstate(std::ios_base::failbit);
+
+                return;
+            }
+
+            bagOffsets.push_back(bagElements.size());
+
+            inducedEdges = inducedEdges || decomposition.inducedHyperedges(node).size() > 0;
+        }
+
+        std::vector<std::uint64_t> edgeIds;
+        std::vector<std::uint64_t> edgeOffsets(1, 0);
+        std::vector<std::uint32_t> edgeElements;
+        std::vector<std::uint64_t> inducedOffsets(1, 0);
+        std::vector<std::uint32_t> induced;
+
+        if (inducedEdges)
+        {
+            std::unordered_map<htd::id_t, std::uint32_t> edgePositions;
+
+            auto addEdge = [&](const htd::Hyperedge & hyperedge)
+            {
+                edgePositions.emplace(hyperedge.id(), static_cast<std::uint32_t>(edgeIds.size()));
+
+                edgeIds.push_back(hyperedge.id());
+
+                bool success = appendVertices(hyperedge.elements(), edgeElements);
+
+                edgeOffsets.push_back(edgeElements.size());
+
+                return success;
+            };
+
+            bool success = graph.edgeCount() < noParent;
+
+            for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+            {
+                success = addEdge(hyperedge) && success;
+            }
+
+            for (htd::vertex_t node : nodes)
+            {
+                for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+                {
+                    auto position = edgePositions.find(hyperedge.id());
+
+                    /* Induced hyperedges which are not part of the graph are added to the hyperedge table so that the plan remains self-contained. */
+                    if (position == edgePositions.end())
+                    {
+                        success = addEdge(hyperedge) && success;
+
+                        position = edgePositions.find(hyperedge.id());
+                    }
+
+                    induced.push_back(position->second);
+                }
+
+                inducedOffsets.push_back(induced.size());
+            }
+
+            if (!success || edgeIds.size() >= noParent)
+            {
+                outputStream.setstate(std::ios_base::failbit);
+
+                return;
+            }
+        }
+
+        std::uint32_t version = htd_io::PlanFormat::VERSION;
+        std::uint32_t byteOrderMark = htd_io::PlanFormat::BYTE_ORDER_MARK;
+        std::uint32_t flags = inducedEdges ? htd_io::PlanFormat::INDUCED_EDGES : 0;
+
+        std::uint64_t counts[6] = { nodeCount, graph.vertexCount(), bagElements.size(), edgeIds.size(), edgeElements.size(), induced.size() };
+
+        char header[htd_io::PlanFormat::HEADER_SIZE];
+
+        std::memcpy(header, "HTDP", 4);
+        std::memcpy(header + 4, &version, sizeof(version));
+        std::memcpy(header + 8, &byteOrderMark, sizeof(byteOrderMark));
+        std::memcpy(header + 12, &flags, sizeof(flags));
+        std::memcpy(header + 16, counts, sizeof(counts));
+
+        outputStream.write(header, sizeof(header));
+
+        writeSection(types, outputStream);
+        writeSection(parents, outputStream);
+        writeSection(childOffsets, outputStream);
+        writeSection(children, outputStream);
+        writeSection(bagOffsets, outputStream);
+        writeSection(bagElements, outputStream);
+
+        if (inducedEdges)
+        {
+            writeSection(edgeIds, outputStream);
+            writeSection(edgeOffsets, outputStream);
+            writeSection(edgeElements, outputStream);
+            writeSection(inducedOffsets, outputStream);
+            writeSection(induced, outputStream);
+        }
+
+        outputStream.flush();
+    }
+}
+
+htd_io::PlanFormatExporter::PlanFormatExporter(void)
+{
+
+}
+
+htd_io::PlanFormatExporter::~PlanFormatExporter()
+{
+
+}
+
+void htd_io::PlanFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writePlan(decomposition, graph, outputStream);
+}
+
+void htd_io::PlanFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writePlan(decomposition, graph.internalGraph(), outputStream);
+}
+
+#endif /* HTD_IO_PLANFORMATEXPORTER_CPP */
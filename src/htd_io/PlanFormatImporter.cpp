@@ -0,0 +1,452 @@
+/*
+ * File:   PlanFormatImporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_PLANFORMATIMPORTER_CPP
+#define HTD_IO_PLANFORMATIMPORTER_CPP
+
+#include <htd_io/PlanFormatImporter.hpp>
+#include <htd_io/PlanFormat.hpp>
+#include <htd_io/InputBuffer.hpp>
+
+#include <htd/HyperedgeVector.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd_io::PlanFormatImporter.
+ */
+struct htd_io::PlanFormatImporter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Read a value of the given type stored at the given position.
+     *
+     *  @param[in] base     The first byte of the array in which the value is stored.
+     *  @param[in] index    The index of the value within the array.
+     *
+     *  @return The value stored at the given position.
+     */
+    template <typename T>
+    static T load(const char * base, std::size_t index)
+    {
+        T ret;
+
+        std::memcpy(&ret, base + index * sizeof(T), sizeof(T));
+
+        return ret;
+    }
+
+    /**
+     *  Sequential reader for the padded sections of an input in the binary tree decomposition format 'plan'.
+     */
+    class SectionReader
+    {
+        public:
+            /**
+             *  Constructor for a section reader.
+             *
+             *  @param[in] data The first byte of the input.
+             *  @param[in] size The size of the input in bytes.
+             */
+            SectionReader(const char * data, std::size_t size) : data_(data), size_(size), position_(htd_io::PlanFormat::HEADER_SIZE)
+            {
+
+            }
+
+            /**
+             *  Locate the next section.
+             *
+             *  @param[in] count    The number of values stored in the section.
+             *  @param[out] section The first byte of the section.
+             *
+             *  @return True if the input is large enough to contain the section, false otherwise.
+             */
+            template <typename T>
+            bool next(std::size_t count, const char * & section)
+            {
+                std::size_t remainder = size_ - position_;
+
+                if (count > remainder / sizeof(T))
+                {
+                    return false;
+                }
+
+                std::size_t bytes = count * sizeof(T);
+
+                bytes += (8 - bytes % 8) % 8;
+
+                if (bytes > remainder)
+                {
+                    return false;
+                }
+
+                section = data_ + position_;
+
+                position_ += bytes;
+
+                return true;
+            }
+
+            /**
+             *  Check whether all sections were read.
+             *
+             *  @return True if the end of the input is reached, false otherwise.
+             */
+            bool finished(void) const
+            {
+                return position_ == size_;
+            }
+
+        private:
+            /**
+             *  The first byte of the input.
+             */
+            const char * data_;
+
+            /**
+             *  The size of the input in bytes.
+             */
+            std::size_t size_;
+
+            /**
+             *  The position of the next section.
+             */
+            std::size_t position_;
+    };
+
+    /**
+     *  Check that the given offsets are non-decreasing and cover exactly the given number of values.
+     *
+     *  @param[in] offsets  The first byte of the offsets.
+     *  @param[in] count    The number of entries described by the offsets.
+     *  @param[in] total    The number of values covered by the offsets.
+     *
+     *  @return True if the offsets are valid, false otherwise.
+     */
+    static bool validOffsets(const char * offsets, std::size_t count, std::uint64_t total)
+    {
+        std::uint64_t last = load<std::uint64_t>(offsets, 0);
+
+        bool ret = last == 0;
+
+        for (std::size_t index = 1; ret && index <= count; ++index)
+        {
+            std::uint64_t current = load<std::uint64_t>(offsets, index);
+
+            ret = current >= last;
+
+            last = current;
+        }
+
+        return ret && last == total;
+    }
+};
+
+htd_io::PlanFormatImporter::PlanFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::PlanFormatImporter::~PlanFormatImporter(void)
+{
+
+}
+
+htd::ITreeDecomposition * htd_io::PlanFormatImporter::import(const std::string & path) const
+{
+    htd_io::InputBuffer input(path);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::ITreeDecomposition * htd_io::PlanFormatImporter::import(std::istream & stream) const
+{
+    htd_io::InputBuffer input(stream);
+
+    if (!input.valid())
+    {
+        return nullptr;
+    }
+
+    return import(input.data(), input.size());
+}
+
+htd::ITreeDecomposition * htd_io::PlanFormatImporter::import(const char * data, std::size_t size) const
+{
+    if (data == nullptr || size < htd_io::PlanFormat::HEADER_SIZE || std::memcmp(data, "HTDP", 4) != 0)
+    {
+        return nullptr;
+    }
+
+    std::uint32_t version = Implementation::load<std::uint32_t>(data + 4, 0);
+    std::uint32_t byteOrderMark = Implementation::load<std::uint32_t>(data + 8, 0);
+    std::uint32_t flags = Implementation::load<std::uint32_t>(data + 12, 0);
+
+    if (version != htd_io::PlanFormat::VERSION || byteOrderMark != htd_io::PlanFormat::BYTE_ORDER_MARK || (flags & ~htd_io::PlanFormat::INDUCED_EDGES) != 0)
+    {
+        return nullptr;
+    }
+
+    std::uint64_t nodeCount = Implementation::load<std::uint64_t>(data + 16, 0);
+    std::uint64_t bagElementCount = Implementation::load<std::uint64_t>(data + 16, 2);
+    std::uint64_t edgeCount = Implementation::load<std::uint64_t>(data + 16, 3);
+    std::uint64_t edgeElementCount = Implementation::load<std::uint64_t>(data + 16, 4);
+    std::uint64_t inducedCount = Implementation::load<std::uint64_t>(data + 16, 5);
+
+    bool inducedEdges = (flags & htd_io::PlanFormat::INDUCED_EDGES) != 0;
+
+    if (nodeCount >= htd_io::PlanFormat::NO_PARENT || edgeCount >= htd_io::PlanFormat::NO_PARENT || (!inducedEdges && (edgeCount != 0 || edgeElementCount != 0 || inducedCount != 0)))
+    {
+        return nullptr;
+    }
+
+    std::size_t nodes = static_cast<std::size_t>(nodeCount);
+    std::size_t edges = static_cast<std::size_t>(edgeCount);
+
+    const char * types = nullptr;
+    const char * parents = nullptr;
+    const char * childOffsets = nullptr;
+    const char * children = nullptr;
+    const char * bagOffsets = nullptr;
+    const char * bagElements = nullptr;
+    const char * edgeIds = nullptr;
+    const char * edgeOffsets = nullptr;
+    const char * edgeElements = nullptr;
+    const char * inducedOffsets = nullptr;
+    const char * induced = nullptr;
+
+    Implementation::SectionReader reader(data, size);
+
+    /* The node types are only provided for consumers which use the input directly, the imported decomposition determines them on its own. */
+    bool success = reader.next<std::uint32_t>(nodes, types) &&
+                   reader.next<std::uint32_t>(nodes, parents) &&
+                   reader.next<std::uint64_t>(nodes + 1, childOffsets) &&
+                   reader.next<std::uint32_t>(nodes > 0 ? nodes - 1 : 0, children) &&
+                   reader.next<std::uint64_t>(nodes + 1, bagOffsets) &&
+                   reader.next<std::uint32_t>(static_cast<std::size_t>(bagElementCount), bagElements);
+
+    if (success && inducedEdges)
+    {
+        success = reader.next<std::uint64_t>(edges, edgeIds) &&
+                  reader.next<std::uint64_t>(edges + 1, edgeOffsets) &&
+                  reader.next<std::uint32_t>(static_cast<std::size_t>(edgeElementCount), edgeElements) &&
+                  reader.next<std::uint64_t>(nodes + 1, inducedOffsets) &&
+                  reader.next<std::uint32_t>(static_cast<std::size_t>(inducedCount), induced) &&
+                  Implementation::validOffsets(edgeOffsets, edges, edgeElementCount) &&
+                  Implementation::validOffsets(inducedOffsets, nodes, inducedCount);
+    }
+
+    success = success && reader.finished() &&
+              Implementation::validOffsets(childOffsets, nodes, nodes > 0 ? nodes - 1 : 0) &&
+              Implementation::validOffsets(bagOffsets, nodes, bagElementCount);
+
+    if (!success)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<htd::IHyperedgeCollection> hyperedges;
+
+    if (inducedEdges)
+    {
+        std::vector<htd::Hyperedge> edgeTable;
+
+        edgeTable.reserve(edges);
+
+        for (std::size_t index = 0; index < edges; ++index)
+        {
+            std::size_t begin = static_cast<std::size_t>(Implementation::load<std::uint64_t>(edgeOffsets, index));
+            std::size_t end = static_cast<std::size_t>(Implementation::load<std::uint64_t>(edgeOffsets, index + 1));
+
+            std::vector<htd::vertex_t> elements;
+
+            elements.reserve(end - begin);
+
+            for (std::size_t position = begin; position < end; ++position)
+            {
+                elements.push_back(Implementation::load<std::uint32_t>(edgeElements, position));
+            }
+
+            edgeTable.emplace_back(static_cast<htd::id_t>(Implementation::load<std::uint64_t>(edgeIds, index)), std::move(elements));
+        }
+
+        hyperedges.reset(new htd::HyperedgeVector(std::move(edgeTable)));
+    }
+
+    auto bagContent = [&](std::size_t node, std::vector<htd::vertex_t> & target)
+    {
+        std::size_t begin = static_cast<std::size_t>(Implementation::load<std::uint64_t>(bagOffsets, node));
+        std::size_t end = static_cast<std::size_t>(Implementation::load<std::uint64_t>(bagOffsets, node + 1));
+
+        target.clear();
+
+        target.reserve(end - begin);
+
+        bool ret = true;
+
+        for (std::size_t position = begin; ret && position < end; ++position)
+        {
+            htd::vertex_t vertex = Implementation::load<std::uint32_t>(bagElements, position);
+
+            /* Bags are sets of vertices and must therefore be sorted strictly ascending. */
+            ret = vertex != 0 && (target.empty() || target.back() < vertex);
+
+            target.push_back(vertex);
+        }
+
+        return ret;
+    };
+
+    auto inducedHyperedges = [&](std::size_t node, htd::FilteredHyperedgeCollection & target)
+    {
+        bool ret = true;
+
+        if (inducedEdges)
+        {
+            std::size_t begin = static_cast<std::size_t>(Implementation::load<std::uint64_t>(inducedOffsets, node));
+            std::size_t end = static_cast<std::size_t>(Implementation::load<std::uint64_t>(inducedOffsets, node + 1));
+
+            std::vector<htd::index_t> indices;
+
+            indices.reserve(end - begin);
+
+            for (std::size_t position = begin; ret && position < end; ++position)
+            {
+                std::uint32_t index = Implementation::load<std::uint32_t>(induced, position);
+
+                ret = index < edges;
+
+                indices.push_back(index);
+            }
+
+            target = htd::FilteredHyperedgeCollection(hyperedges, std::move(indices));
+        }
+        else
+        {
+            target = htd::FilteredHyperedgeCollection();
+        }
+
+        return ret;
+    };
+
+    htd::IMutableTreeDecomposition * ret = implementation_->managementInstance_->treeDecompositionFactory().createInstance();
+
+    if (nodes > 0)
+    {
+        std::vector<htd::vertex_t> identifiers(nodes, htd::Vertex::UNKNOWN);
+
+        std::vector<htd::vertex_t> bag;
+
+        htd::FilteredHyperedgeCollection inducedEdgeCollection;
+
+        std::size_t root = nodes - 1;
+
+        success = Implementation::load<std::uint32_t>(parents, root) == htd_io::PlanFormat::NO_PARENT &&
+                  bagContent(root, bag) && inducedHyperedges(root, inducedEdgeCollection);
+
+        if (success)
+        {
+            identifiers[root] = ret->insertRoot(std::move(bag), std::move(inducedEdgeCollection));
+        }
+
+        std::deque<std::size_t> queue;
+
+        queue.push_back(root);
+
+        std::size_t visitedNodes = 1;
+
+        while (success && !queue.empty())
+        {
+            std::size_t node = queue.front();
+
+            queue.pop_front();
+
+            std::size_t begin = static_cast<std::size_t>(Implementation::load<std::uint64_t>(childOffsets, node));
+            std::size_t end = static_cast<std::size_t>(Implementation::load<std::uint64_t>(childOffsets, node + 1));
+
+            for (std::size_t position = begin; success && position < end; ++position)
+            {
+                std::size_t child = Implementation::load<std::uint32_t>(children, position);
+
+                /* In post-order, each child precedes its parent. */
+                success = child < node &&
+                          identifiers[child] == htd::Vertex::UNKNOWN &&
+                          Implementation::load<std::uint32_t>(parents, child) == node &&
+                          bagContent(child, bag) && inducedHyperedges(child, inducedEdgeCollection);
+
+                if (success)
+                {
+                    identifiers[child] = ret->addChild(identifiers[node], std::move(bag), std::move(inducedEdgeCollection));
+
+                    queue.push_back(child);
+
+                    ++visitedNodes;
+                }
+            }
+        }
+
+        success = success && visitedNodes == nodes;
+    }
+
+    if (!success)
+    {
+        delete ret;
+
+        ret = nullptr;
+    }
+
+    return ret;
+}
+
+#endif /* HTD_IO_PLANFORMATIMPORTER_CPP */
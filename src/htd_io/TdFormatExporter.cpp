@@ -27,117 +27,228 @@
 
 #include <htd_io/TdFormatExporter.hpp>
 
-#include <sstream>
-#include <unordered_map>
+#include <cstring>
+#include <string>
+#include <vector>
 
-htd_io::TdFormatExporter::TdFormatExporter(void)
+namespace
 {
+    /**
+     *  Output buffer which collects the formatted decomposition in large blocks before they are written to the output stream.
+     */
+    class OutputBuffer
+    {
+        public:
+            /**
+             *  Constructor for an output buffer.
+             *
+             *  @param[in] outputStream The output stream to which the content of the buffer shall be written.
+             */
+            OutputBuffer(std::ostream & outputStream) : outputStream_(outputStream), buffer_(), size_(0)
+            {
+                buffer_.resize(CAPACITY + RESERVE);
+            }
 
-}
+            /**
+             *  Destructor of an output buffer. The remaining content of the buffer is written to the output stream.
+             */
+            ~OutputBuffer()
+            {
+                flush();
+            }
 
-htd_io::TdFormatExporter::~TdFormatExporter()
-{
+            /**
+             *  Append the decimal representation of the given number to the buffer.
+             *
+             *  @param[in] value    The number which shall be appended.
+             */
+            void appendNumber(std::size_t value)
+            {
+                char digits[20];
 
-}
+                char * position = digits + sizeof(digits);
 
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
-{
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
+                do
+                {
+                    *(--position) = static_cast<char>('0' + value % 10);
 
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
+                    value /= 10;
+                }
+                while (value != 0);
 
-    if (decomposition.vertexCount() > 0)
-    {
-        std::size_t index = 1;
+                std::size_t length = static_cast<std::size_t>(digits + sizeof(digits) - position);
 
-        std::stringstream tmpStream;
+                std::memcpy(&(buffer_[size_]), position, length);
 
-        for (htd::vertex_t node : decomposition.vertices())
-        {
-            tmpStream << "b " << index << " ";
-
-            indices.emplace(node, index);
+                size_ += length;
+            }
 
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
+            /**
+             *  Append a single character to the buffer.
+             *
+             *  @param[in] character    The character which shall be appended.
+             */
+            void append(char character)
             {
-                tmpStream << vertex << " ";
+                buffer_[size_++] = character;
             }
 
-            tmpStream << "\n" << std::flush;
+            /**
+             *  Append a string of at most RESERVE characters to the buffer.
+             *
+             *  @param[in] text     The characters which shall be appended.
+             *  @param[in] length   The number of characters which shall be appended.
+             */
+            void append(const char * text, std::size_t length)
+            {
+                std::memcpy(&(buffer_[size_]), text, length);
 
-            outputStream << tmpStream.rdbuf();
+                size_ += length;
+            }
 
-            tmpStream.clear();
+            /**
+             *  Write the content of the buffer to the output stream if the buffer is full.
+             *
+             *  The method must be called at least once per RESERVE characters.
+             */
+            void checkpoint(void)
+            {
+                if (size_ >= CAPACITY)
+                {
+                    flush();
+                }
+            }
 
-            ++index;
-        }
+            /**
+             *  Write the content of the buffer to the output stream.
+             */
+            void flush(void)
+            {
+                if (size_ > 0)
+                {
+                    outputStream_.write(buffer_.data(), static_cast<std::streamsize>(size_));
 
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+                    size_ = 0;
+                }
+            }
 
-        std::size_t edgeCount = decomposition.edgeCount();
+        private:
+            /**
+             *  The size of the buffer at which its content is written to the output stream.
+             */
+            static const std::size_t CAPACITY = 1 << 20;
+
+            /**
+             *  The number of characters which may be appended between two checkpoints.
+             */
+            static const std::size_t RESERVE = 64;
+
+            /**
+             *  The output stream to which the content of the buffer is written.
+             */
+            std::ostream & outputStream_;
+
+            /**
+             *  The buffer.
+             */
+            std::vector<char> buffer_;
+
+            /**
+             *  The number of characters currently stored in the buffer.
+             */
+            std::size_t size_;
+    };
+
+    /**
+     *  Write the given decomposition in the tree decomposition format 'td' to the given output stream.
+     *
+     *  @param[in] decomposition    The decomposition which shall be written.
+     *  @param[in] vertexCount      The number of vertices of the decomposed graph.
+     *  @param[in] outputStream     The output stream to which the decomposition shall be written.
+     */
+    void writeDecomposition(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
+    {
+        OutputBuffer output(outputStream);
 
-        auto it = hyperedgeCollection.begin();
+        output.append("s td ", 5);
+        output.appendNumber(decomposition.vertexCount());
+        output.append(' ');
+        output.appendNumber(decomposition.maximumBagSize());
+        output.append(' ');
+        output.appendNumber(vertexCount);
+        output.append('\n');
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
+        if (decomposition.vertexCount() > 0)
         {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+            std::vector<htd::vertex_t> nodes;
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+            nodes.reserve(decomposition.vertexCount());
 
-            ++it;
-        }
-    }
-}
+            decomposition.copyVerticesTo(nodes);
 
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
-{
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
+            /* The node identifiers are sorted, hence the last one determines the size of the dense index. */
+            std::vector<std::size_t> indices(nodes.back() + 1, 0);
 
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
+            std::size_t index = 1;
 
-    if (decomposition.vertexCount() > 0)
-    {
-        std::size_t index = 1;
+            for (htd::vertex_t node : nodes)
+            {
+                output.checkpoint();
 
-        std::stringstream tmpStream;
+                output.append("b ", 2);
+                output.appendNumber(index);
+                output.append(' ');
 
-        for (htd::vertex_t node : decomposition.vertices())
-        {
-            tmpStream << "b " << index << " ";
+                indices[node] = index;
 
-            indices.emplace(node, index);
+                for (htd::vertex_t vertex : decomposition.bagContent(node))
+                {
+                    output.checkpoint();
 
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
-            {
-                tmpStream << vertex << " ";
+                    output.appendNumber(vertex);
+                    output.append(' ');
+                }
+
+                output.append('\n');
+
+                ++index;
             }
 
-            tmpStream << "\n" << std::flush;
+            std::size_t edgeCount = decomposition.edgeCount();
 
-            outputStream << tmpStream.rdbuf();
+            for (htd::index_t position = 0; position < edgeCount; ++position)
+            {
+                const htd::Hyperedge & hyperedge = decomposition.hyperedgeAtPosition(position);
 
-            tmpStream.clear();
+                output.checkpoint();
 
-            ++index;
+                output.appendNumber(indices[hyperedge[0]]);
+                output.append(' ');
+                output.appendNumber(indices[hyperedge[1]]);
+                output.append('\n');
+            }
         }
+    }
+}
 
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+htd_io::TdFormatExporter::TdFormatExporter(void)
+{
 
-        std::size_t edgeCount = decomposition.edgeCount();
+}
 
-        auto it = hyperedgeCollection.begin();
+htd_io::TdFormatExporter::~TdFormatExporter()
+{
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+}
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeDecomposition(decomposition, graph.vertexCount(), outputStream);
+}
 
-            ++it;
-        }
-    }
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeDecomposition(decomposition, graph.vertexCount(), outputStream);
 }
 
 #endif /* HTD_IO_TDFORMATEXPORTER_CPP */
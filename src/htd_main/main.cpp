@@ -31,6 +31,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
@@ -52,6 +53,10 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(seedOption, "General Options");
 
+        htd_cli::SingleValueOption * timeLimitOption = new htd_cli::SingleValueOption("time-limit", "Terminate the algorithm after <seconds> seconds and output the best decomposition found so far.", "seconds");
+
+        manager->registerOption(timeLimitOption, "General Options");
+
         htd_cli::Choice * decompositionTypeChoice = new htd_cli::Choice("type", "Compute a graph decomposition of type <type>.", "type");
 
         decompositionTypeChoice->addPossibility("tree", "Compute a tree decomposition of the input graph.");
@@ -66,6 +71,7 @@ htd_cli::OptionManager * createOptionManager(void)
         inputFormatChoice->addPossibility("gr", "Use the input format 'gr'.");
         inputFormatChoice->addPossibility("lp", "Use the input format 'lp'.");
         inputFormatChoice->addPossibility("hgr", "Use the input format 'hgr'.");
+        inputFormatChoice->addPossibility("bin", "Use the binary graph format 'bin'.");
 
         inputFormatChoice->setDefaultValue("gr");
 
@@ -75,11 +81,16 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(inputFileOption, "Input-Specific Options");
 
+        htd_cli::SingleValueOption * convertOption = new htd_cli::SingleValueOption("convert", "Write the input graph in the binary graph format 'bin' to file <file> instead of decomposing it.", "file");
+
+        manager->registerOption(convertOption, "Input-Specific Options");
+
         htd_cli::Choice * outputFormatChoice = new htd_cli::Choice("output", "Set the output format of the decomposition to <format>.\n  (See https://github.com/mabseher/htd/blob/master/FORMATS.md for information about the available output formats.)", "format");
 
         outputFormatChoice->addPossibility("td", "Use the output format 'td'.");
         outputFormatChoice->addPossibility("human", "Provide a human-readable output of the decomposition.");
         outputFormatChoice->addPossibility("width", "Provide only the maximum bag size of the decomposition.");
+        outputFormatChoice->addPossibility("plan", "Use the binary execution plan format 'plan'.");
 
         outputFormatChoice->setDefaultValue("td");
 
@@ -94,6 +105,7 @@ htd_cli::OptionManager * createOptionManager(void)
         strategyChoice->addPossibility("random", "Use a random vertex ordering.");
         strategyChoice->addPossibility("min-fill", "Minimum fill ordering algorithm");
         strategyChoice->addPossibility("min-degree", "Minimum degree ordering algorithm");
+        strategyChoice->addPossibility("min-degree-approximate", "Approximate minimum degree ordering algorithm (AMD)");
         strategyChoice->addPossibility("min-separator", "Minimum separating vertex set heuristic");
         strategyChoice->addPossibility("max-cardinality", "Maximum cardinality search ordering algorithm");
         strategyChoice->addPossibility("max-cardinality-enhanced", "Enhanced maximum cardinality search ordering algorithm (MCS-M)");
@@ -109,6 +121,7 @@ htd_cli::OptionManager * createOptionManager(void)
         preprocessingChoice->addPossibility("simple", "Use simple preprocessing capabilities.");
         preprocessingChoice->addPossibility("advanced", "Use advanced preprocessing capabilities.");
         preprocessingChoice->addPossibility("full", "Use the full set of preprocessing capabilities.");
+        preprocessingChoice->addPossibility("split", "Use the full set of preprocessing capabilities and split the input graph at safe separators.");
 
         preprocessingChoice->setDefaultValue("none");
 
@@ -118,6 +131,10 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(triangulationMinimizationOption, "Algorithm Options");
 
+        htd_cli::Option * componentsOption = new htd_cli::Option("components", "Decompose the connected components of the input graph independently and concurrently.");
+
+        manager->registerOption(componentsOption, "Algorithm Options");
+
         htd_cli::Choice * optimizationChoice = new htd_cli::Choice("opt", "Iteratively compute a decomposition which optimizes <criterion>.", "criterion");
 
         optimizationChoice->addPossibility("none", "Do not perform any optimization.");
@@ -174,6 +191,8 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & seedOption = optionManager.accessSingleValueOption("seed");
 
+    const htd_cli::SingleValueOption & timeLimitOption = optionManager.accessSingleValueOption("time-limit");
+
     const htd_cli::SingleValueOption & instanceOption = optionManager.accessSingleValueOption("instance");
 
     const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
@@ -239,6 +258,55 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret && timeLimitOption.used())
+    {
+        std::size_t index = 0;
+
+        const std::string & value = timeLimitOption.value();
+
+        if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+        {
+            std::cerr << "INVALID TIME LIMIT: " << timeLimitOption.value() << std::endl;
+
+            ret = false;
+        }
+
+        if (ret)
+        {
+            unsigned long timeLimit = 0;
+
+            try
+            {
+                timeLimit = std::stoul(value, &index, 10);
+            }
+            catch (const std::out_of_range &)
+            {
+                index = 0;
+            }
+
+            if (index != value.length())
+            {
+                std::cerr << "INVALID TIME LIMIT: " << value << std::endl;
+
+                ret = false;
+            }
+            else
+            {
+                /* Clamp the time limit so that the conversion to the clock's resolution does not overflow. */
+                std::chrono::seconds maximumTimeLimit = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::duration::max());
+
+                if (timeLimit > static_cast<unsigned long>(maximumTimeLimit.count()))
+                {
+                    manager->setTimeout(std::chrono::steady_clock::duration::max());
+                }
+                else
+                {
+                    manager->setTimeout(std::chrono::seconds(timeLimit));
+                }
+            }
+        }
+    }
+
     if (ret)
     {
         if (instanceOption.used())
@@ -266,6 +334,10 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         {
             manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
         }
+        else if (value == "min-degree-approximate")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::ApproximateMinDegreeOrderingAlgorithm(manager));
+        }
         else if (value == "min-separator")
         {
             if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
@@ -535,8 +607,25 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
+        importer.setThreadCount(0);
+
         decompose(*manager, algorithm, importer.import(std::cin), exporter);
     }
+    else if (inputFormat == "bin")
+    {
+        htd_io::BinFormatImporter importer(manager);
+
+        htd_io::InputBuffer input(std::cin);
+
+        if (importer.containsVertexNames(input.data(), input.size()))
+        {
+            decomposeNamed(*manager, algorithm, importer.importNamed(input.data(), input.size()), exporter);
+        }
+        else
+        {
+            decompose(*manager, algorithm, importer.import(input.data(), input.size()), exporter);
+        }
+    }
 }
 
 template <typename DecompositionAlgorithm, typename Exporter>
@@ -558,8 +647,90 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
+        importer.setThreadCount(0);
+
         decompose(*manager, algorithm, importer.import(instanceFile), exporter);
     }
+    else if (inputFormat == "bin")
+    {
+        htd_io::BinFormatImporter importer(manager);
+
+        htd_io::InputBuffer input(instanceFile);
+
+        if (importer.containsVertexNames(input.data(), input.size()))
+        {
+            decomposeNamed(*manager, algorithm, importer.importNamed(input.data(), input.size()), exporter);
+        }
+        else
+        {
+            decompose(*manager, algorithm, importer.import(input.data(), input.size()), exporter);
+        }
+    }
+}
+
+template <typename GraphType>
+bool writeBinaryGraph(GraphType * graph, const std::string & outputFile)
+{
+    bool ret = false;
+
+    if (graph != nullptr)
+    {
+        std::ofstream outputStream(outputFile, std::ios::out | std::ios::binary);
+
+        htd_io::BinFormatExporter exporter;
+
+        exporter.write(*graph, outputStream);
+
+        ret = outputStream.good();
+
+        delete graph;
+    }
+
+    return ret;
+}
+
+template <typename Source>
+bool convert(Source & source, const std::string & inputFormat, const htd::LibraryInstance * const manager, const std::string & outputFile)
+{
+    bool ret = false;
+
+    if (inputFormat == "gr")
+    {
+        htd_io::GrFormatImporter importer(manager);
+
+        ret = writeBinaryGraph(importer.import(source), outputFile);
+    }
+    else if (inputFormat == "lp")
+    {
+        htd_io::LpFormatImporter importer(manager);
+
+        ret = writeBinaryGraph(importer.import(source), outputFile);
+    }
+    else if (inputFormat == "hgr")
+    {
+        htd_io::HgrFormatImporter importer(manager);
+
+        importer.setThreadCount(0);
+
+        ret = writeBinaryGraph(importer.import(source), outputFile);
+    }
+    else if (inputFormat == "bin")
+    {
+        htd_io::BinFormatImporter importer(manager);
+
+        htd_io::InputBuffer input(source);
+
+        if (importer.containsVertexNames(input.data(), input.size()))
+        {
+            ret = writeBinaryGraph(importer.importNamed(input.data(), input.size()), outputFile);
+        }
+        else
+        {
+            ret = writeBinaryGraph(importer.import(input.data(), input.size()), outputFile);
+        }
+    }
+
+    return ret;
 }
 
 void handleSignal(int signal)
@@ -620,6 +791,10 @@ int main(int argc, const char * const * const argv)
 
         const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
 
+        const htd_cli::Option & componentsOption = optionManager->accessOption("components");
+
+        const htd_cli::SingleValueOption & convertOption = optionManager->accessSingleValueOption("convert");
+
         const std::string & outputFormat = outputFormatChoice.value();
 
         bool hypertreeDecompositionRequested = decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree";
@@ -641,7 +816,29 @@ int main(int argc, const char * const * const argv)
             libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
         }
 
-        if (hypertreeDecompositionRequested)
+        if (convertOption.used())
+        {
+            bool converted = false;
+
+            if (instanceOption.used())
+            {
+                std::string instanceFile(instanceOption.value());
+
+                converted = convert(instanceFile, inputFormatChoice.value(), libraryInstance, convertOption.value());
+            }
+            else
+            {
+                converted = convert(std::cin, inputFormatChoice.value(), libraryInstance, convertOption.value());
+            }
+
+            if (!converted)
+            {
+                std::cerr << "CONVERSION FAILED!" << std::endl;
+
+                ret = 1;
+            }
+        }
+        else if (hypertreeDecompositionRequested)
         {
             htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
 
@@ -686,6 +883,19 @@ int main(int argc, const char * const * const argv)
             {
                 exporter = new htd_io::TdFormatExporter();
             }
+            else if (outputFormat == "plan")
+            {
+                if (printProgressOption.used())
+                {
+                    std::cerr << "OUTPUT FORMAT 'plan' CANNOT BE COMBINED WITH OPTION --print-progress!" << std::endl;
+
+                    error = true;
+                }
+                else
+                {
+                    exporter = new htd_io::PlanFormatExporter();
+                }
+            }
             else if (outputFormat == "human")
             {
                 exporter = new htd_io::HumanReadableExporter();
@@ -832,6 +1042,26 @@ int main(int argc, const char * const * const argv)
                     preprocessor->setIterationCount(256);
                     preprocessor->setNonImprovementLimit(64);
                 }
+                else if (std::string(preprocessingChoice.value()) == "split")
+                {
+                    preprocessor->setPreprocessingStrategy(4);
+
+                    preprocessor->setIterationCount(256);
+                    preprocessor->setNonImprovementLimit(64);
+                    preprocessor->setThreadCount(0);
+                }
+
+                if (componentsOption.used())
+                {
+                    htd::ConnectedComponentTreeDecompositionAlgorithm * algorithm =
+                        new htd::ConnectedComponentTreeDecompositionAlgorithm(libraryInstance, libraryInstance->treeDecompositionAlgorithmFactory().createInstance());
+
+                    algorithm->setThreadCount(0);
+
+                    libraryInstance->graphPreprocessorFactory().setConstructionTemplate(preprocessor->clone());
+
+                    libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
+                }
 
                 htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
 
@@ -847,6 +1077,10 @@ int main(int argc, const char * const * const argv)
                 {
                     processor = new htd_io::LpFormatGraphToTreeDecompositionProcessor(libraryInstance);
                 }
+                else if (std::string(inputFormatChoice.value()) == "bin")
+                {
+                    processor = new htd_io::BinFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                }
                 else
                 {
                     std::cerr << "INVALID INPUT FORMAT: " << inputFormatChoice.value() << std::endl;
@@ -0,0 +1,289 @@
+/*
+ * File:   ApproximateMinDegreeOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class ApproximateMinDegreeOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        ApproximateMinDegreeOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ApproximateMinDegreeOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the maximum bag size of the decomposition obtained via bucket elimination using the given ordering.
+ *
+ *  @return The maximum bag size or 0 if the ordering is not a permutation of the vertices of the graph.
+ */
+std::size_t eliminationWidth(htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 1;
+
+    std::vector<htd::vertex_t> sortedOrdering(ordering);
+
+    std::sort(sortedOrdering.begin(), sortedOrdering.end());
+
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    if (sortedOrdering != vertices)
+    {
+        return 0;
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(graph.neighbors(vertex).begin(), graph.neighbors(vertex).end());
+
+        ret = std::max(ret, neighbors.size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 < neighbor2 && !graph.isNeighbor(neighbor1, neighbor2))
+                {
+                    graph.addEdge(neighbor1, neighbor2);
+                }
+            }
+        }
+
+        graph.removeVertex(vertex);
+    }
+
+    return ret;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance1);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckSize2Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 2);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)2, ordering->sequence().size());
+
+    if ((ordering->sequence()[0] != 1 || ordering->sequence()[1] != 2) &&
+        (ordering->sequence()[0] != 2 || ordering->sequence()[1] != 1))
+    {
+        FAIL();
+    }
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckTree)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(3, 6);
+    graph.addEdge(3, 7);
+    graph.addEdge(7, 8);
+    graph.addEdge(7, 9);
+    graph.addEdge(9, 10);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+    ASSERT_EQ((std::size_t)2, ordering->maximumBagSize());
+    ASSERT_EQ((std::size_t)2, eliminationWidth(graph, ordering->sequence()));
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckSimpleGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    graph.addEdge(1,4);
+    graph.addEdge(2,3);
+    graph.addEdge(2,8);
+    graph.addEdge(3,10);
+    graph.addEdge(3,4);
+    graph.addEdge(4,10);
+    graph.addEdge(4,7);
+    graph.addEdge(5,1);
+    graph.addEdge(5,7);
+    graph.addEdge(5,4);
+    graph.addEdge(6,7);
+    graph.addEdge(6,8);
+    graph.addEdge(7,9);
+    graph.addEdge(8,7);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+    ASSERT_EQ(ordering->maximumBagSize(), eliminationWidth(graph, ordering->sequence()));
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t dimension = 12;
+
+    for (std::size_t iteration = 0; iteration < 10; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance, dimension * dimension);
+
+        for (htd::vertex_t row = 0; row < dimension; ++row)
+        {
+            for (htd::vertex_t column = 0; column < dimension; ++column)
+            {
+                htd::vertex_t vertex = row * dimension + column + 1;
+
+                if (column + 1 < dimension)
+                {
+                    graph.addEdge(vertex, vertex + 1);
+                }
+
+                if (row + 1 < dimension)
+                {
+                    graph.addEdge(vertex, vertex + dimension);
+                }
+            }
+        }
+
+        htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+        const htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+        ASSERT_GE(ordering->maximumBagSize(), dimension + 1);
+        ASSERT_EQ(ordering->maximumBagSize(), eliminationWidth(graph, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckWidthLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 6; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 6; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IWidthLimitedVertexOrdering * ordering1 = algorithm.computeOrdering(graph, 6, 1);
+
+    ASSERT_EQ((std::size_t)6, ordering1->sequence().size());
+    ASSERT_EQ((std::size_t)6, ordering1->maximumBagSize());
+
+    const htd::IWidthLimitedVertexOrdering * ordering2 = algorithm.computeOrdering(graph, 5, 0);
+
+    ASSERT_TRUE(ordering2->sequence().empty());
+
+    delete libraryInstance;
+    delete ordering1;
+    delete ordering2;
+}
@@ -0,0 +1,243 @@
+/*
+ * File:   BucketPriorityQueueTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <vector>
+
+class BucketPriorityQueueTest : public ::testing::Test
+{
+    public:
+        BucketPriorityQueueTest(void)
+        {
+
+        }
+
+        virtual ~BucketPriorityQueueTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(BucketPriorityQueueTest, CheckEmptyQueue)
+{
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(5, 5);
+
+    ASSERT_TRUE(priorityQueue.empty());
+    ASSERT_EQ((std::size_t)0, priorityQueue.size());
+
+    for (htd::vertex_t vertex = 0; vertex < 5; ++vertex)
+    {
+        ASSERT_FALSE(priorityQueue.contains(vertex));
+        ASSERT_FALSE(priorityQueue.erase(vertex));
+    }
+}
+
+TEST(BucketPriorityQueueTest, CheckPushAndPop)
+{
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(6, 4);
+
+    priorityQueue.push(0, 3);
+    priorityQueue.push(1, 1);
+    priorityQueue.push(2, 7);
+    priorityQueue.push(3, 1);
+    priorityQueue.push(4, 2);
+    priorityQueue.push(5, 12);
+
+    ASSERT_FALSE(priorityQueue.empty());
+    ASSERT_EQ((std::size_t)6, priorityQueue.size());
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.topPriority());
+    ASSERT_EQ((std::size_t)2, priorityQueue.topCollection().size());
+
+    ASSERT_EQ((std::size_t)7, priorityQueue.priority(2));
+    ASSERT_EQ((std::size_t)12, priorityQueue.priority(5));
+
+    std::vector<std::size_t> priorities;
+
+    std::vector<htd::vertex_t> sequence;
+
+    while (!priorityQueue.empty())
+    {
+        priorities.push_back(priorityQueue.topPriority());
+
+        sequence.push_back(priorityQueue.top());
+
+        priorityQueue.pop();
+    }
+
+    ASSERT_EQ((std::size_t)6, sequence.size());
+
+    ASSERT_EQ(std::vector<std::size_t>({ 1, 1, 2, 3, 7, 12 }), priorities);
+
+    ASSERT_EQ((htd::vertex_t)4, sequence[2]);
+    ASSERT_EQ((htd::vertex_t)0, sequence[3]);
+    ASSERT_EQ((htd::vertex_t)2, sequence[4]);
+    ASSERT_EQ((htd::vertex_t)5, sequence[5]);
+
+    for (htd::vertex_t vertex = 0; vertex < 6; ++vertex)
+    {
+        ASSERT_FALSE(priorityQueue.contains(vertex));
+    }
+}
+
+TEST(BucketPriorityQueueTest, CheckUpdatePriority)
+{
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(4, 3);
+
+    priorityQueue.push(0, 0);
+    priorityQueue.push(1, 1);
+    priorityQueue.push(2, 2);
+    priorityQueue.push(3, 5);
+
+    priorityQueue.updatePriority(0, 4);
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)1, priorityQueue.top());
+
+    priorityQueue.updatePriority(3, 0);
+
+    ASSERT_EQ((std::size_t)0, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)3, priorityQueue.top());
+
+    priorityQueue.updatePriority(3, 3);
+    priorityQueue.updatePriority(1, 6);
+
+    ASSERT_EQ((std::size_t)2, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)2, priorityQueue.top());
+
+    ASSERT_TRUE(priorityQueue.erase(2));
+    ASSERT_FALSE(priorityQueue.erase(2));
+
+    ASSERT_EQ((std::size_t)3, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)3, priorityQueue.top());
+
+    ASSERT_FALSE(priorityQueue.eraseFromTopCollection(0));
+    ASSERT_TRUE(priorityQueue.eraseFromTopCollection(3));
+
+    ASSERT_EQ((std::size_t)4, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)0, priorityQueue.top());
+
+    priorityQueue.pop();
+
+    ASSERT_EQ((std::size_t)6, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)1, priorityQueue.top());
+
+    priorityQueue.pop();
+
+    ASSERT_TRUE(priorityQueue.empty());
+}
+
+TEST(BucketPriorityQueueTest, CheckAlternatingPushAndErase)
+{
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(3, 1000);
+
+    priorityQueue.push(0, 999);
+
+    for (std::size_t iteration = 0; iteration < 1000; ++iteration)
+    {
+        priorityQueue.push(1, iteration % 10);
+        priorityQueue.push(2, 500);
+
+        ASSERT_EQ(iteration % 10, priorityQueue.topPriority());
+        ASSERT_EQ((htd::vertex_t)1, priorityQueue.top());
+
+        ASSERT_TRUE(priorityQueue.erase(1));
+
+        ASSERT_EQ((std::size_t)500, priorityQueue.topPriority());
+
+        ASSERT_TRUE(priorityQueue.erase(2));
+    }
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.size());
+    ASSERT_EQ((std::size_t)999, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)0, priorityQueue.top());
+
+    priorityQueue.updatePriority(0, 3);
+
+    ASSERT_EQ((std::size_t)3, priorityQueue.topPriority());
+}
+
+TEST(BucketPriorityQueueTest, CheckConsistencyWithPriorityQueue)
+{
+    const std::size_t size = 200;
+
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue1(size, 16);
+
+    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue2;
+
+    std::vector<std::size_t> priorities(size);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        priorities[vertex] = (vertex * 7919) % 37;
+
+        priorityQueue1.push(vertex, priorities[vertex]);
+        priorityQueue2.push(vertex, priorities[vertex]);
+    }
+
+    for (htd::vertex_t vertex = 0; vertex < size; vertex += 3)
+    {
+        std::size_t newPriority = (vertex * 104729) % 23;
+
+        priorityQueue1.updatePriority(vertex, newPriority);
+        priorityQueue2.updatePriority(vertex, priorities[vertex], newPriority);
+
+        priorities[vertex] = newPriority;
+    }
+
+    while (!priorityQueue2.empty())
+    {
+        ASSERT_EQ(priorityQueue2.size(), priorityQueue1.size());
+        ASSERT_EQ(priorityQueue2.topPriority(), priorityQueue1.topPriority());
+
+        std::vector<htd::vertex_t> topCollection1(priorityQueue1.topCollection().begin(), priorityQueue1.topCollection().end());
+        std::vector<htd::vertex_t> topCollection2(priorityQueue2.topCollection().begin(), priorityQueue2.topCollection().end());
+
+        std::sort(topCollection1.begin(), topCollection1.end());
+        std::sort(topCollection2.begin(), topCollection2.end());
+
+        ASSERT_EQ(topCollection2, topCollection1);
+
+        htd::vertex_t vertex = topCollection2[topCollection2.size() / 2];
+
+        priorityQueue1.eraseFromTopCollection(vertex);
+        priorityQueue2.eraseFromTopCollection(vertex);
+    }
+
+    ASSERT_TRUE(priorityQueue1.empty());
+}
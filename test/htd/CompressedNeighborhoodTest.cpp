@@ -0,0 +1,164 @@
+/*
+ * File:   CompressedNeighborhoodTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <vector>
+
+class CompressedNeighborhoodTest : public ::testing::Test
+{
+    public:
+        CompressedNeighborhoodTest(void)
+        {
+
+        }
+
+        virtual ~CompressedNeighborhoodTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(CompressedNeighborhoodTest, CheckEmptyNeighborhood)
+{
+    htd::CompressedNeighborhood neighborhood;
+
+    ASSERT_EQ((std::size_t)0, neighborhood.vertexCount());
+    ASSERT_EQ((std::size_t)0, neighborhood.entryCount());
+
+    ASSERT_EQ((std::size_t)1, neighborhood.offsets().size());
+    ASSERT_EQ((std::size_t)0, neighborhood.neighbors().size());
+
+    std::vector<std::vector<htd::vertex_t>> workingCopy { { 1 }, { 0 } };
+
+    neighborhood.copyTo(workingCopy);
+
+    ASSERT_TRUE(workingCopy.empty());
+}
+
+TEST(CompressedNeighborhoodTest, CheckAccessors)
+{
+    std::vector<std::vector<htd::vertex_t>> input { { 1, 2 }, { 0, 2, 3 }, { 0, 1 }, { 1 }, { } };
+
+    htd::CompressedNeighborhood neighborhood(input);
+
+    ASSERT_EQ((std::size_t)5, neighborhood.vertexCount());
+    ASSERT_EQ((std::size_t)8, neighborhood.entryCount());
+
+    ASSERT_EQ(std::vector<htd::index_t>({ 0, 2, 5, 7, 8, 8 }), neighborhood.offsets());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 0, 2, 3, 0, 1, 1 }), neighborhood.neighbors());
+
+    for (htd::vertex_t vertex = 0; vertex < input.size(); ++vertex)
+    {
+        ASSERT_EQ(input[vertex].size(), neighborhood.neighborCount(vertex));
+
+        ASSERT_EQ(input[vertex], std::vector<htd::vertex_t>(neighborhood.begin(vertex), neighborhood.end(vertex)));
+
+        for (htd::index_t index = 0; index < input[vertex].size(); ++index)
+        {
+            ASSERT_EQ(input[vertex][index], neighborhood.neighborAtPosition(vertex, index));
+        }
+
+        for (htd::vertex_t neighbor = 0; neighbor < input.size(); ++neighbor)
+        {
+            ASSERT_EQ(std::binary_search(input[vertex].begin(), input[vertex].end(), neighbor), neighborhood.isNeighbor(vertex, neighbor));
+        }
+    }
+
+    std::vector<htd::vertex_t> target { 7 };
+
+    neighborhood.copyNeighborsTo(1, target);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 7, 0, 2, 3 }), target);
+}
+
+TEST(CompressedNeighborhoodTest, CheckWorkingCopy)
+{
+    std::vector<std::vector<htd::vertex_t>> input { { 1, 2 }, { 0, 2 }, { 0, 1 } };
+
+    htd::CompressedNeighborhood neighborhood(input);
+
+    std::vector<std::vector<htd::vertex_t>> workingCopy;
+
+    neighborhood.copyTo(workingCopy);
+
+    ASSERT_EQ(input, workingCopy);
+
+    workingCopy[0].clear();
+    workingCopy[1].push_back(5);
+    workingCopy.push_back(std::vector<htd::vertex_t> { 3 });
+
+    neighborhood.copyTo(workingCopy);
+
+    ASSERT_EQ(input, workingCopy);
+}
+
+TEST(CompressedNeighborhoodTest, CheckPreprocessedGraphRepresentations)
+{
+    htd::PreprocessedGraph preprocessedGraph(std::vector<htd::vertex_t> { 1, 2, 3, 4 },
+                                             std::vector<std::vector<htd::vertex_t>> { { 1, 2, 3 }, { 0, 2 }, { 0, 1 }, { 0 } },
+                                             std::vector<htd::vertex_t>(),
+                                             std::vector<htd::vertex_t> { 0, 1, 2, 3 },
+                                             4, 0);
+
+    const htd::PreprocessedGraph & constGraph = preprocessedGraph;
+
+    ASSERT_EQ((std::size_t)4, constGraph.edgeCount());
+    ASSERT_EQ((std::size_t)4, constGraph.compressedNeighborhood().vertexCount());
+    ASSERT_EQ((std::size_t)3, constGraph.neighborCount(0));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 0, 1 }), constGraph.neighborhood(2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 0, 2 }), std::vector<htd::vertex_t>(constGraph.neighbors(1).begin(), constGraph.neighbors(1).end()));
+
+    preprocessedGraph.removeVertex(3);
+
+    ASSERT_EQ((std::size_t)3, constGraph.edgeCount());
+    ASSERT_EQ((std::size_t)2, constGraph.neighborCount(0));
+    ASSERT_FALSE(constGraph.isNeighbor(0, 3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), std::vector<htd::vertex_t>(constGraph.compressedNeighborhood().begin(0), constGraph.compressedNeighborhood().end(0)));
+    ASSERT_EQ((std::size_t)0, constGraph.compressedNeighborhood().neighborCount(3));
+
+    preprocessedGraph.neighborhood(1).push_back(3);
+
+    ASSERT_TRUE(constGraph.isNeighbor(1, 3));
+
+    htd::PreprocessedGraph * clone = constGraph.clone();
+
+    ASSERT_EQ(constGraph.neighborhood(), clone->neighborhood());
+    ASSERT_EQ(constGraph.compressedNeighborhood().neighbors(), clone->compressedNeighborhood().neighbors());
+
+    delete clone;
+}
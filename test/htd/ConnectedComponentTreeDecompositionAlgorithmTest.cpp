@@ -0,0 +1,238 @@
+/*
+ * File:   ConnectedComponentTreeDecompositionAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <vector>
+
+class ConnectedComponentTreeDecompositionAlgorithmTest : public ::testing::Test
+{
+    public:
+        ConnectedComponentTreeDecompositionAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ConnectedComponentTreeDecompositionAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->bagSize(decomposition->root()), (std::size_t)0);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+static void createDisconnectedGraph(htd::MultiHypergraph & graph)
+{
+    /* Component 1: A 4-clique on the vertices 1, 2, 3 and 4 (width 3). */
+    graph.addVertices(4);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 4; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 4; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    /* Component 2: An isolated vertex. */
+    graph.addVertex();
+
+    /* Component 3: A path of length 4 with a hyperedge spanning three vertices (width 2). */
+    graph.addVertices(5);
+
+    graph.addEdge(6, 7);
+    graph.addEdge(7, 8);
+    graph.addEdge(8, 9);
+    graph.addEdge(9, 10);
+    graph.addEdge(std::vector<htd::vertex_t> { 6, 8, 10 });
+
+    /* Component 4: A triangle whose vertices are not contiguous (width 2). */
+    graph.addVertices(3);
+
+    graph.removeVertex(12);
+
+    graph.addVertex();
+
+    graph.addEdge(11, 13);
+    graph.addEdge(13, 14);
+    graph.addEdge(14, 11);
+}
+
+static void checkDisconnectedGraph(std::size_t threadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, baseAlgorithm);
+
+    algorithm.setThreadCount(threadCount);
+
+    EXPECT_EQ(algorithm.threadCount(), threadCount);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)4);
+
+    for (htd::vertex_t node : decomposition->vertices())
+    {
+        for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(node))
+        {
+            EXPECT_TRUE(graph.isEdge(hyperedge.id()));
+
+            EXPECT_TRUE(std::includes(decomposition->bagContent(node).begin(), decomposition->bagContent(node).end(),
+                                      hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()));
+        }
+    }
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraph)
+{
+    checkDisconnectedGraph(1);
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphInParallel)
+{
+    checkDisconnectedGraph(2);
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphWithPreprocessedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    algorithm.setThreadCount(2);
+
+    for (std::size_t strategy = 0; strategy <= 4; ++strategy)
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(strategy);
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)4);
+
+        delete decomposition;
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultWithManipulationOperations)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(0);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, 1, new htd::NormalizationOperation(libraryInstance));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    for (htd::vertex_t node : decomposition->vertices())
+    {
+        EXPECT_LE(decomposition->childCount(node), (std::size_t)2);
+    }
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <numeric>
 #include <vector>
 
 class GraphPreprocessorTest : public ::testing::Test
@@ -1457,6 +1458,252 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+void addTorusEdges(htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & vertices, std::size_t columns)
+{
+    std::size_t rows = vertices.size() / columns;
+
+    for (htd::index_t row = 0; row < rows; ++row)
+    {
+        for (htd::index_t column = 0; column < columns; ++column)
+        {
+            graph.addEdge(vertices[row * columns + column], vertices[row * columns + (column + 1) % columns]);
+            graph.addEdge(vertices[row * columns + column], vertices[((row + 1) % rows) * columns + column]);
+        }
+    }
+}
+
+void checkSafeSeparatorSplitting(std::size_t threadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 55);
+
+    std::vector<htd::vertex_t> torus1(25);
+    std::vector<htd::vertex_t> torus2(16);
+    std::vector<htd::vertex_t> torus3(16);
+
+    // A 5x5 torus containing the vertices 1 to 25 which cannot be reduced by the reduction rules.
+    std::iota(torus1.begin(), torus1.end(), 1);
+
+    // A 4x4 torus attached to the articulation point 25.
+    torus2[0] = 25;
+    std::iota(torus2.begin() + 1, torus2.end(), 26);
+
+    // A 4x4 torus attached to the clique minimal separator {1, 2}.
+    torus3[0] = 1;
+    torus3[1] = 2;
+    std::iota(torus3.begin() + 2, torus3.end(), 41);
+
+    addTorusEdges(graph, torus1, 5);
+    addTorusEdges(graph, torus2, 4);
+    addTorusEdges(graph, torus3, 4);
+
+    // Vertex 55 remains isolated.
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(4);
+    preprocessor.setIterationCount(16);
+    preprocessor.setThreadCount(threadCount);
+
+    ASSERT_EQ(threadCount, preprocessor.threadCount());
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    ASSERT_EQ(graph.vertexCount(), preprocessedGraph->remainingVertices().size() +
+                                   preprocessedGraph->eliminationSequence().size());
+
+    std::vector<htd::vertex_t> vertices(preprocessedGraph->eliminationSequence());
+
+    ASSERT_EQ((std::size_t)25, preprocessedGraph->remainingVertices().size());
+
+    for (htd::vertex_t vertex : preprocessedGraph->remainingVertices())
+    {
+        // Only vertices of the largest atom may remain.
+        ASSERT_LE(preprocessedGraph->vertexName(vertex), (htd::vertex_t)25);
+
+        vertices.push_back(preprocessedGraph->vertexName(vertex));
+    }
+
+    std::sort(vertices.begin(), vertices.end());
+
+    ASSERT_TRUE(vertices == graph.vertexVector());
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    ASSERT_GE(decomposition->maximumBagSize(), preprocessedGraph->eliminationSequenceWidth() + 1);
+
+    // The heuristic orderings of the split-off tori only restrict the width of the decomposition, they do not prove a lower bound.
+    ASSERT_GE(preprocessedGraph->eliminationSequenceWidth(), (std::size_t)4);
+    ASSERT_LE(preprocessedGraph->minTreeWidth(), (std::size_t)3);
+
+    delete decomposition;
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckSafeSeparatorSplitting)
+{
+    checkSafeSeparatorSplitting(1);
+}
+
+TEST(GraphPreprocessorTest, CheckSafeSeparatorSplittingInParallel)
+{
+    checkSafeSeparatorSplitting(2);
+}
+
+TEST(GraphPreprocessorTest, CheckNeighborhoodInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 30);
+
+    std::vector<htd::vertex_t> vertices(25);
+
+    std::iota(vertices.begin(), vertices.end(), 1);
+
+    addTorusEdges(graph, vertices, 5);
+
+    graph.addEdge(25, 26);
+    graph.addEdge(26, 27);
+    graph.addEdge(27, 28);
+    graph.addEdge(28, 26);
+    graph.addEdge(29, 30);
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(graph.vertexCount());
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            neighborhood[vertex - 1].push_back(neighbor - 1);
+        }
+    }
+
+    for (std::size_t level = 0; level <= 4; ++level)
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(level);
+
+        htd::IPreprocessedGraph * expectedResult = preprocessor.prepare(graph);
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(std::vector<std::vector<htd::vertex_t>>(neighborhood), graph.edgeCount());
+
+        ASSERT_NE(preprocessedGraph, nullptr);
+
+        EXPECT_EQ(preprocessedGraph->inputGraphVertexCount(), graph.vertexCount());
+        EXPECT_EQ(preprocessedGraph->inputGraphEdgeCount(), graph.edgeCount());
+        EXPECT_EQ(preprocessedGraph->vertexNames(), expectedResult->vertexNames());
+        EXPECT_EQ(preprocessedGraph->remainingVertices(), expectedResult->remainingVertices());
+        EXPECT_EQ(preprocessedGraph->minTreeWidth(), expectedResult->minTreeWidth());
+        EXPECT_EQ(preprocessedGraph->edgeCount(), expectedResult->edgeCount());
+
+        if (level < 4)
+        {
+            /* Splitting at safe separators involves randomized ordering algorithms, hence only the deterministic levels are compared exactly. */
+            EXPECT_EQ(preprocessedGraph->eliminationSequence(), expectedResult->eliminationSequence());
+        }
+
+        delete expectedResult;
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+/**
+ *  Preprocessor which implements only the mandatory members of htd::IGraphPreprocessor.
+ */
+class ForwardingGraphPreprocessor : public htd::IGraphPreprocessor
+{
+    public:
+        ForwardingGraphPreprocessor(const htd::LibraryInstance * const manager) : preprocessor_(manager)
+        {
+
+        }
+
+        virtual ~ForwardingGraphPreprocessor()
+        {
+
+        }
+
+        htd::IPreprocessedGraph * prepare(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE
+        {
+            return preprocessor_.prepare(graph);
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return preprocessor_.managementInstance();
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+        {
+            preprocessor_.setManagementInstance(manager);
+        }
+
+        ForwardingGraphPreprocessor * clone(void) const HTD_OVERRIDE
+        {
+            return new ForwardingGraphPreprocessor(preprocessor_.managementInstance());
+        }
+
+    private:
+        htd::GraphPreprocessor preprocessor_;
+};
+
+TEST(GraphPreprocessorTest, CheckNeighborhoodInputWithCustomPreprocessor)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+    graph.addEdge(3, 4);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 7);
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(graph.vertexCount());
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            neighborhood[vertex - 1].push_back(neighbor - 1);
+        }
+    }
+
+    ForwardingGraphPreprocessor preprocessor(libraryInstance);
+
+    const htd::IGraphPreprocessor & basePreprocessor = preprocessor;
+
+    htd::IPreprocessedGraph * expectedResult = preprocessor.prepare(graph);
+
+    htd::IPreprocessedGraph * preprocessedGraph = basePreprocessor.prepare(std::move(neighborhood), graph.edgeCount());
+
+    ASSERT_NE(preprocessedGraph, nullptr);
+
+    EXPECT_EQ(preprocessedGraph->inputGraphVertexCount(), graph.vertexCount());
+    EXPECT_EQ(preprocessedGraph->inputGraphEdgeCount(), graph.edgeCount());
+    EXPECT_EQ(preprocessedGraph->vertexNames(), expectedResult->vertexNames());
+    EXPECT_EQ(preprocessedGraph->remainingVertices(), expectedResult->remainingVertices());
+    EXPECT_EQ(preprocessedGraph->eliminationSequence(), expectedResult->eliminationSequence());
+
+    delete expectedResult;
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
 #include <vector>
 
 class GraphTest : public ::testing::Test
@@ -111,6 +112,35 @@ TEST(GraphTest, CheckSizeInitializedGraph1)
     delete libraryInstance;
 }
 
+TEST(GraphTest, CheckVertexVector)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance, 4);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(3, 4);
+
+    graph.removeVertex(2);
+
+    const htd::IGraphStructure & structure = graph;
+
+    const std::vector<htd::vertex_t> & vertices = structure.vertexVector();
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 4 }), vertices);
+
+    htd::ConstCollection<htd::vertex_t> vertexCollection = graph.vertices();
+
+    ASSERT_TRUE(std::equal(vertexCollection.begin(), vertexCollection.end(), vertices.begin()));
+
+    htd::vertex_t newVertex = graph.addVertex();
+
+    ASSERT_EQ((std::size_t)4, structure.vertexVector().size());
+    ASSERT_EQ(newVertex, structure.vertexVector().back());
+
+    delete libraryInstance;
+}
+
 TEST(GraphTest, CheckSizeInitializedGraph2)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -161,6 +161,124 @@ TEST(LabelingCollectionTest, TestLabelingCollectionWithOneLabeling)
     ASSERT_EQ((std::size_t)0, reference1.begin()->second->edgeLabelCount());
 }
 
+TEST(LabelingCollectionTest, TestLabelingCollectionWithMultipleLabelings)
+{
+    htd::LabelingCollection labelings;
+
+    labelings.setLabeling("Label2", new htd::GraphLabeling());
+    labelings.setLabeling("Label3", new htd::GraphLabeling());
+    labelings.setLabeling("Label1", new htd::GraphLabeling());
+
+    ASSERT_EQ((std::size_t)3, labelings.labelCount());
+
+    ASSERT_EQ("Label1", labelings.labelNameAtPosition(0));
+    ASSERT_EQ("Label2", labelings.labelNameAtPosition(1));
+    ASSERT_EQ("Label3", labelings.labelNameAtPosition(2));
+
+    labelings.labeling("Label1").setVertexLabel(5, new htd::Label<int>(1));
+    labelings.labeling("Label3").setVertexLabel(5, new htd::Label<int>(3));
+    labelings.labeling("Label3").setVertexLabel(100, new htd::Label<int>(4));
+
+    htd::ILabelCollection * exportedLabels = labelings.exportVertexLabelCollection(5);
+
+    ASSERT_EQ((std::size_t)2, exportedLabels->labelCount());
+    ASSERT_EQ(1, htd::accessLabel<int>(exportedLabels->label("Label1")));
+    ASSERT_EQ(3, htd::accessLabel<int>(exportedLabels->label("Label3")));
+
+    delete exportedLabels;
+
+    labelings.removeLabeling("Label2");
+
+    ASSERT_EQ((std::size_t)2, labelings.labelCount());
+    ASSERT_FALSE(labelings.isLabelName("Label2"));
+    ASSERT_EQ("Label3", labelings.labelNameAtPosition(1));
+    ASSERT_EQ(4, htd::accessLabel<int>(labelings.labeling("Label3").vertexLabel(100)));
+
+    labelings.removeVertexLabels(5);
+
+    ASSERT_FALSE(labelings.labeling("Label1").isLabeledVertex(5));
+    ASSERT_FALSE(labelings.labeling("Label3").isLabeledVertex(5));
+    ASSERT_EQ((std::size_t)1, labelings.labeling("Label3").vertexLabelCount());
+
+    htd::LabelingCollection * clone = labelings.clone();
+
+    labelings.clear();
+
+    ASSERT_EQ((std::size_t)0, labelings.labelCount());
+    ASSERT_FALSE(labelings.isLabelName("Label1"));
+
+    ASSERT_EQ((std::size_t)2, clone->labelCount());
+    ASSERT_EQ(4, htd::accessLabel<int>(clone->labeling("Label3").vertexLabel(100)));
+
+    delete clone;
+}
+
+TEST(LabelingCollectionTest, TestLabelHandles)
+{
+    htd::LabelingCollection labelings;
+
+    ASSERT_EQ(htd::LabelHandle::UNKNOWN, labelings.labelHandle("Label1"));
+    ASSERT_EQ(nullptr, labelings.findLabeling(htd::LabelHandle::UNKNOWN));
+
+    labelings.setLabeling("Label2", new htd::GraphLabeling());
+    labelings.setLabeling("Label1", new htd::GraphLabeling());
+
+    htd::label_handle_t handle1 = labelings.labelHandle("Label1");
+    htd::label_handle_t handle2 = labelings.labelHandle("Label2");
+
+    ASSERT_NE(htd::LabelHandle::UNKNOWN, handle1);
+    ASSERT_NE(htd::LabelHandle::UNKNOWN, handle2);
+    ASSERT_NE(handle1, handle2);
+
+    ASSERT_EQ(&(labelings.labeling("Label1")), labelings.findLabeling(handle1));
+    ASSERT_EQ(&(labelings.labeling("Label2")), labelings.findLabeling(handle2));
+
+    labelings.findLabeling(handle1)->setVertexLabel(3, new htd::Label<int>(7));
+
+    /* Replacing a labeling keeps the handle of its name. */
+    labelings.setLabeling("Label2", new htd::GraphLabeling());
+
+    ASSERT_EQ(handle2, labelings.labelHandle("Label2"));
+    ASSERT_EQ(&(labelings.labeling("Label2")), labelings.findLabeling(handle2));
+
+    htd::LabelingCollection * clone = labelings.clone();
+
+    labelings.removeLabeling("Label1");
+
+    ASSERT_EQ(htd::LabelHandle::UNKNOWN, labelings.labelHandle("Label1"));
+    ASSERT_EQ(nullptr, labelings.findLabeling(handle1));
+    ASSERT_NE(nullptr, labelings.findLabeling(handle2));
+
+    /* Adding a labeling with the name of a removed labeling restores the previous handle. */
+    labelings.setLabeling("Label0", new htd::GraphLabeling());
+    labelings.setLabeling("Label1", new htd::GraphLabeling());
+
+    ASSERT_EQ(handle1, labelings.labelHandle("Label1"));
+    ASSERT_EQ(&(labelings.labeling("Label1")), labelings.findLabeling(handle1));
+    ASSERT_EQ(&(labelings.labeling("Label0")), labelings.findLabeling(labelings.labelHandle("Label0")));
+
+    ASSERT_EQ(handle1, clone->labelHandle("Label1"));
+    ASSERT_EQ(handle2, clone->labelHandle("Label2"));
+    ASSERT_EQ(htd::LabelHandle::UNKNOWN, clone->labelHandle("Label0"));
+    ASSERT_EQ(7, htd::accessLabel<int>(clone->findLabeling(handle1)->vertexLabel(3)));
+
+    labelings.clear();
+
+    ASSERT_EQ(nullptr, labelings.findLabeling(handle1));
+    ASSERT_EQ(nullptr, labelings.findLabeling(handle2));
+
+    /* The default implementation of the interface uses the positions of the label names as handles. */
+    const htd::ILabelingCollection & base = *clone;
+
+    ASSERT_EQ((htd::label_handle_t)0, base.htd::ILabelingCollection::labelHandle("Label1"));
+    ASSERT_EQ((htd::label_handle_t)1, base.htd::ILabelingCollection::labelHandle("Label2"));
+    ASSERT_EQ(htd::LabelHandle::UNKNOWN, base.htd::ILabelingCollection::labelHandle("Label0"));
+    ASSERT_EQ(&(clone->labeling("Label2")), base.htd::ILabelingCollection::findLabeling(1));
+    ASSERT_EQ(nullptr, base.htd::ILabelingCollection::findLabeling(2));
+
+    delete clone;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
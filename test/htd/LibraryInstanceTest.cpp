@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <vector>
 
 class LibraryInstanceTest : public ::testing::Test
@@ -97,6 +99,185 @@ TEST(LibraryInstanceTest, CheckTermination)
     delete libraryInstance;
 }
 
+TEST(LibraryInstanceTest, CheckDeadline)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_FALSE(libraryInstance->hasDeadline());
+    ASSERT_EQ(std::chrono::steady_clock::duration::max(), libraryInstance->remainingTime());
+
+    libraryInstance->setTimeout(std::chrono::hours(1));
+
+    ASSERT_TRUE(libraryInstance->hasDeadline());
+    ASSERT_FALSE(libraryInstance->isTerminated());
+    ASSERT_GT(libraryInstance->remainingTime(), std::chrono::steady_clock::duration(std::chrono::minutes(59)));
+    ASSERT_LE(libraryInstance->remainingTime(), std::chrono::steady_clock::duration(std::chrono::hours(1)));
+
+    libraryInstance->clearDeadline();
+
+    ASSERT_FALSE(libraryInstance->hasDeadline());
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    libraryInstance->setDeadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+
+    ASSERT_TRUE(libraryInstance->hasDeadline());
+    ASSERT_TRUE(libraryInstance->isTerminated());
+    ASSERT_EQ(std::chrono::steady_clock::duration::zero(), libraryInstance->remainingTime());
+
+    libraryInstance->reset();
+
+    ASSERT_FALSE(libraryInstance->hasDeadline());
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    libraryInstance->setTimeout(std::chrono::milliseconds(20));
+
+    std::size_t polls = 0;
+
+    while (!libraryInstance->isTerminated())
+    {
+        ++polls;
+    }
+
+    ASSERT_GT(polls, (std::size_t)0);
+    ASSERT_TRUE(libraryInstance->isTerminated());
+
+    libraryInstance->reset();
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    delete libraryInstance;
+}
+
+TEST(LibraryInstanceTest, CheckMemoryArena)
+{
+    htd::MemoryArena arena(64);
+
+    ASSERT_EQ((std::size_t)0, arena.blockCount());
+    ASSERT_EQ((std::size_t)0, arena.reservedBytes());
+
+    std::vector<void *> chunks;
+
+    for (std::size_t index = 1; index <= 100; ++index)
+    {
+        void * chunk = arena.allocate(index, 8);
+
+        ASSERT_NE(nullptr, chunk);
+        ASSERT_EQ((std::uintptr_t)0, reinterpret_cast<std::uintptr_t>(chunk) % 8);
+
+        chunks.push_back(chunk);
+    }
+
+    for (std::size_t index = 1; index < chunks.size(); ++index)
+    {
+        ASSERT_NE(chunks[index - 1], chunks[index]);
+    }
+
+    ASSERT_EQ((std::size_t)100, arena.allocationCount());
+    ASSERT_EQ((std::size_t)5050, arena.allocatedBytes());
+    ASSERT_GE(arena.reservedBytes(), (std::size_t)5050);
+    ASSERT_GT(arena.blockCount(), (std::size_t)1);
+
+    void * chunk1 = arena.allocate(16, 8);
+
+    arena.deallocate(chunk1, 16);
+
+    void * chunk2 = arena.allocate(16, 8);
+
+    ASSERT_EQ(chunk1, chunk2);
+
+    std::size_t blockCount = arena.blockCount();
+    std::size_t reservedBytes = arena.reservedBytes();
+
+    arena.reset();
+
+    ASSERT_EQ((std::size_t)0, arena.allocationCount());
+    ASSERT_EQ((std::size_t)0, arena.allocatedBytes());
+    ASSERT_EQ(blockCount, arena.blockCount());
+    ASSERT_EQ(reservedBytes, arena.reservedBytes());
+
+    for (std::size_t index = 1; index <= 100; ++index)
+    {
+        arena.allocate(index, 8);
+    }
+
+    ASSERT_EQ(blockCount, arena.blockCount());
+    ASSERT_EQ(reservedBytes, arena.reservedBytes());
+
+    arena.release();
+
+    ASSERT_EQ((std::size_t)0, arena.blockCount());
+    ASSERT_EQ((std::size_t)0, arena.reservedBytes());
+
+    std::vector<htd::vertex_t, htd::ArenaAllocator<htd::vertex_t>> vertices((htd::ArenaAllocator<htd::vertex_t>(&arena)));
+
+    for (htd::vertex_t vertex = 1; vertex <= 1000; ++vertex)
+    {
+        vertices.push_back(vertex);
+    }
+
+    ASSERT_EQ((std::size_t)1000, vertices.size());
+    ASSERT_EQ((htd::vertex_t)1, vertices[0]);
+    ASSERT_EQ((htd::vertex_t)1000, vertices[999]);
+    ASSERT_GT(arena.allocationCount(), (std::size_t)0);
+}
+
+TEST(LibraryInstanceTest, CheckArenaAllocationStatistics)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_TRUE(libraryInstance->isArenaAllocationEnabled());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaCount());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaAllocationCount());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaAllocatedBytes());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaPeakReservedBytes());
+
+    htd::Graph graph(libraryInstance);
+
+    graph.addVertices(4);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+
+    htd::BucketEliminationGraphDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::IGraphDecomposition * decomposition1 = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition1);
+
+    ASSERT_EQ((std::size_t)3, decomposition1->vertexCount());
+    ASSERT_EQ((std::size_t)2, decomposition1->maximumBagSize());
+
+    ASSERT_EQ((std::size_t)1, libraryInstance->arenaCount());
+    ASSERT_GT(libraryInstance->arenaAllocationCount(), (std::size_t)0);
+    ASSERT_GT(libraryInstance->arenaAllocatedBytes(), (std::size_t)0);
+    ASSERT_GE(libraryInstance->arenaPeakReservedBytes(), libraryInstance->arenaAllocatedBytes());
+
+    libraryInstance->setArenaAllocationEnabled(false);
+
+    ASSERT_FALSE(libraryInstance->isArenaAllocationEnabled());
+
+    htd::IGraphDecomposition * decomposition2 = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition2);
+
+    ASSERT_EQ((std::size_t)3, decomposition2->vertexCount());
+    ASSERT_EQ((std::size_t)2, decomposition2->maximumBagSize());
+
+    ASSERT_EQ((std::size_t)1, libraryInstance->arenaCount());
+
+    libraryInstance->resetArenaStatistics();
+
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaCount());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaAllocationCount());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaAllocatedBytes());
+    ASSERT_EQ((std::size_t)0, libraryInstance->arenaPeakReservedBytes());
+
+    delete decomposition1;
+    delete decomposition2;
+    delete libraryInstance;
+}
+
 TEST(LibraryInstanceTest, CheckMultiHypergraphFactory1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
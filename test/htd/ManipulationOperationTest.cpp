@@ -5605,6 +5605,59 @@ TEST(ManipulationOperationTest, CheckPathDecompositionWeakNormalizationOperation
     delete libraryInstance;
 }
 
+TEST(ManipulationOperationTest, CheckWidthReductionOperationOnCopiedDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(4);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    decomposition.insertRoot(std::vector<htd::vertex_t> { 1, 2, 3, 4 }, graph.hyperedgesAtPositions(std::vector<htd::index_t> { 0, 1, 2 }));
+
+    /* The operation must not be affected by another decomposition which was copied from the modified one. */
+    htd::TreeDecomposition copy(decomposition);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, decomposition));
+
+    htd::WidthReductionOperation operation(libraryInstance);
+
+    operation.apply(graph, decomposition);
+
+    ASSERT_TRUE(verifier.verify(graph, decomposition));
+
+    ASSERT_LT(decomposition.maximumBagSize(), (std::size_t)4);
+
+    for (htd::vertex_t vertex : decomposition.vertexVector())
+    {
+        const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
+
+        std::vector<htd::vertex_t> neighbors;
+
+        decomposition.copyNeighborsTo(vertex, neighbors);
+
+        for (htd::vertex_t neighbor : neighbors)
+        {
+            const std::vector<htd::vertex_t> & neighborBagContent = decomposition.bagContent(neighbor);
+
+            ASSERT_FALSE(std::includes(neighborBagContent.begin(), neighborBagContent.end(), bagContent.begin(), bagContent.end()));
+        }
+    }
+
+    ASSERT_EQ((std::size_t)1, copy.vertexCount());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), copy.bagContent(copy.root()));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
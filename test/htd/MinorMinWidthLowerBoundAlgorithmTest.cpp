@@ -0,0 +1,209 @@
+/*
+ * File:   MinorMinWidthLowerBoundAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+class MinorMinWidthLowerBoundAlgorithmTest : public ::testing::Test
+{
+    public:
+        MinorMinWidthLowerBoundAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MinorMinWidthLowerBoundAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(MinorMinWidthLowerBoundAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::MinorMinWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    ASSERT_EQ((std::size_t)0, algorithm.computeLowerBound(graph));
+
+    delete libraryInstance;
+}
+
+TEST(MinorMinWidthLowerBoundAlgorithmTest, CheckTree)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(3, 6);
+    graph.addEdge(3, 7);
+
+    htd::MinorMinWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    ASSERT_EQ((std::size_t)1, algorithm.computeLowerBound(graph));
+
+    delete libraryInstance;
+}
+
+TEST(MinorMinWidthLowerBoundAlgorithmTest, CheckCycle)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    for (htd::vertex_t vertex = 1; vertex <= 8; ++vertex)
+    {
+        graph.addEdge(vertex, vertex % 8 + 1);
+    }
+
+    htd::MinorMinWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    ASSERT_EQ((std::size_t)2, algorithm.computeLowerBound(graph));
+
+    delete libraryInstance;
+}
+
+TEST(MinorMinWidthLowerBoundAlgorithmTest, CheckClique)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 6; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 6; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::MinorMinWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    ASSERT_EQ((std::size_t)5, algorithm.computeLowerBound(graph));
+
+    delete libraryInstance;
+}
+
+TEST(MinorMinWidthLowerBoundAlgorithmTest, CheckGrid)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t size = 6;
+
+    htd::MultiHypergraph graph(libraryInstance, size * size);
+
+    for (htd::index_t row = 0; row < size; ++row)
+    {
+        for (htd::index_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = row * size + column + 1;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+
+    htd::MinorMinWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    std::size_t lowerBound = algorithm.computeLowerBound(graph);
+
+    ASSERT_GE(lowerBound, (std::size_t)2);
+    ASSERT_LE(lowerBound, size);
+
+    htd::ITreeWidthLowerBoundAlgorithm * clone = algorithm.clone();
+
+    ASSERT_EQ(lowerBound, clone->computeLowerBound(graph));
+
+    delete clone;
+
+    delete libraryInstance;
+}
+
+TEST(MinorMinWidthLowerBoundAlgorithmTest, CheckEarlyTerminationOfWidthMinimization)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 5; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 5; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setIterationCount(0);
+
+    std::size_t decompositionCount = 0;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeImprovedDecomposition(graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)
+        {
+            ++decompositionCount;
+        }, (std::size_t)-1);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ((std::size_t)5, decomposition->maximumBagSize());
+
+    ASSERT_EQ((std::size_t)1, decompositionCount);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <utility>
 #include <vector>
 
 class MultiGraphTest : public ::testing::Test
@@ -584,6 +585,53 @@ TEST(MultiGraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(MultiGraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiGraph graph(libraryInstance, 4);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges = { { 1, 2 }, { 2, 1 }, { 3, 3 }, { 2, 4 } };
+
+    ASSERT_EQ((htd::id_t)1, graph.addEdges(edges));
+
+    ASSERT_EQ((std::size_t)4, graph.edgeCount());
+    ASSERT_EQ((htd::id_t)5, graph.nextEdgeId());
+
+    ASSERT_EQ((std::size_t)1, graph.neighborCount((htd::vertex_t)1));
+    ASSERT_EQ((std::size_t)2, graph.neighborCount((htd::vertex_t)2));
+    ASSERT_EQ((std::size_t)1, graph.neighborCount((htd::vertex_t)3));
+    ASSERT_EQ((std::size_t)1, graph.neighborCount((htd::vertex_t)4));
+
+    ASSERT_EQ((htd::vertex_t)1, graph.neighborAtPosition((htd::vertex_t)2, (htd::index_t)0));
+    ASSERT_EQ((htd::vertex_t)4, graph.neighborAtPosition((htd::vertex_t)2, (htd::index_t)1));
+
+    ASSERT_TRUE(graph.isNeighbor((htd::vertex_t)3, (htd::vertex_t)3));
+    ASSERT_FALSE(graph.isNeighbor((htd::vertex_t)1, (htd::vertex_t)1));
+
+    ASSERT_TRUE(graph.isEdge((htd::vertex_t)1, (htd::vertex_t)2));
+    ASSERT_TRUE(graph.isEdge((htd::vertex_t)2, (htd::vertex_t)1));
+
+    ASSERT_EQ((htd::id_t)5, graph.addEdges(std::vector<std::pair<htd::vertex_t, htd::vertex_t>>()));
+
+    /* The default implementation of the interface adds the edges one after another. */
+    htd::MultiGraph graph2(libraryInstance, 4);
+
+    htd::IMutableMultiGraph & base = graph2;
+
+    ASSERT_EQ((htd::id_t)1, base.htd::IMutableMultiGraph::addEdges(edges));
+
+    ASSERT_EQ(graph.edgeCount(), graph2.edgeCount());
+    ASSERT_EQ(graph.nextEdgeId(), graph2.nextEdgeId());
+
+    for (htd::vertex_t vertex = 1; vertex <= 4; ++vertex)
+    {
+        ASSERT_EQ(graph.neighborVector(vertex), graph2.neighborVector(vertex));
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
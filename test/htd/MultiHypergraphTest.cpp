@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <utility>
 #include <vector>
 
 class MultiHypergraphTest : public ::testing::Test
@@ -804,6 +805,365 @@ TEST(MultiHypergraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(MultiHypergraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::vector<htd::vertex_t>> hyperedges = { { 1, 2 }, { 3 }, { 2, 1 }, { 4, 4 }, { 1, 3, 5 }, { 5, 2, 5, 6 }, { 6, 6, 6 }, { 2, 3 } };
+
+    htd::MultiHypergraph graph1(libraryInstance, 7);
+    htd::MultiHypergraph graph2(libraryInstance, 7);
+
+    graph1.addEdge(std::vector<htd::vertex_t> { 7, 1, 2 });
+    graph2.addEdge(std::vector<htd::vertex_t> { 7, 1, 2 });
+
+    std::vector<htd::vertex_t> elements;
+
+    std::vector<htd::index_t> offsets(1, 0);
+
+    for (const std::vector<htd::vertex_t> & hyperedge : hyperedges)
+    {
+        graph1.addEdge(hyperedge);
+
+        elements.insert(elements.end(), hyperedge.begin(), hyperedge.end());
+
+        offsets.push_back(elements.size());
+    }
+
+    ASSERT_EQ((htd::id_t)2, graph2.addEdges(elements, offsets));
+
+    ASSERT_EQ((htd::id_t)10, graph2.addEdges(std::vector<htd::vertex_t>(), std::vector<htd::index_t>()));
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges = { { 3, 4 }, { 4, 3 }, { 2, 2 } };
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge.first, edge.second);
+    }
+
+    ASSERT_EQ((htd::id_t)10, graph2.addEdges(edges));
+
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+    ASSERT_EQ(graph1.nextEdgeId(), graph2.nextEdgeId());
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index).id(), graph2.hyperedgeAtPosition(index).id());
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index).elements(), graph2.hyperedgeAtPosition(index).elements());
+    }
+
+    for (htd::vertex_t vertex = 1; vertex <= 7; ++vertex)
+    {
+        std::vector<htd::vertex_t> neighbors1;
+        std::vector<htd::vertex_t> neighbors2;
+
+        graph1.copyNeighborsTo(vertex, neighbors1);
+        graph2.copyNeighborsTo(vertex, neighbors2);
+
+        ASSERT_EQ(neighbors1, neighbors2);
+
+        ASSERT_EQ(graph1.edgeCount(vertex), graph2.edgeCount(vertex));
+        ASSERT_EQ(graph1.isIsolatedVertex(vertex), graph2.isIsolatedVertex(vertex));
+    }
+
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)2, (htd::vertex_t)2));
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)5, (htd::vertex_t)5));
+    ASSERT_FALSE(graph2.isNeighbor((htd::vertex_t)3, (htd::vertex_t)3));
+
+    htd::MultiHypergraph graph3(libraryInstance);
+
+    graph3 = static_cast<const htd::IMultiHypergraph &>(graph2);
+
+    for (htd::vertex_t vertex = 1; vertex <= 7; ++vertex)
+    {
+        std::vector<htd::vertex_t> neighbors2;
+        std::vector<htd::vertex_t> neighbors3;
+
+        graph2.copyNeighborsTo(vertex, neighbors2);
+        graph3.copyNeighborsTo(vertex, neighbors3);
+
+        ASSERT_EQ(neighbors2, neighbors3);
+    }
+
+    ASSERT_EQ(graph2.nextEdgeId(), graph3.nextEdgeId());
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckDefaultBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<htd::vertex_t> elements = { 1, 2, 3, 2, 1, 4, 4, 1, 3, 5 };
+
+    std::vector<htd::index_t> offsets = { 0, 2, 3, 5, 7, 10 };
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges = { { 3, 4 }, { 4, 3 }, { 2, 2 } };
+
+    htd::MultiHypergraph graph1(libraryInstance, 5);
+    htd::MultiHypergraph graph2(libraryInstance, 5);
+
+    ASSERT_EQ((htd::id_t)1, graph1.addEdges(elements, offsets));
+    ASSERT_EQ((htd::id_t)6, graph1.addEdges(edges));
+
+    /* Call the default implementations provided by the interface for implementations without bulk insertion. */
+    htd::IMutableMultiHypergraph & base = graph2;
+
+    ASSERT_EQ((htd::id_t)1, base.htd::IMutableMultiHypergraph::addEdges(elements, offsets));
+    ASSERT_EQ((htd::id_t)6, base.htd::IMutableMultiHypergraph::addEdges(edges));
+    ASSERT_EQ((htd::id_t)9, base.htd::IMutableMultiHypergraph::addEdges(std::vector<std::pair<htd::vertex_t, htd::vertex_t>>()));
+
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+    ASSERT_EQ(graph1.nextEdgeId(), graph2.nextEdgeId());
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index).id(), graph2.hyperedgeAtPosition(index).id());
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index).elements(), graph2.hyperedgeAtPosition(index).elements());
+    }
+
+    for (htd::vertex_t vertex = 1; vertex <= 5; ++vertex)
+    {
+        ASSERT_EQ(graph1.neighborVector(vertex), graph2.neighborVector(vertex));
+    }
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckEdgeLookups)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 1);
+
+    ASSERT_TRUE(graph.isEdge((htd::id_t)3));
+    ASSERT_FALSE(graph.isEdge((htd::id_t)5));
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 2, 3, 4 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 4, 3, 2 }));
+
+    ASSERT_EQ((std::size_t)2, graph.associatedEdgeIds(1, 2).size());
+    ASSERT_EQ((htd::id_t)1, graph.associatedEdgeIds(1, 2)[0]);
+    ASSERT_EQ((htd::id_t)3, graph.associatedEdgeIds(1, 2)[1]);
+
+    ASSERT_EQ((std::size_t)4, graph.edgeCount(2));
+    ASSERT_EQ((std::size_t)0, graph.edgeCount(5));
+    ASSERT_EQ((htd::id_t)2, graph.hyperedgeAtPosition(1, 2).id());
+    ASSERT_THROW(graph.hyperedgeAtPosition(4, 2), std::out_of_range);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 5, 4, 3 });
+
+    graph.removeEdge(1);
+
+    ASSERT_EQ((std::size_t)1, graph.associatedEdgeIds(1, 2).size());
+    ASSERT_EQ((htd::id_t)3, graph.associatedEdgeIds(1, 2)[0]);
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 5, 4, 3 }));
+    ASSERT_EQ((std::size_t)3, graph.edgeCount(2));
+    ASSERT_EQ((htd::id_t)5, graph.hyperedges(5)[0].id());
+    ASSERT_FALSE(graph.isIsolatedVertex(5));
+
+    graph.removeVertex(3);
+
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 2, 4 }));
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 5, 4 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 5, 4, 3 }));
+
+    htd::vertex_t vertex = graph.addVertex();
+
+    ASSERT_TRUE(graph.isIsolatedVertex(vertex));
+
+    graph.addEdge(vertex, 1);
+
+    ASSERT_FALSE(graph.isIsolatedVertex(vertex));
+    ASSERT_EQ((std::size_t)1, graph.edgeCount(vertex));
+    ASSERT_EQ((std::size_t)1, graph.associatedEdgeIds(std::vector<htd::vertex_t> { vertex, 1 }).size());
+
+    htd::MultiHypergraph copy(libraryInstance);
+
+    copy = graph;
+
+    graph.removeEdge(6);
+
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { vertex, 1 }));
+    ASSERT_TRUE(copy.isEdge(std::vector<htd::vertex_t> { vertex, 1 }));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckHyperedgeCollectionConsistency)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 1, 2, 3 });
+    graph.addEdge(std::vector<htd::vertex_t> { 4, 2, 2, 5 });
+    graph.addEdge(2, 1);
+    graph.addEdge(std::vector<htd::vertex_t> { 3 });
+
+    const htd::Hyperedge & hyperedge = graph.hyperedge(2);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4, 2, 2, 5 }), hyperedge.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 4, 5 }), hyperedge.sortedElements());
+
+    graph.addEdge(std::vector<htd::vertex_t> { 6, 5, 4, 3 });
+
+    graph.removeVertex(2);
+
+    graph.removeEdge(4);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 3, 4, 5, 6 });
+
+    ASSERT_EQ((std::size_t)5, graph.edgeCount());
+
+    htd::MultiHypergraph copy(graph);
+
+    ASSERT_EQ(graph.edgeCount(), copy.edgeCount());
+
+    for (htd::index_t index = 0; index < graph.edgeCount(); ++index)
+    {
+        const htd::Hyperedge & hyperedge1 = graph.hyperedgeAtPosition(index);
+        const htd::Hyperedge & hyperedge2 = copy.hyperedgeAtPosition(index);
+
+        ASSERT_EQ(hyperedge1.id(), hyperedge2.id());
+        ASSERT_EQ(hyperedge1.elements(), hyperedge2.elements());
+        ASSERT_EQ(hyperedge1.sortedElements(), hyperedge2.sortedElements());
+    }
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3 }), graph.hyperedge(1).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4, 5 }), graph.hyperedge(2).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1 }), graph.hyperedge(3).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 6, 5, 4, 3 }), graph.hyperedge(5).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 4, 5, 6 }), graph.hyperedge(5).sortedElements());
+
+    ASSERT_TRUE(graph.isNeighbor(3, 6));
+    ASSERT_FALSE(graph.isNeighbor(1, 4));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckCopyHyperedgeElementsTo)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(2, 1);
+    graph.addEdge(3, 3);
+    graph.addEdge(std::vector<htd::vertex_t> { 4 });
+    graph.addEdge(std::vector<htd::vertex_t> { 5, 2, 5, 1 });
+    graph.addEdge(1, 5);
+
+    graph.removeEdge(5);
+
+    std::vector<htd::vertex_t> elements { 42 };
+
+    graph.copyHyperedgeElementsTo(0, elements);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 42, 1, 2 }), elements);
+
+    for (htd::index_t index = 0; index < graph.edgeCount(); ++index)
+    {
+        elements.clear();
+
+        graph.copyHyperedgeElementsTo(index, elements);
+
+        ASSERT_EQ(graph.hyperedgeAtPosition(index).sortedElements(), elements);
+
+        std::vector<htd::vertex_t> defaultElements { 42 };
+
+        graph.htd::IMultiHypergraph::copyHyperedgeElementsTo(index, defaultElements);
+
+        ASSERT_EQ((htd::vertex_t)42, defaultElements[0]);
+        ASSERT_EQ(elements, std::vector<htd::vertex_t>(defaultElements.begin() + 1, defaultElements.end()));
+    }
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckNeighborVector)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(2, 1);
+    graph.addEdge(3, 3);
+    graph.addEdge(std::vector<htd::vertex_t> { 5, 2, 4 });
+
+    for (htd::vertex_t vertex : graph.vertexVector())
+    {
+        std::vector<htd::vertex_t> neighbors;
+
+        graph.copyNeighborsTo(vertex, neighbors);
+
+        ASSERT_EQ(neighbors, graph.neighborVector(vertex));
+    }
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 4, 5 }), graph.neighborVector(2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3 }), graph.neighborVector(3));
+
+    graph.removeVertex(4);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 5 }), graph.neighborVector(2));
+
+    htd::Graph simpleGraph(libraryInstance);
+
+    simpleGraph.addVertices(3);
+
+    simpleGraph.addEdge(1, 3);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3 }), simpleGraph.neighborVector(1));
+    ASSERT_EQ(std::vector<htd::vertex_t>(), simpleGraph.neighborVector(2));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckDefaultVectorAccessors)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 5);
+    htd::MultiHypergraph graph2(libraryInstance, 3);
+
+    graph1.addEdge(2, 1);
+    graph1.addEdge(std::vector<htd::vertex_t> { 5, 2, 4 });
+
+    graph2.addEdge(1, 3);
+
+    /* The default implementations provided by the interface keep separate vectors per graph and per vertex. */
+    const std::vector<htd::vertex_t> & vertices1 = graph1.htd::IGraphStructure::vertexVector();
+    const std::vector<htd::vertex_t> & vertices2 = graph2.htd::IGraphStructure::vertexVector();
+
+    const std::vector<htd::vertex_t> & neighbors1 = graph1.htd::IGraphStructure::neighborVector(2);
+    const std::vector<htd::vertex_t> & neighbors2 = graph1.htd::IGraphStructure::neighborVector(5);
+    const std::vector<htd::vertex_t> & neighbors3 = graph2.htd::IGraphStructure::neighborVector(1);
+
+    ASSERT_EQ(graph1.vertexVector(), vertices1);
+    ASSERT_EQ(graph2.vertexVector(), vertices2);
+
+    ASSERT_EQ(graph1.neighborVector(2), neighbors1);
+    ASSERT_EQ(graph1.neighborVector(5), neighbors2);
+    ASSERT_EQ(graph2.neighborVector(1), neighbors3);
+
+    ASSERT_EQ(&neighbors1, &(graph1.htd::IGraphStructure::neighborVector(2)));
+
+    graph1.removeVertex(4);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 5 }), graph1.htd::IGraphStructure::neighborVector(2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 5 }), graph1.htd::IGraphStructure::vertexVector());
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -548,6 +548,46 @@ TEST(PathTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(PathTest, CheckNeighborAndChildVectors)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Path path(libraryInstance);
+
+    htd::vertex_t vertex1 = path.insertRoot();
+    htd::vertex_t vertex2 = path.addChild(vertex1);
+    htd::vertex_t vertex3 = path.addChild(vertex2);
+
+    for (htd::vertex_t vertex : path.vertexVector())
+    {
+        std::vector<htd::vertex_t> neighbors;
+        std::vector<htd::vertex_t> children;
+
+        path.copyNeighborsTo(vertex, neighbors);
+        path.copyChildrenTo(vertex, children);
+
+        ASSERT_EQ(neighbors, path.neighborVector(vertex));
+        ASSERT_EQ(children, path.childVector(vertex));
+    }
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex1, vertex3 }), path.neighborVector(vertex2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex3 }), path.childVector(vertex2));
+    ASSERT_EQ(std::vector<htd::vertex_t>(), path.childVector(vertex3));
+
+    path.removeVertex(vertex2);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex3 }), path.neighborVector(vertex1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex3 }), path.childVector(vertex1));
+
+    htd::vertex_t vertex4 = path.addParent(vertex3);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex1, vertex3 }), path.neighborVector(vertex4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex4 }), path.childVector(vertex1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ vertex4 }), path.neighborVector(vertex3));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -80,6 +80,34 @@ class FitnessFunction : public htd::ITreeDecompositionFitnessFunction
         }
 };
 
+class WidthFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        WidthFitnessFunction(void)
+        {
+
+        }
+
+        ~WidthFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1,
+                                              -(double)(decomposition.maximumBagSize()));
+        }
+
+        WidthFitnessFunction * clone(void) const
+        {
+            return new WidthFitnessFunction();
+        }
+};
+
 htd::IMultiHypergraph * createInputGraph(const htd::LibraryInstance * const libraryInstance)
 {
     htd::MultiHypergraph * graph = new htd::MultiHypergraph(libraryInstance, 50);
@@ -991,6 +1019,126 @@ TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraph)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)25, algorithm.iterationCount());
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalHeight = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentHeight = currentDecomposition.height();
+
+        ASSERT_EQ(currentHeight, (std::size_t)(-fitness.at(0)));
+
+        if (currentHeight < minimalHeight)
+        {
+            minimalHeight = currentHeight;
+        }
+
+        ++iterationCount;
+    });
+
+    ASSERT_EQ((std::size_t)25, iterationCount);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_LE(decomposition->minimumBagSize(), decomposition->maximumBagSize());
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalHeight, decomposition->height());
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    delete clonedAlgorithm;
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckWidthPruningResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new WidthFitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    ASSERT_FALSE(algorithm.isWidthPruningEnabled());
+
+    algorithm.setWidthPruningEnabled(true);
+
+    ASSERT_TRUE(algorithm.isWidthPruningEnabled());
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalMaxBagSize = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentMaxBagSize = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentMaxBagSize, (std::size_t)(-fitness.at(0)));
+
+        ASSERT_LE(currentMaxBagSize, minimalMaxBagSize);
+
+        minimalMaxBagSize = currentMaxBagSize;
+
+        ++iterationCount;
+    });
+
+    ASSERT_GE(iterationCount, (std::size_t)1);
+    ASSERT_LE(iterationCount, (std::size_t)25);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalMaxBagSize, decomposition->maximumBagSize());
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_TRUE(clonedAlgorithm->isWidthPruningEnabled());
+
+    delete clonedAlgorithm;
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1057,6 +1057,101 @@ TEST(TreeDecompositionTest, CheckInducedHyperedges)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionTest, CheckIdenticalBagModifications)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition td(libraryInstance);
+
+    htd::vertex_t node1 = td.insertRoot(std::vector<htd::vertex_t> { 1, 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t node2 = td.addChild(node1, td.bagContent(node1), td.inducedHyperedges(node1));
+    htd::vertex_t node3 = td.addParent(node2, std::vector<htd::vertex_t> { 1, 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    ASSERT_EQ(td.bagContent(node1), td.bagContent(node2));
+    ASSERT_EQ(td.bagContent(node1), td.bagContent(node3));
+
+    td.mutableBagContent(node2).push_back(4);
+
+    ASSERT_EQ((std::size_t)3, td.bagSize(node1));
+    ASSERT_EQ((std::size_t)4, td.bagSize(node2));
+    ASSERT_EQ((std::size_t)3, td.bagSize(node3));
+
+    htd::TreeDecomposition copy(td);
+
+    copy.mutableBagContent(node1).clear();
+
+    ASSERT_EQ((std::size_t)0, copy.bagSize(node1));
+    ASSERT_EQ((std::size_t)3, copy.bagSize(node3));
+    ASSERT_EQ((std::size_t)3, td.bagSize(node1));
+
+    td.removeVertex(node3);
+
+    ASSERT_EQ((std::size_t)3, copy.bagSize(node3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), copy.bagContent(node2));
+
+    /* Modifications via a reference obtained from mutableBagContent() must neither affect copies nor vertices added later on. */
+    std::vector<htd::vertex_t> & mutableBag1 = td.mutableBagContent(node1);
+
+    htd::TreeDecomposition copy2(td);
+
+    td.mutableBagContent(node2).push_back(5);
+
+    htd::vertex_t node4 = td.addChild(node1, td.bagContent(node1), td.inducedHyperedges(node1));
+
+    mutableBag1.push_back(6);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 6 }), td.bagContent(node1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5 }), td.bagContent(node2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), td.bagContent(node4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), copy2.bagContent(node1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), copy2.bagContent(node2));
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionTest, CheckBagSharing)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition td(libraryInstance);
+
+    htd::vertex_t node1 = td.insertRoot(std::vector<htd::vertex_t> { 1, 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t node2 = td.addChild(node1, std::vector<htd::vertex_t> { 1, 2, 3 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node3 = td.addChild(node1, std::vector<htd::vertex_t> { 1, 4 }, htd::FilteredHyperedgeCollection());
+
+    ASSERT_EQ(&(td.bagContent(node1)), &(td.bagContent(node2)));
+    ASSERT_NE(&(td.bagContent(node1)), &(td.bagContent(node3)));
+
+    htd::TreeDecomposition copy(td);
+
+    ASSERT_EQ(&(td.bagContent(node1)), &(copy.bagContent(node1)));
+    ASSERT_EQ(&(td.bagContent(node3)), &(copy.bagContent(node3)));
+
+    /* Modifying a shared bag must not invalidate the references to the bags of other vertices. */
+    const std::vector<htd::vertex_t> & bag1 = td.bagContent(node1);
+
+    td.mutableBagContent(node2).push_back(5);
+
+    ASSERT_EQ(&bag1, &(td.bagContent(node1)));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), bag1);
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 5 }), td.bagContent(node2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), copy.bagContent(node2));
+
+    /* A bag handed out via mutableBagContent() keeps its address. */
+    std::vector<htd::vertex_t> & mutableBag2 = td.mutableBagContent(node2);
+
+    ASSERT_EQ(&mutableBag2, &(td.bagContent(node2)));
+
+    htd::TreeDecomposition copy2(td);
+
+    ASSERT_NE(&(td.bagContent(node2)), &(copy2.bagContent(node2)));
+    ASSERT_EQ(&(td.bagContent(node3)), &(copy2.bagContent(node3)));
+
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionTest, TestVertexLabelModifications)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -692,6 +692,139 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckRemovedVerticesAreNotReused)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+
+    tree.removeVertex(node2);
+
+    ASSERT_EQ((std::size_t)3, tree.vertexCount());
+
+    ASSERT_FALSE(tree.isVertex(node2));
+    ASSERT_TRUE(tree.isVertex(node4));
+    ASSERT_TRUE(tree.isParent(node4, node1));
+
+    htd::vertex_t node5 = tree.addChild(node4);
+    htd::vertex_t node6 = tree.addParent(node3);
+
+    ASSERT_NE(node2, node5);
+    ASSERT_NE(node2, node6);
+
+    ASSERT_FALSE(tree.isVertex(node2));
+    ASSERT_TRUE(tree.isParent(node5, node4));
+    ASSERT_TRUE(tree.isParent(node6, node1));
+    ASSERT_TRUE(tree.isParent(node3, node6));
+
+    ASSERT_EQ((std::size_t)2, tree.leafCount());
+
+    htd::Tree copy(tree);
+
+    ASSERT_EQ((std::size_t)5, copy.vertexCount());
+    ASSERT_FALSE(copy.isVertex(node2));
+    ASSERT_TRUE(copy.isParent(node3, node6));
+
+    const htd::ConstCollection<htd::vertex_t> & leaves = copy.leaves();
+
+    ASSERT_EQ((std::size_t)2, leaves.size());
+    ASSERT_EQ(node3, leaves[0]);
+    ASSERT_EQ(node5, leaves[1]);
+
+    delete libraryInstance;
+}
+
+TEST(TreeTest, CheckNeighborAndChildVectors)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+
+    for (htd::vertex_t vertex : tree.vertexVector())
+    {
+        std::vector<htd::vertex_t> neighbors;
+        std::vector<htd::vertex_t> children;
+
+        tree.copyNeighborsTo(vertex, neighbors);
+        tree.copyChildrenTo(vertex, children);
+
+        ASSERT_EQ(neighbors, tree.neighborVector(vertex));
+        ASSERT_EQ(children, tree.childVector(vertex));
+    }
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node1, node4 }), tree.neighborVector(node2));
+
+    htd::vertex_t node5 = tree.addParent(node2);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node4, node5 }), tree.neighborVector(node2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node3, node5 }), tree.neighborVector(node1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node3, node5 }), tree.childVector(node1));
+
+    tree.removeVertex(node5);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node1, node4 }), tree.neighborVector(node2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node2, node3 }), tree.childVector(node1));
+
+    tree.makeRoot(node4);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node2 }), tree.neighborVector(node4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node2 }), tree.childVector(node4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node3 }), tree.childVector(node1));
+
+    htd::Tree copy(tree);
+
+    tree.removeSubtree(node2);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>(), tree.neighborVector(node4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node2 }), copy.neighborVector(node4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node1, node4 }), copy.neighborVector(node2));
+
+    delete libraryInstance;
+}
+
+TEST(TreeTest, CheckChildVectorSurvivesGrowth)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+    htd::vertex_t child = tree.addChild(root);
+
+    const std::vector<htd::vertex_t> & rootChildren = tree.childVector(root);
+    const std::vector<htd::vertex_t> & leafChildren = tree.childVector(child);
+
+    for (std::size_t index = 0; index < 1000; ++index)
+    {
+        tree.addChild(child);
+    }
+
+    ASSERT_EQ(&rootChildren, &(tree.childVector(root)));
+    ASSERT_EQ(&leafChildren, &(tree.childVector(child)));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ child }), rootChildren);
+    ASSERT_EQ((std::size_t)1000, leafChildren.size());
+
+    const std::vector<htd::vertex_t> & defaultRootChildren = tree.htd::ITree::childVector(root);
+
+    ASSERT_EQ(rootChildren, defaultRootChildren);
+    ASSERT_EQ(leafChildren, tree.htd::ITree::childVector(child));
+    ASSERT_EQ(tree.neighborVector(root), tree.htd::IGraphStructure::neighborVector(root));
+    ASSERT_EQ(rootChildren, defaultRootChildren);
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
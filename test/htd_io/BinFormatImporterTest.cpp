@@ -0,0 +1,235 @@
+/*
+ * File:   BinFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class BinFormatImporterTest : public ::testing::Test
+{
+    public:
+        BinFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~BinFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+template <typename T>
+void append(std::string & data, T value)
+{
+    data.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+std::string header(std::uint32_t flags, std::uint64_t vertexCount, std::uint64_t edgeCount, std::uint64_t elementCount)
+{
+    std::string ret("HTDG");
+
+    append<std::uint32_t>(ret, htd_io::BinFormat::VERSION);
+    append<std::uint32_t>(ret, htd_io::BinFormat::BYTE_ORDER_MARK);
+    append<std::uint32_t>(ret, flags);
+    append<std::uint64_t>(ret, vertexCount);
+    append<std::uint64_t>(ret, edgeCount);
+    append<std::uint64_t>(ret, elementCount);
+
+    return ret;
+}
+
+TEST(BinFormatImporterTest, CheckRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+    graph.addEdge(std::vector<htd::vertex_t> { 2, 4, 5 });
+    graph.addEdge(4, 4);
+
+    std::ostringstream outputStream;
+
+    htd_io::BinFormatExporter exporter;
+
+    exporter.write(graph, outputStream);
+
+    std::string data = outputStream.str();
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    ASSERT_FALSE(importer.containsVertexNames(data.data(), data.size()));
+
+    htd::IMultiHypergraph * importedGraph = importer.import(data.data(), data.size());
+
+    ASSERT_NE(nullptr, importedGraph);
+
+    ASSERT_EQ(graph.vertexCount(), importedGraph->vertexCount());
+    ASSERT_EQ(graph.edgeCount(), importedGraph->edgeCount());
+
+    for (htd::index_t index = 0; index < graph.edgeCount(); ++index)
+    {
+        EXPECT_EQ(graph.hyperedgeAtPosition(index).elements(), importedGraph->hyperedgeAtPosition(index).elements());
+    }
+
+    delete importedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckRoundTripWithVertexNames)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> graph(libraryInstance);
+
+    graph.addVertex("a");
+    graph.addVertex("bb");
+    graph.addVertex("");
+    graph.addVertex("d d");
+
+    graph.addEdge("a", "bb");
+    graph.addEdge("bb", "");
+    graph.addEdge(std::vector<std::string> { "a", "", "d d" });
+
+    std::ostringstream outputStream;
+
+    htd_io::BinFormatExporter exporter;
+
+    exporter.write(graph, outputStream);
+
+    std::string data = outputStream.str();
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    ASSERT_TRUE(importer.containsVertexNames(data.data(), data.size()));
+
+    htd::NamedMultiHypergraph<std::string, std::string> * importedGraph = importer.importNamed(data.data(), data.size());
+
+    ASSERT_NE(nullptr, importedGraph);
+
+    ASSERT_EQ(graph.vertexCount(), importedGraph->vertexCount());
+    ASSERT_EQ(graph.edgeCount(), importedGraph->edgeCount());
+
+    for (htd::vertex_t vertex = 1; vertex <= graph.vertexCount(); ++vertex)
+    {
+        EXPECT_EQ(graph.vertexName(vertex), importedGraph->vertexName(vertex));
+    }
+
+    for (htd::index_t index = 0; index < graph.edgeCount(); ++index)
+    {
+        EXPECT_EQ(graph.internalGraph().hyperedgeAtPosition(index).elements(), importedGraph->internalGraph().hyperedgeAtPosition(index).elements());
+    }
+
+    delete importedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckTruncatedInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(3);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+
+    std::ostringstream outputStream;
+
+    htd_io::BinFormatExporter exporter;
+
+    exporter.write(graph, outputStream);
+
+    std::string data = outputStream.str();
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    for (std::size_t size = 0; size < data.size(); ++size)
+    {
+        EXPECT_EQ(nullptr, importer.import(data.data(), size));
+    }
+
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckMalformedNameOffsets)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string data = header(htd_io::BinFormat::VERTEX_NAMES, 2, 0, 0);
+
+    append<std::uint64_t>(data, 0);
+
+    /* The last offset matches the size of the names section, but the offsets in between are not monotonic. */
+    append<std::uint64_t>(data, 0);
+    append<std::uint64_t>(data, static_cast<std::uint64_t>(1) << 28);
+    append<std::uint64_t>(data, 2);
+
+    data.append("ab");
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    EXPECT_EQ(nullptr, importer.importNamed(data.data(), data.size()));
+
+    std::memset(&data[data.size() - 2 - 2 * sizeof(std::uint64_t)], 0, sizeof(std::uint64_t));
+    data[data.size() - 2 - 2 * sizeof(std::uint64_t)] = 1;
+
+    htd::NamedMultiHypergraph<std::string, std::string> * importedGraph = importer.importNamed(data.data(), data.size());
+
+    ASSERT_NE(nullptr, importedGraph);
+
+    ASSERT_EQ((std::size_t)2, importedGraph->vertexCount());
+
+    EXPECT_EQ("a", importedGraph->vertexName(1));
+    EXPECT_EQ("b", importedGraph->vertexName(2));
+
+    delete importedGraph;
+
+    delete libraryInstance;
+}
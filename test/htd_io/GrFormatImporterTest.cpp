@@ -0,0 +1,116 @@
+/*
+ * File:   GrFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <string>
+#include <vector>
+
+class GrFormatImporterTest : public ::testing::Test
+{
+    public:
+        GrFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~GrFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(GrFormatImporterTest, CheckImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string data("c example\np tw 4 3\n1 2\n2 3\nc comment\n3 4\n");
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    htd::IMultiGraph * graph = importer.import(data.data(), data.size());
+
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ((std::size_t)4, graph->vertexCount());
+    EXPECT_EQ((std::size_t)3, graph->edgeCount());
+
+    EXPECT_TRUE(graph->isEdge(1, 2));
+    EXPECT_TRUE(graph->isEdge(2, 3));
+    EXPECT_TRUE(graph->isEdge(3, 4));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(GrFormatImporterTest, CheckMalformedInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::string data("p tw 5 999999999999999999\n1 2\n");
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    data = "p tw 2 2\n1 2\n";
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    data = "p tw 2 1\n1 3\n";
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    data = "p td 2 1\n1 2\n";
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    data = "p tw 999999999999999999 0\n";
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    std::size_t edgeCount = 0;
+
+    EXPECT_FALSE(importer.importNeighborhood(data.data(), data.size(), neighborhood, edgeCount));
+
+    EXPECT_TRUE(neighborhood.empty());
+
+    delete libraryInstance;
+}
@@ -0,0 +1,219 @@
+/*
+ * File:   HgrFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <string>
+#include <vector>
+
+class HgrFormatImporterTest : public ::testing::Test
+{
+    public:
+        HgrFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~HgrFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/* The input is large enough to be split into four chunks of more than 1 MiB each. */
+const std::size_t LARGE_EDGE_COUNT = 600000;
+
+const std::size_t LARGE_VERTEX_COUNT = 1000;
+
+std::string largeInputBody(void)
+{
+    std::string ret;
+
+    ret.reserve(LARGE_EDGE_COUNT * 16);
+
+    for (std::size_t index = 0; index < LARGE_EDGE_COUNT; ++index)
+    {
+        if (index % 1000 == 0)
+        {
+            ret += "c comment\n";
+        }
+
+        std::size_t elementCount = index % 3 + 1;
+
+        for (std::size_t element = 0; element < elementCount; ++element)
+        {
+            if (element > 0)
+            {
+                ret += index % 7 == 0 ? "  " : " ";
+            }
+
+            ret += std::to_string((index * 31 + element * 17) % LARGE_VERTEX_COUNT + 1);
+        }
+
+        ret += index % 5 == 0 ? "\r\n" : "\n";
+    }
+
+    return ret;
+}
+
+std::string largeInputHeader(std::size_t vertexCount, std::size_t edgeCount)
+{
+    return "c large input\np tw " + std::to_string(vertexCount) + " " + std::to_string(edgeCount) + "\n";
+}
+
+htd::IMultiHypergraph * importString(const htd::LibraryInstance * libraryInstance, const std::string & data, std::size_t threadCount)
+{
+    htd_io::HgrFormatImporter importer(libraryInstance);
+
+    importer.setThreadCount(threadCount);
+
+    return importer.import(data.data(), data.size());
+}
+
+TEST(HgrFormatImporterTest, CheckImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string data("c example\np tw 4 3\n1 2\n2  3 4\nc comment\n4\n");
+
+    htd::IMultiHypergraph * graph = importString(libraryInstance, data, 1);
+
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ((std::size_t)4, graph->vertexCount());
+    EXPECT_EQ((std::size_t)3, graph->edgeCount());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), graph->hyperedgeAtPosition(0).elements());
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), graph->hyperedgeAtPosition(1).elements());
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 4 }), graph->hyperedgeAtPosition(2).elements());
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(HgrFormatImporterTest, CheckChunkedImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string data = largeInputHeader(LARGE_VERTEX_COUNT, LARGE_EDGE_COUNT) + largeInputBody();
+
+    ASSERT_GT(data.size(), (std::size_t)(4 << 20));
+
+    htd::IMultiHypergraph * expectedGraph = importString(libraryInstance, data, 1);
+
+    ASSERT_NE(nullptr, expectedGraph);
+
+    ASSERT_EQ(LARGE_VERTEX_COUNT, expectedGraph->vertexCount());
+    ASSERT_EQ(LARGE_EDGE_COUNT, expectedGraph->edgeCount());
+
+    htd::IMultiHypergraph * graph = importString(libraryInstance, data, 4);
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ(expectedGraph->vertexCount(), graph->vertexCount());
+    ASSERT_EQ(expectedGraph->edgeCount(), graph->edgeCount());
+
+    for (htd::index_t index = 0; index < expectedGraph->edgeCount(); ++index)
+    {
+        const htd::Hyperedge & expectedHyperedge = expectedGraph->hyperedgeAtPosition(index);
+        const htd::Hyperedge & hyperedge = graph->hyperedgeAtPosition(index);
+
+        ASSERT_EQ(expectedHyperedge.id(), hyperedge.id());
+        ASSERT_EQ(expectedHyperedge.elements(), hyperedge.elements());
+    }
+
+    delete graph;
+    delete expectedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(HgrFormatImporterTest, CheckMalformedInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string body = largeInputBody();
+
+    std::string header = largeInputHeader(LARGE_VERTEX_COUNT, LARGE_EDGE_COUNT);
+
+    std::vector<std::string> inputs;
+
+    /* An empty line close to the end of the input, i.e., within the last chunk. */
+    inputs.push_back(header + body.substr(0, body.size() - 16) + "\n" + body.substr(body.size() - 16));
+
+    /* An out-of-range vertex within one of the inner chunks. */
+    std::string outOfRange = body;
+
+    outOfRange.replace(outOfRange.find('\n', outOfRange.size() / 2) + 1, 1, std::to_string(LARGE_VERTEX_COUNT + 1) + " ");
+
+    inputs.push_back(header + outOfRange);
+
+    /* A vertex 0 at the very beginning of the first chunk. */
+    inputs.push_back(header + "0\n" + body);
+
+    /* An edge count which does not match the number of hyperedges. */
+    inputs.push_back(largeInputHeader(LARGE_VERTEX_COUNT, LARGE_EDGE_COUNT - 1) + body);
+    inputs.push_back(largeInputHeader(LARGE_VERTEX_COUNT, LARGE_EDGE_COUNT + 1) + body);
+
+    /* A vertex count whose storage cannot be allocated. */
+    inputs.push_back(largeInputHeader(999999999999999999ULL, LARGE_EDGE_COUNT) + body);
+
+    for (const std::string & data : inputs)
+    {
+        EXPECT_EQ(nullptr, importString(libraryInstance, data, 1));
+        EXPECT_EQ(nullptr, importString(libraryInstance, data, 4));
+    }
+
+    std::string data("p tw 2 1\n1 2\n\n");
+
+    EXPECT_EQ(nullptr, importString(libraryInstance, data, 1));
+
+    data = "p tw 2 1\n1 3\n";
+
+    EXPECT_EQ(nullptr, importString(libraryInstance, data, 1));
+
+    data = "p tw 2 2\n1 2\n";
+
+    EXPECT_EQ(nullptr, importString(libraryInstance, data, 1));
+
+    data = "p tw 999999999999999999 0\n";
+
+    EXPECT_EQ(nullptr, importString(libraryInstance, data, 1));
+
+    delete libraryInstance;
+}
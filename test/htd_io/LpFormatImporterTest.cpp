@@ -0,0 +1,261 @@
+/*
+ * File:   LpFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <string>
+#include <vector>
+
+class LpFormatImporterTest : public ::testing::Test
+{
+    public:
+        LpFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~LpFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::vector<std::vector<std::string>> namedHyperedges(const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+{
+    std::vector<std::vector<std::string>> ret;
+
+    for (htd::index_t index = 0; index < graph.edgeCount(); ++index)
+    {
+        std::vector<std::string> elements;
+
+        for (htd::vertex_t vertex : graph.internalGraph().hyperedgeAtPosition(index).elements())
+        {
+            elements.push_back(graph.vertexName(vertex));
+        }
+
+        ret.push_back(elements);
+    }
+
+    return ret;
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * importString(const htd::LibraryInstance * libraryInstance, const std::string & data)
+{
+    htd_io::LpFormatImporter importer(libraryInstance);
+
+    return importer.import(data.data(), data.size());
+}
+
+TEST(LpFormatImporterTest, CheckFactsSpreadAcrossLines)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "edge(\n  a,\n  b\n)\n.\nvertex(\n c\n).\nedge(b,\r\nc).");
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ((std::size_t)3, graph->vertexCount());
+
+    EXPECT_EQ("a", graph->vertexName(1));
+    EXPECT_EQ("b", graph->vertexName(2));
+    EXPECT_EQ("c", graph->vertexName(3));
+
+    std::vector<std::vector<std::string>> expectedEdges { { "a", "b" }, { "b", "c" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckSeveralFactsPerLine)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "vertex(x). edge(x,y).edge(y, z, w).  vertex(v).\n");
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ((std::size_t)5, graph->vertexCount());
+
+    EXPECT_EQ("x", graph->vertexName(1));
+    EXPECT_EQ("y", graph->vertexName(2));
+    EXPECT_EQ("z", graph->vertexName(3));
+    EXPECT_EQ("w", graph->vertexName(4));
+    EXPECT_EQ("v", graph->vertexName(5));
+
+    std::vector<std::vector<std::string>> expectedEdges { { "x", "y" }, { "y", "z", "w" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckComments)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "% edge(p,q).\n"
+                                                                                                "%* edge(r,s).\n"
+                                                                                                "   vertex(t). *% edge(a, b). % edge(u,v).\n"
+                                                                                                "edge(b,\n"
+                                                                                                "d). %* trailing *%\n"
+                                                                                                "%* unterminated edge(x,y).");
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ((std::size_t)3, graph->vertexCount());
+
+    EXPECT_TRUE(graph->isVertexName("a"));
+    EXPECT_TRUE(graph->isVertexName("b"));
+    EXPECT_TRUE(graph->isVertexName("d"));
+
+    std::vector<std::vector<std::string>> expectedEdges { { "a", "b" }, { "b", "d" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckRulesAreSkipped)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "edge(a,b).\n"
+                                                                                                "edge(X,Y) :- edge(Y,X).\n"
+                                                                                                "reachable(X) :- edge(a,X), vertex(X).\n"
+                                                                                                ":- edge(c,d).\n"
+                                                                                                "vertex(1..3).\n"
+                                                                                                "other(e,f). vertex(g).");
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ((std::size_t)4, graph->vertexCount());
+
+    EXPECT_EQ("a", graph->vertexName(1));
+    EXPECT_EQ("b", graph->vertexName(2));
+    EXPECT_EQ("1..3", graph->vertexName(3));
+    EXPECT_EQ("g", graph->vertexName(4));
+
+    std::vector<std::vector<std::string>> expectedEdges { { "a", "b" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckQuotedStrings)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "edge(\"a)b\", \"c. d\").\n"
+                                                                                                "vertex(\"e,\\\"f\\\"\").\n"
+                                                                                                "other(\"). edge(x,y).\").");
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ((std::size_t)3, graph->vertexCount());
+
+    EXPECT_EQ("\"a)b\"", graph->vertexName(1));
+    EXPECT_EQ("\"c. d\"", graph->vertexName(2));
+    EXPECT_EQ("\"e,\\\"f\\\"\"", graph->vertexName(3));
+
+    std::vector<std::vector<std::string>> expectedEdges { { "\"a)b\"", "\"c. d\"" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckNestedTerms)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* Edges are only split at top-level commas, the argument of a vertex is never split. */
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "edge(f(a, b), (c, d), e).\n"
+                                                                                                "vertex(g(h, i)).\n"
+                                                                                                "edge(e, , f(a, b)).");
+
+    ASSERT_NE(nullptr, graph);
+
+    ASSERT_EQ((std::size_t)4, graph->vertexCount());
+
+    EXPECT_EQ("f(a, b)", graph->vertexName(1));
+    EXPECT_EQ("(c, d)", graph->vertexName(2));
+    EXPECT_EQ("e", graph->vertexName(3));
+    EXPECT_EQ("g(h, i)", graph->vertexName(4));
+
+    std::vector<std::vector<std::string>> expectedEdges { { "f(a, b)", "(c, d)", "e" }, { "e", "f(a, b)" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckMalformedStatements)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* A statement which is not a well-formed fact is skipped up to its terminating period. */
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importString(libraryInstance, "edge(a, b. edge(c,d).\n"
+                                                                                                "edge(e,f)\n"
+                                                                                                "edge(g,h).\n"
+                                                                                                "edge(i,j)");
+
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ((std::size_t)2, graph->vertexCount());
+
+    std::vector<std::vector<std::string>> expectedEdges { { "c", "d" } };
+
+    EXPECT_EQ(expectedEdges, namedHyperedges(*graph));
+
+    delete graph;
+
+    delete libraryInstance;
+}
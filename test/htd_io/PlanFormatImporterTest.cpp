@@ -0,0 +1,190 @@
+/*
+ * File:   PlanFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class PlanFormatImporterTest : public ::testing::Test
+{
+    public:
+        PlanFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~PlanFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+void expectEqualSubtrees(const htd::ITreeDecomposition & expected, htd::vertex_t expectedNode, const htd::ITreeDecomposition & actual, htd::vertex_t actualNode)
+{
+    EXPECT_EQ(expected.bagContent(expectedNode), actual.bagContent(actualNode));
+
+    EXPECT_EQ(expected.inducedHyperedges(expectedNode).size(), actual.inducedHyperedges(actualNode).size());
+
+    ASSERT_EQ(expected.childCount(expectedNode), actual.childCount(actualNode));
+
+    for (htd::index_t index = 0; index < expected.childCount(expectedNode); ++index)
+    {
+        expectEqualSubtrees(expected, expected.childAtPosition(expectedNode, index), actual, actual.childAtPosition(actualNode, index));
+    }
+}
+
+std::size_t padded(std::size_t size)
+{
+    return (size + 7) & ~static_cast<std::size_t>(7);
+}
+
+TEST(PlanFormatImporterTest, CheckRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+    graph.addEdge(3, 4);
+    graph.addEdge(std::vector<htd::vertex_t> { 4, 5, 6 });
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    std::ostringstream outputStream;
+
+    htd_io::PlanFormatExporter exporter;
+
+    exporter.write(*decomposition, graph, outputStream);
+
+    std::string data = outputStream.str();
+
+    htd_io::PlanFormatImporter importer(libraryInstance);
+
+    htd::ITreeDecomposition * importedDecomposition = importer.import(data.data(), data.size());
+
+    ASSERT_NE(nullptr, importedDecomposition);
+
+    ASSERT_EQ(decomposition->vertexCount(), importedDecomposition->vertexCount());
+
+    expectEqualSubtrees(*decomposition, decomposition->root(), *importedDecomposition, importedDecomposition->root());
+
+    delete importedDecomposition;
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(PlanFormatImporterTest, CheckMalformedInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(4);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    std::ostringstream outputStream;
+
+    htd_io::PlanFormatExporter exporter;
+
+    exporter.write(*decomposition, graph, outputStream);
+
+    std::string data = outputStream.str();
+
+    htd_io::PlanFormatImporter importer(libraryInstance);
+
+    for (std::size_t size = 0; size < data.size(); ++size)
+    {
+        EXPECT_EQ(nullptr, importer.import(data.data(), size));
+    }
+
+    std::size_t nodeCount = decomposition->vertexCount();
+
+    /* Skip the header, the node types, the parents, the child offsets and the children to reach the bag offsets. */
+    std::size_t bagOffsets = htd_io::PlanFormat::HEADER_SIZE +
+                             2 * padded(nodeCount * sizeof(std::uint32_t)) +
+                             (nodeCount + 1) * sizeof(std::uint64_t) +
+                             padded((nodeCount - 1) * sizeof(std::uint32_t));
+
+    std::uint64_t offset = 0;
+
+    std::memcpy(&offset, &data[bagOffsets + nodeCount * sizeof(std::uint64_t)], sizeof(offset));
+
+    std::size_t bagElementCount = 0;
+
+    for (htd::vertex_t node : decomposition->vertices())
+    {
+        bagElementCount += decomposition->bagSize(node);
+    }
+
+    ASSERT_EQ(bagElementCount, offset);
+
+    offset = static_cast<std::uint64_t>(1) << 40;
+
+    std::memcpy(&data[bagOffsets + sizeof(std::uint64_t)], &offset, sizeof(offset));
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    std::memcpy(&data[0], "HTDG", 4);
+
+    EXPECT_EQ(nullptr, importer.import(data.data(), data.size()));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}